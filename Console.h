@@ -13,7 +13,7 @@
   NOTE: There is also a console interface on the main page - click the title.
 
 */
-String WebConsole = R"HTML5(<!DOCTYPE html>
+const char WebConsole[] PROGMEM = R"HTML5(<!DOCTYPE html>
 <html>
 <head>
   <title>Web Console for ESP32 Signal Generator</title>
@@ -111,7 +111,7 @@ When a response has been received, this input will reset.">
 
     <button onclick="sendCommand()" class="send-button" type="submit" title="Click here to send the command.
   (or hit &lt;enter&gt; from the input)">Send</button>
-  <pre id="InfoDIV" title="Output goes here."><!--{insert}--></pre>
+  <pre id="InfoDIV" title="Output goes here."></pre>
 </div>
 </form>
 
@@ -125,11 +125,39 @@ When a response has been received, this input will reset.">
 //
 var updateDelay = 250;
 
+// True while we have a live event stream (command output comes to us)..
+var pushed = false;
+
 // On page load, drop the cursor directly into the command input for instant typing..
 window.onload = (event) => {
   document.querySelector("#webConsole").focus();
+  getCommandList();
+  getEvents();
 };
 
+// The first time you visit, you get a list of commands (after that, it's blank)..
+function getCommandList() {
+  var AJAX = new XMLHttpRequest();
+  AJAX.onreadystatechange = function() {
+    if(this.readyState == 4 && this.status == 200 && this.responseText) {
+      postMSG(this.responseText);
+    }
+  };
+  AJAX.open("GET", "consoleData", true);
+  AJAX.send();
+}
+
+// Live command output, from this console, or anywhere else..
+function getEvents() {
+  if (!window.EventSource) return;
+  var events = new EventSource("events");
+  events.onopen = function() { pushed = true; };
+  events.onerror = function() { pushed = false; };
+  events.addEventListener("message", function(e) {
+    postMSG(e.data);
+  });
+}
+
 // Send the command..
 function sendCommand() {
   var AJAX = new XMLHttpRequest();
@@ -141,9 +169,12 @@ function sendCommand() {
       }
       document.querySelector("#webConsole").focus();
       document.querySelector("#webConsole").value = "";
-      window.setTimeout( function() {
-        getCommandStatus();
-      }, updateDelay);
+      // A blank command has no output of its own; we ask for the settings..
+      if (!pushed || myCommand == "!") {
+        window.setTimeout( function() {
+          getCommandStatus();
+        }, updateDelay);
+      }
     }
   };
   var myCommand = document.querySelector("#webConsole").value;
@@ -0,0 +1,245 @@
+/*
+  A part of ESP32 Signal Generator
+
+  https://corz.org/public/scripts/ESP32/SignalGenerator/
+
+  Pulse trains for the RMT peripheral (very low frequencies, counted bursts, gated trains and
+  user-defined pulse sequences).
+
+  Like Synth.h, it's numbers in, RMT items out. No Arduino, no ESP-IDF, no globals; so you can build
+  the encoder on your PC and check what it makes before you point it at a stepper driver..
+
+    #include "Pulse.h"
+    int main() {
+      PulseTrain t = { 2000000, 500000, 3, 1000000, 0, {} };  // 0.5Hz, 0.5s high, 3 at a time, 1s gap
+      uint32_t items[64];
+      bool loop;
+      size_t n = pulseEncode(t, 1, items, 64, loop);
+      PulseMeasure m = pulseMeasure(items, n);
+      printf("%zu items, %u pulses, %llu ticks high, %llu low\n", n, m.pulses, m.high, m.low);
+    }
+
+  An RMT item (rmt_item32_t) is two halves, each a level and a 15-bit duration in ticks..
+
+    bits 0-14 = duration0, bit 15 = level0, bits 16-30 = duration1, bit 31 = level1
+
+  A duration of 0 is the end marker: a one-shot transmission stops there (and the pin goes to its
+  idle level, low), in loop mode, the RMT starts again from the top. Anything longer than 32767
+  ticks is simply split across more halves, so with 1us ticks, a 10 second pulse is 306 halves.
+
+  It's all inline (or const), so more than one file can include it.
+
+*/
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+const uint32_t pulseTickMAX = 32767;    // Longest half-item, in ticks
+const uint8_t pulseSequenceMAX = 16;    // Durations in a user sequence
+
+// Room for a train. It gets all eight RMT memory blocks (64 items each), as nothing else uses the RMT..
+const uint8_t pulseBlocks = 8;
+const size_t pulseLoopMAX = pulseBlocks * 64 - 1;   // Loops must fit in RMT memory (less one for the driver)
+const size_t pulseItemsMAX = 4096;                  // One-shot bursts can stream from the heap (16KB)
+
+// 1us ticks (APB) if the train fits, else 100us (REF_TICK). At 100us, no time may move more than 1%..
+const uint32_t pulseTickChoices[2] = { 1, 100 };
+const uint32_t pulseErrorMAX = 10000;   // ppm
+
+// A pulse train. All times are in microseconds..
+struct PulseTrain {
+  uint32_t period;      // One pulse, high + low
+  uint32_t width;       // .. the high part
+  uint32_t count;       // Pulses (or sequences) per burst (0 == no bursts, just keep going)
+  uint32_t gap;         // Low time after each burst before the next (0 == only the one burst)
+  uint8_t steps;        // Not 0? Then this many durations from sequence[] replace period/width..
+  uint32_t sequence[pulseSequenceMAX];  // .. high, low, high, low, etc.
+};
+
+// Where the items go. Runs of the same level are merged before they're written..
+struct PulseEncoder {
+  uint32_t *items;
+  size_t capacity;      // In items
+  size_t count;
+  bool half;            // The last item only has its first half
+  bool overflow;        // Ran out of room (pulseEnd() returns 0)
+  bool level;           // Level waiting to go out..
+  uint64_t pending;     // .. for this many ticks
+};
+
+
+inline void pulseBegin(PulseEncoder &e, uint32_t *items, size_t capacity) {
+  e.items = items;
+  e.capacity = capacity;
+  e.count = 0;
+  e.half = false;
+  e.overflow = false;
+  e.level = false;
+  e.pending = 0;
+}
+
+
+// Microseconds -> ticks. Anything that isn't zero gets at least one tick (0 would end the stream)..
+inline uint64_t pulseTicks(uint32_t us, uint32_t tickUs) {
+  if (us == 0) return 0;
+  uint64_t ticks = ((uint64_t)us + tickUs / 2) / tickUs;
+  return (ticks == 0) ? 1 : ticks;
+}
+
+
+// One half-item (1 to pulseTickMAX ticks)..
+inline void pulseHalf(PulseEncoder &e, bool level, uint32_t ticks) {
+  uint32_t half = (ticks & 0x7FFF) | ((uint32_t)level << 15);
+  if (e.half) {
+    e.items[e.count - 1] |= half << 16;
+    e.half = false;
+    return;
+  }
+  if (e.count >= e.capacity) {
+    e.overflow = true;
+    return;
+  }
+  e.items[e.count++] = half;
+  e.half = true;
+}
+
+
+// Write out the waiting level, in as many halves as it takes..
+inline void pulseFlush(PulseEncoder &e) {
+  while (e.pending > 0 && !e.overflow) {
+    uint32_t chunk = (e.pending > pulseTickMAX) ? pulseTickMAX : (uint32_t)e.pending;
+    pulseHalf(e, e.level, chunk);
+    e.pending -= chunk;
+  }
+  e.pending = 0;
+}
+
+
+// Hold the output at <level> for <ticks>..
+inline void pulseLevel(PulseEncoder &e, bool level, uint64_t ticks) {
+  if (ticks == 0) return;
+  if (e.pending > 0 && level != e.level) pulseFlush(e);
+  e.level = level;
+  e.pending += ticks;
+}
+
+
+// Finish with an end marker. Returns the number of items (including the marker), or 0 if it didn't fit..
+inline size_t pulseEnd(PulseEncoder &e) {
+  pulseFlush(e);
+  if (e.half) {
+    e.half = false;       // Its second half is all zeros, which is the marker.
+  } else if (e.count < e.capacity) {
+    e.items[e.count++] = 0;
+  } else {
+    e.overflow = true;
+  }
+  return (e.overflow) ? 0 : e.count;
+}
+
+
+// One pulse (or one run through the sequence)..
+inline void pulseUnit(PulseEncoder &e, const PulseTrain &t, uint32_t tickUs) {
+  if (t.steps > 0) {
+    for (uint8_t i = 0; i < t.steps && i < pulseSequenceMAX; i++) {
+      pulseLevel(e, (i % 2) == 0, pulseTicks(t.sequence[i], tickUs));
+    }
+    return;
+  }
+  uint32_t width = (t.width < t.period) ? t.width : t.period;
+  pulseLevel(e, true, pulseTicks(width, tickUs));
+  pulseLevel(e, false, pulseTicks(t.period - width, tickUs));
+}
+
+
+/*
+  Encode a whole train. <loop> says whether the RMT should repeat it in loop mode (no count, or
+  bursts with a gap) or send it the once. Returns the number of items, or 0 if it won't fit in
+  <capacity> (try bigger ticks, or fewer pulses)..
+                                                                                        */
+inline size_t pulseEncode(const PulseTrain &t, uint32_t tickUs, uint32_t *items, size_t capacity, bool &loop) {
+
+  PulseEncoder e;
+  pulseBegin(e, items, capacity);
+
+  if (t.count == 0) {
+    // Just the one pulse; the RMT goes round and round it..
+    pulseUnit(e, t, tickUs);
+    loop = true;
+  } else {
+    for (uint32_t i = 0; i < t.count && !e.overflow; i++) pulseUnit(e, t, tickUs);
+    pulseLevel(e, false, pulseTicks(t.gap, tickUs));
+    loop = (t.gap > 0);
+  }
+  return pulseEnd(e);
+}
+
+
+// The most any time in the train moves when it's rounded to <tickUs> ticks, in parts per million..
+inline uint32_t pulseErrorPPM(const PulseTrain &t, uint32_t tickUs) {
+  uint32_t times[pulseSequenceMAX + 1];
+  uint8_t n = 0;
+  if (t.steps > 0) {
+    for (uint8_t i = 0; i < t.steps && i < pulseSequenceMAX; i++) times[n++] = t.sequence[i];
+  } else {
+    uint32_t width = (t.width < t.period) ? t.width : t.period;
+    times[n++] = width;
+    times[n++] = t.period - width;
+  }
+  if (t.count > 0) times[n++] = t.gap;
+  uint64_t worst = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    if (times[i] == 0) continue;
+    uint64_t actual = pulseTicks(times[i], tickUs) * tickUs;
+    uint64_t off = (actual > times[i]) ? actual - times[i] : times[i] - actual;
+    uint64_t ppm = off * 1000000 / times[i];
+    if (ppm > worst) worst = ppm;
+  }
+  return (worst > 0xFFFFFFFF) ? 0xFFFFFFFF : (uint32_t)worst;
+}
+
+
+/*
+  Choose the tick and encode the train into <items> (pulseItemsMAX of them). Returns the number of
+  items, with <tickUs> and <loop> set, or 0 if it won't go. Then <errorPPM> says why: over
+  pulseErrorMAX, it only fits with ticks too coarse for its times (a 10us pulse would be 100us);
+  otherwise it's just too long..
+                                                                                    */
+inline size_t pulsePlan(const PulseTrain &t, uint32_t *items, uint32_t &tickUs, bool &loop, uint32_t &errorPPM) {
+  errorPPM = 0;
+  for (uint8_t i = 0; i < 2; i++) {
+    tickUs = pulseTickChoices[i];
+    size_t count = pulseEncode(t, tickUs, items, pulseItemsMAX, loop);
+    if (count == 0 || (loop && count > pulseLoopMAX)) continue;
+    errorPPM = pulseErrorPPM(t, tickUs);
+    return (errorPPM > pulseErrorMAX) ? 0 : count;
+  }
+  return 0;
+}
+
+
+// What an item stream actually does (for reports, and for checking the encoder)..
+struct PulseMeasure {
+  uint64_t high;        // Ticks spent high..
+  uint64_t low;         // .. and low
+  uint32_t pulses;      // Rising edges (counting the very start, if it starts high)
+  size_t halves;        // Non-empty halves, before the end marker
+};
+
+inline PulseMeasure pulseMeasure(const uint32_t *items, size_t count) {
+  PulseMeasure m = {};
+  bool last = false;
+  for (size_t i = 0; i < count; i++) {
+    for (uint8_t h = 0; h < 2; h++) {
+      uint32_t half = (items[i] >> (h * 16)) & 0xFFFF;
+      uint32_t ticks = half & 0x7FFF;
+      bool level = half >> 15;
+      if (ticks == 0) return m;
+      if (level) m.high += ticks; else m.low += ticks;
+      if (level && !last) m.pulses++;
+      last = level;
+      m.halves++;
+    }
+  }
+  return m;
+}
@@ -26,12 +26,33 @@ String version = "7.4.3.2";   // "Silicon as Cities"
 #include "driver/dac.h"
 #include "driver/i2s.h"
 
+// Remote control (RMT) peripheral, for pulse trains (also installed by default)
+#include "driver/rmt.h"
+
 // "permanent" preferences storage (also installed by default)
 // https://espressif-docs.readthedocs-hosted.com/projects/arduino-esp32/en/latest/api/preferences.html
 // We use this for storing settings and presets.
 #include "nvs_flash.h"
 #include <Preferences.h>
 
+// Heap statistics, for the built-in benchmark (also installed by default)
+#include "esp_heap_caps.h"
+
+// High-resolution (microsecond) timer, for the event scheduler (also installed by default)
+#include "esp_timer.h"
+
+// Atomics, for the lock-free command queue (part of the C++ standard library)
+#include <atomic>
+
+// Base64, for compact exports (part of the IDF)
+#include "mbedtls/base64.h"
+
+// Waveform synthesis for DDS and Dual Channel modes (plain C++; see inside)
+#include "Synth.h"
+
+// Pulse train encoder for the RMT (plain C++ again)
+#include "Pulse.h"
+
 // No external libraries required.
 
 
@@ -41,6 +62,53 @@ String version = "7.4.3.2";   // "Silicon as Cities"
               */
 
 
+/*
+   Build Features..
+
+   Like "#define REMOTE" (see "WiFi Remote Control", below), these decide what gets built at all.
+   Comment one out and its code is gone from the firmware and from loop(); not skipped at run-time,
+   gone. Handy for a headless unit in a rack that will never see a button, a pot or a human..
+                                                                                      */
+#define BUTTONS     // Physical Buttons
+#define TOUCH       // Touch Controls (touch UP/DOWN pins)
+#define POT         // Potentiometer Control
+#define VERBOSE     // Extended Information (eXi) output
+#define SOFT_AP     // Soft Access Point (only with REMOTE)
+
+/*
+  The switches for these (useButtons, usePOT, eXi, etc.) are FeatureFlags. You set and test them
+  like any bool, but if their feature isn't built, they are always false, and the compiler knows
+  it, so everything behind an "if (usePOT)" goes, too..
+                                                                                      */
+template <bool Built>
+struct FeatureFlag {
+  bool on;
+  operator bool() const { return Built && on; }
+  FeatureFlag &operator=(bool value) { on = value; return *this; }
+};
+
+#if defined BUTTONS
+  constexpr bool haveButtons = true;
+#else
+  constexpr bool haveButtons = false;
+#endif
+#if defined TOUCH
+  constexpr bool haveTouch = true;
+#else
+  constexpr bool haveTouch = false;
+#endif
+#if defined POT
+  constexpr bool havePot = true;
+#else
+  constexpr bool havePot = false;
+#endif
+#if defined VERBOSE
+  constexpr bool haveVerbose = true;
+#else
+  constexpr bool haveVerbose = false;
+#endif
+
+
 /*
    Initial values for wave shape, frequency and pulse width (duty cycle)
 
@@ -164,6 +232,95 @@ uint16_t SineLowerLimit  = 16;
 uint16_t RectLowerLimit  = 1;
 
 
+/*
+  Triangle/Sawtooth DDS (Direct Digital Synthesis) mode..
+
+  Normally, the triangle generator picks one of four buffer lengths and sets the I2S sample rate to
+  suit, which means the real frequency snaps to whole sample rate steps and the bottom end is
+  clamped at 153Hz. In DDS mode the sample rate stays fixed and a 32-bit phase accumulator steps
+  through each sample instead, so you can ask for 0.01Hz and get (very nearly) exactly that.
+
+  Resolution is ddsSampleRate / 2^32, which at 250kHz is about 0.00006Hz. The trade-off is that the
+  waveform gets coarser as you go up, so DDS has its own (lower) upper limit.
+
+  Toggle with "dds" ("ddse" to enable, "ddsd" to disable).
+                                                                                          */
+bool useDDS = false;
+uint32_t ddsSampleRate = 250000;  // Fixed I2S sample rate for DDS (Hz)
+float_t DDSLowerLimit = 0.01;     // Hz
+uint32_t DDSUpperLimit = 25000;   // Ten samples per period at 250kHz. Above this, use the regular mode.
+
+
+/*
+  Dual Channel mode..
+
+  Two different waves at once, one on each DAC pin (25 and 26), from the same DDS sample clock, so
+  the two are phase-locked. X-Y scope fun with one ESP32! Channel 1 is your regular triangle signal
+  (frequency, pulse width and amplitude as usual, its wave and phase offset from "dual1"); channel
+  2 has settings all of its own. Both can be triangle/sawtooth, sine or rectangle, or a plain saw
+  ramp (w) or noise (n).
+
+  Dual mode runs on the DDS engine, so enabling it also enables DDS (and DDS limits apply to both).
+  It's only active in triangle mode, which is where the I2S DAC is ours.
+
+  Toggle with "dual" ("duale" to enable, "duald" to disable) and set a channel with, e.g..
+
+    dual2 w=s,f=1.001k,p=50,a=4,o=90
+
+  w = wave (t/s/r/w/n), f = frequency, p = pulse width, a = amplitude (1-4), o = phase offset (degrees)
+                                                                                          */
+bool useDual = false;
+struct DualSettings {
+  char waveA;           // Channel 1's wave (the rest of channel 1 is the regular signal)
+  uint16_t offsetA;     // Channel 1's phase offset (degrees)
+  char waveB;
+  uint16_t offsetB;
+  float_t frequencyB;
+  uint8_t pulseB;
+  uint8_t amplitudeB;   // 1-4, like waveAmplitude
+};
+DualSettings dual = { 't', 0, 's', 90, 1000, 50, 4 };
+
+
+/*
+  Modulation..
+
+    mod am 50 5     Amplitude, dips by up to 50%, five times a second
+    mod fm 10 2     Frequency, swings 10% either side, twice a second
+    mod pwm 20 1    Pulse width, swings 20 points either side, once a second
+    mod off
+
+  Triangle mode does it in the DDS engine, sample by sample, so it's smooth at any rate (and all
+  three types work). Rectangle mode gets FM and PWM from a 1ms timer, which moves the LEDC divider
+  and duty; Sine mode gets FM the same way. There's no AM for those two; the rectangle output is a
+  digital pin (it's either high or low) and the cosine generator only has four amplitude steps.
+
+  Modulation is saved with your presets (and defaults). Not available in Dual Channel mode.
+                                                                                          */
+struct SGModulation {
+  char type;            // 'a' AM, 'f' FM, 'p' PWM, or 0 (off)
+  uint8_t depth;        // Percent (PWM: pulse width points)
+  float_t rate;         // Hz
+};
+SGModulation modulation = { 0, 50, 5 };
+float_t modRateMAX = 5000;  // Hz (the timer modes run at 1kHz, so they top out at 100Hz anyway)
+const uint8_t fmDepthMAX = 90; // Percent. At 100, FM swings the carrier all the way down to 0Hz
+
+
+/*
+  Pulse Trains..
+
+  For the really low stuff, and things LEDC can't do: counted bursts, bursts with gaps, and your own
+  pulse sequences. The RMT peripheral plays them from its own memory, so there's no CPU work per
+  edge (and no jitter from WiFi). Stepper drivers, trigger inputs, that sort of thing.
+
+  A train goes out on the square wave pin (PWMPin) and takes it over until the next signal change.
+  All times are microseconds. This is the one you get with a plain "train" (1Hz, 50%, forever);
+  whatever you set last is remembered. See trainSettings() for the details..
+                                                                                        */
+PulseTrain train = { 1000000, 500000, 0, 0, 0, {} };
+
+
 // You might not want to do this..
 bool checkLimitsOnBoot = true;
 
@@ -271,7 +428,7 @@ uint8_t pStep = 5;
 // You can attach a potentiometer (variable resistor) to your board and control *something*.
 // Don't enable this unless you actually hooked up a potentiometer!
 //
-bool usePOT = false;
+FeatureFlag<havePot> usePOT = { false };
 
 // Which Pin for Potentiometer?
 uint8_t potPIN = 34; // GIOP34
@@ -307,7 +464,7 @@ uint8_t stepAccuracy = 1;
 /*
    Physical Buttons..
                         */
-bool useButtons = true;
+FeatureFlag<haveButtons> useButtons = { true };
 
 // Total number of buttons..
 const uint8_t buttonCount = 5;
@@ -422,7 +579,7 @@ String buttonCommands[buttonCount] = {
   NOTE: You can toggle this from the command-line/console/url/etc. with "e".
   This is automatically disabled during loops.
                   */
-bool eXi = true;
+FeatureFlag<haveVerbose> eXi = { true };
 
 /*
    From now on, all "extended information" variables shall be named "eXi".
@@ -453,7 +610,7 @@ float_t SINFAKT = 131.3;
 
 // Maximum number of presets.
 // After a lot of testing, I find that 50 works well for the default partition size. See notes above.
-uint8_t presetMAX = 50;
+const uint8_t presetMAX = 50;
 /*
   NOTE: The ABSOLUTE MAXIMUM number of presets you can create is 253. Attempting to save preset 254
   may crash your module, or at the very least give you a nasty error. No matter how much NVS space
@@ -664,8 +821,20 @@ esp32doit-devkit-v1.menu.PartitionScheme.default.build.partitions=default
 // In other words, we can put blocks of code between #if defined/#endif conditions, and if it's NOT
 // defined, the compiler ignores *all* the code between the conditions; does not see it at all.
 
+// The same, for everything else that decides what's built (see "Build Features", above)..
+#if defined REMOTE
+  constexpr bool haveRemote = true;
+#else
+  constexpr bool haveRemote = false;
+#endif
+#if defined REMOTE && defined SOFT_AP
+  constexpr bool haveSoftAP = true;
+#else
+  constexpr bool haveSoftAP = false;
+#endif
+
 // We can also set this on-the-fly (so long as you leave in the above #define REMOTE)
-bool RemControl = true;
+FeatureFlag<haveRemote> RemControl = { true };
 
 // You can switch this with "remote" (to toggle), "remotee" to enable and "remoted" to disable.
 
@@ -745,12 +914,33 @@ String softAPPass = "SigzSigzFutnik";
   The code you need is there already.
 
                     */
-bool onlyAP = false;
+FeatureFlag<haveSoftAP> onlyAP = { false };
 
 // You can switch this from the command-line with the wap/waa commands (WiFi Access Point, WiFi All
 // Access). Your device will reboot and start up in the new mode.
 
 
+/*
+  Network Sync
+
+  Got more than one Signal Generator? One can lead and the rest follow its clock, over UDP on
+  whatever network they share (your WiFi, or the leader's Access Point). Then a change scheduled
+  on the leader happens on every unit at the same moment (to within a few hundred microseconds,
+  usually), rather than whenever each one's web request happens to land..
+
+    sync leader       This one leads
+    sync follow       This one follows (it finds the leader by itself)
+    sync 500:go       (On the leader) restart the signal on every unit, half a second from now
+    sync 250:1k       .. or any timed event command (frequency, p*, r/s/t, go)
+    sync?             Report (the leader lists its followers and their clock offsets)
+    sync off
+
+  Needs remote control (WiFi). "off", "leader" or "follow" is remembered.
+                                                                                   */
+char syncRole = 0;              // 'l' leader, 'f' follower, 0 off
+uint16_t syncLead = 250;        // Default ms ahead for "sync go" (time for the packets to get there)
+
+
 
 // If your board isn't defined, you can uncomment this..
 // static const uint8_t LED_BUILTIN = 2;
@@ -773,7 +963,7 @@ const uint8_t led = 2;
 // Reboot Daily?
 // If you are running for a *long* time with lots of access requests, this makes sense.
 // NOTE: if you are playing a loop, this is ignored until the loop ends.
-bool dailyReboot = true;
+constexpr bool dailyReboot = true;
 
 
 
@@ -832,11 +1022,268 @@ char commandsDelimiter = ';';
   const String _PLAIN_TEXT_ = "text/plain;charset=UTF-8"; //  We will use this String a lot.
   const String _HTML5_TEXT_ = "text/html;charset=UTF-8"; // This is the default for HTML5, anyway.
 
+  // HTML you can edit.. (both live in flash, not RAM)
+  #include "WebPage.h"
+  #include "Console.h"
+  #include "WebPagesGz.h" // .. and gzipped copies of them (made by host/gzpages.py)
+
+  /*
+    The simple UP/DOWN page (see sendSimplePage()). The page picks its URLs from the address you
+    asked for; /pwm and /bits get pulse width and resolution, anything else, frequency.
+                                                                                      */
+  const char SimplePage[] PROGMEM = R"SimplePage(<!DOCTYPE html><html><head><title>ESP32 Signal Generator</title><meta name="viewport" content="width=device-width, initial-scale=1"><link rel="shortcut icon" type="image/png" sizes="16x16" href="data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAABAAAAAQCAQAAAC1+jfqAAAABGdBTUEAALGPC/xhBQAAAAlwSFlzAAAuIwAALiMBeKU/dgAAAAd0SU1FB+cBFRcAJyFRDxkAAAAZdEVYdENvbW1lbnQAQ3JlYXRlZCB3aXRoIEdJTVBXgQ4XAAAA3ElEQVQoz4WRP0tCcRSGH34u0ReIxoKQwBovTQ1iGPgxwqFdcg/nvoHQ3DdoqqFJh8ylMXFsMCSoIa+Pg97rn3vDZznDeTnnvOfFsgP/Y2CZpB07yZUwr13PLfmYowgAQy7Y55QqPTKo3nrsyJFFr5xuTEA/DbZVbUvm4gB9pkQAnAHvGxsCdNnhAIBD9nhLW01uAGJrXqcDG0YLu2Pxbn7DKg/ih6o98TmxueQEeAWgQ6CU2Fzy56UVf/yyaCuxuc6T2LDu7sJwRhB7b8EjX9JH5WT57e9KWFvingFTFG1S956a3gAAAABJRU5ErkJggg=="/></head><style>html{width:100% !important;height:100vh !important;color:#4CAF50;margin:0;}div,pre,p,form{margin:0;}.controller{margin:auto;width:96%;}label{display:none;}.step-button{width:95%;border-radius:0.15em;background-color:#4CAF50;border:none;color:white;text-align:center; padding:0.1em 0.2em;font-size:8em;font-weight:bold;margin:0.175em auto;}.step-button:hover{background-color:#00778f;}.step-button:active{background-color:#fff;color:#8cacb3;}#fup, #fdown {width:100%;height:40vh;}</style><body><div class="controller"><button id="fup" onclick="clickUP()" class="step-button" title="UP">&#8963;</button><button id="fdown" onclick="clickDOWN()" class="step-button" title="DOWN">&#8964;</button></div><script>var up="setUP",down="setDOWN";if(location.pathname=="/pwm"){up="pulseUP";down="pulseDOWN";}if(location.pathname=="/bits"){up="resUP";down="resDOWN";}function clickUP(){var AJAX=new XMLHttpRequest();AJAX.open("GET",up,true);AJAX.send();}function clickDOWN(){var AJAX=new XMLHttpRequest();AJAX.open("GET",down,true);AJAX.send();}document.onkeydown=ArrowKeys;function ArrowKeys(e){if(e.keyCode=='38'){clickUP();}else if(e.keyCode=='40'){clickDOWN();}else if(e.keyCode=='37'){clickDOWN();}else if(e.keyCode=='39'){clickUP();}}</script></body></html>)SimplePage";
+
+  // Entity tags for the pages (worked out once, in startServer())..
+  String rootTag, consoleTag, simpleTag;
+  // .. and whether the gzipped copies are of the pages we've got (see pageHash())
+  bool rootGz, consoleGz;
+
+  /*
+    Push (Server-Sent Events) clients. Each connected page keeps one request open at /events and
+    we write state changes and command output down it as they happen. No more polling.
+                                                                                  */
+  const uint8_t eventClientsMAX = 4;
+  WiFiClient eventClients[eventClientsMAX];
+
+  // What each page hasn't taken yet. We never wait on a page; whatever its socket won't take now
+  // waits here for the next pass. A page that gets this far behind is dropped (it reconnects)..
+  String eventBacklog[eventClientsMAX];
+  const uint16_t eventBacklogMAX = 8192;
+
+  // What we last told them, so we only push changes..
+  struct PushState {
+    char mode;
+    float_t frequency;
+    uint8_t pulse;
+    uint8_t bits;
+    uint8_t amplitude;
+    bool looping;
+  };
+  PushState pushedState;
+
+  /*
+    Messages waiting to go out, in order, numbered (the SSE "id"). Commands can come quicker than
+    we push (four times a second), so we keep the last few; if even those get overwritten, the
+    page sees the gap in the numbers..
+                                                                                    */
+  const uint8_t pushMessagesMAX = 8;
+  String pushMessages[pushMessagesMAX];
+  String queuedMessage = "";      // The last one we queued (LastMessage hangs about)
+  uint32_t pushMessageCount = 0;  // Messages queued, ever (the newest one's id)
+  uint32_t pushMessageSent = 0;   // .. and sent
+  uint32_t pushTime = 0;      // Last state/message push (millis())
+  uint32_t pingTime = 0;      // Last keep-alive
+
+  /*
+    Batch commands (see handleBatch()). One POST, lots of commands, one JSON answer. We hang onto
+    the client (like /events) and write each result down to it as its command finishes.
+                                                                                    */
+  WiFiClient batchClient;
+  struct BatchRun {
+    String lines;       // Commands still to run, one per line
+    String command;     // The one running now
+    uint16_t done;      // How many we've answered
+    bool open;          // We have a client waiting for answers
+    bool queued;        // Current command is waiting in the command queue
+    bool running;       // .. or it's being run (including the rest of its chain and any delays)
+    uint32_t started;   // When it started running (micros())
+  };
+  BatchRun batch;
+  const uint16_t batchMAX = 16384; // Biggest batch we'll take (bytes)
+
+  /*
+    Backups (see handleBackup()). Anything that Print()s can stream an export; this one sends it
+    down the web client in HTTP chunks, a buffer at a time, so the whole thing never sits in RAM.
+                                                                                    */
+  class ChunkedPrint : public Print {
+    public:
+      size_t write(uint8_t c) {
+        if (used == sizeof(buffer)) sendChunk();
+        buffer[used++] = c;
+        return 1;
+      }
+      size_t write(const uint8_t *data, size_t size) {
+        for (size_t i = 0; i < size; i++) write(data[i]);
+        return size;
+      }
+      void sendChunk() {
+        if (used) server.sendContent((const char *)buffer, used);
+        used = 0;
+      }
+    private:
+      uint8_t buffer[512];
+      size_t used = 0;
+  };
+
+  // Restores arrive in pieces (multipart upload); we put the lines back together here..
+  String restoreLine = "";
+  uint16_t restoreLines = 0;
+  uint16_t restoreFailed = 0;
+  uint16_t restoreTooLong = 0;  // Lines over serialLineMAX (not imported; counted in restoreFailed, too)
+  bool restoreOverflow = false; // The current one is
+
+  /*
+    Network Sync (see syncTask()). Every packet is one of these, in either direction. Timestamps are
+    esp_timer microseconds; the leader's, or the follower's own, depending..
+                                                                                    */
+  #include "lwip/sockets.h"
+
+  const uint16_t syncPort = 5150;
+  const uint8_t syncVersion = 2;
+  const uint32_t syncInterval = 500;    // ms between beacons (leader) and clock exchanges (follower)
+  const uint8_t syncSamples = 8;        // Clock exchanges kept; the one with the shortest round trip wins
+  const uint8_t syncFollowersMAX = 8;
+
+  enum SyncType : uint8_t { SYNC_BEACON = 1, SYNC_REQUEST, SYNC_REPLY, SYNC_EVENT, SYNC_REPORT };
+
+  struct __attribute__((packed)) SyncPacket {
+    char magic[2];        // "SG"
+    uint8_t version;
+    uint8_t type;         // SyncType
+    uint32_t epoch;       // Leader: a new one every startSync() (its seq starts again from 1)
+    uint32_t seq;         // Events: so repeats are only acted on once
+    int64_t t1;           // Request sent (follower time)
+    int64_t t2;           // Request received (leader time)
+    int64_t t3;           // Reply sent (leader time)
+    int64_t due;          // Event: when (leader time)
+    char op;              // Event: see TimedEvent
+    float_t value;
+    int64_t offset;       // Report: follower's clock offset (leader - follower, microseconds)..
+    uint32_t rtt;         // .. and the round trip it was measured with
+  };
+
+  struct SyncSample {
+    int64_t offset;
+    uint32_t rtt;
+  };
+
+  struct SyncFollower {
+    uint32_t ip;
+    int64_t offset;
+    uint32_t rtt;
+    uint32_t lastSeen;    // millis()
+  };
+
+  struct SyncState {
+    uint32_t leaderIP;            // Followers: where the beacons come from (0 == not found yet)..
+    uint32_t epoch;               // .. and which run of it (leader: our own, see startSync())
+    uint32_t leaderSeen;          // millis()
+    SyncSample samples[syncSamples];
+    uint8_t sampleCount;
+    uint8_t nextSample;
+    int64_t offset;               // Best estimate (leader - local)
+    uint32_t rtt;
+    uint32_t lastEvent;           // seq of the last event acted on
+    uint32_t eventsIn;
+    uint32_t eventsMissed;        // Arrived before we had a clock to put them on
+    uint32_t eventsOut;           // Leader: events sent
+    SyncFollower followers[syncFollowersMAX];
+  };
+  SyncState syncState;
+  portMUX_TYPE syncMux = portMUX_INITIALIZER_UNLOCKED;
+  TaskHandle_t syncTaskHandle = NULL;
+  volatile bool syncRunning = false;
+  QueueHandle_t syncOutbox = NULL;      // Events from loop() to the sync task
+
 #endif
 
 
 // Initialize Preferences Instance..
 Preferences prefs;
+int8_t prefsNamespace = -1; // Which one is open (0 = main/defaults, else preset number)
+
+/*
+  Settings Cache..
+
+  Every frequency step, pulse width change, pot twiddle and loop instruction used to go straight to
+  flash. Now they land here, in RAM, and get written out together once things have gone quiet for
+  commitInterval ms (or before a preset is saved/loaded/exported, or a reboot). A loop that steps
+  the frequency a thousand times writes it, at most, once, after it ends. Your flash thanks you.
+
+  Only the main (defaults) namespace is cached. Presets are written as they always were.
+                                                                                    */
+struct CachedSetting {
+  char key;
+  char type;        // 'f' = float, 'u' = unsigned char, 'c' = char
+  float_t value;    // (a float holds any char exactly)
+  bool dirty;
+};
+CachedSetting settingsCache[] = {
+  { 'm', 'c' }, { 'f', 'f' }, { 's', 'f' }, { 'p', 'u' },
+  { 'j', 'u' }, { 'a', 'u' }, { 'b', 'u' }, { 'h', 'c' }
+};
+const uint8_t cachedSettings = sizeof(settingsCache) / sizeof(CachedSetting);
+bool cacheDirty = false;
+uint32_t cacheTouched = 0;      // Last change (millis())
+uint32_t commitInterval = 2000; // ms of quiet before we write to flash (0 = right away)
+
+struct CacheStats {
+  uint32_t changes;   // Settings changed
+  uint32_t writes;    // Actual flash writes
+  uint32_t commits;   // Times we wrote
+};
+CacheStats cacheStats;
+
+/*
+  Preset Storage..
+
+  A preset's signal settings and name are stored together as one blob ("y") in the preset's own
+  namespace, with a version number and a checksum. Loops stay where they were ("o"); they can be
+  big. One read to recall a preset, one write to save it.
+
+  And a copy of every preset lives in RAM (presetCatalog), so listing them, showing their names on
+  the web page and checking whether they exist never touches flash at all.
+                                                                                    */
+const uint8_t presetVersion = 2;  // Bump this if you change PresetBlob (and convert the old ones)
+const uint8_t presetNameMAX = 39;
+
+// Which settings a preset has (layering only saves some of them)..
+enum PresetHas : uint16_t {
+  HAS_MODE = 1, HAS_FREQ = 2, HAS_STEP = 4, HAS_TOUCH = 8,
+  HAS_AMP = 16, HAS_BITS = 32, HAS_PULSE = 64, HAS_PSTEP = 128,
+  HAS_MOD = 256
+};
+
+struct PresetBlob {
+  uint8_t version;
+  uint16_t has;         // PresetHas bits
+  char mode;
+  char touchMode;
+  uint8_t amplitude;
+  uint8_t bits;
+  uint8_t pulse;
+  uint8_t pStep;
+  float_t frequency;
+  float_t fStep;
+  char modType;         // Modulation (see SGModulation)
+  uint8_t modDepth;
+  float_t modRate;
+  char name[presetNameMAX + 1];
+  uint16_t checksum;    // CRC-16 of all the above
+};
+
+// Version 1 blobs (before modulation), so we can still read them (and convert them)..
+struct PresetBlobV1 {
+  uint8_t version;
+  uint8_t has;
+  char mode;
+  char touchMode;
+  uint8_t amplitude;
+  uint8_t bits;
+  uint8_t pulse;
+  uint8_t pStep;
+  float_t frequency;
+  float_t fStep;
+  char name[presetNameMAX + 1];
+  uint16_t checksum;
+};
+
+struct CatalogEntry {
+  bool exists;
+  PresetBlob preset;
+};
+CatalogEntry presetCatalog[presetMAX + 1]; // [0] (defaults) isn't used; they're in the main namespace
+bool catalogReady = false;
 
 
 // For Rectangle Wave..
@@ -853,9 +1300,53 @@ uint16_t PWMSteps = 64;
 // This is automatically adjusted if resolution changes.
 // But Signal Generator will use *this* setting until then. *wink*
 
-
-// Buffer for creating the Triangle/Sawtooth function.
-uint_fast32_t tBuff[128];
+// Automatic resolution ("b auto"). Every time the square wave starts or changes frequency, we pick the
+// most bits that frequency allows, so the pulse width is as fine as it can be. Any manual change of
+// bit depth switches this off again..
+bool autoBits = false;
+
+// What the LEDC timer is running right now, so a pulse width change needn't touch it..
+uint32_t ledcLive = 0;      // What ledcSetup() returned (0 == not running, or it failed)
+float_t ledcLiveFreq = 0;
+uint8_t ledcLiveBits = 0;   // The planner's pick. Can be fewer than PWMResBits (what you asked for,
+                            // and what gets saved), at frequencies that can't have that many.
+
+
+// Buffer for creating the Triangle/Sawtooth function (32-bit I2S frames; two 16-bit channels).
+uint32_t tBuff[128];
+
+// The regular (non-DDS) triangle driver stays installed while it plays, with a DMA ring exactly the
+// size of tBuff (two buffers of 64 frames). Every period size we use (16..128 frames) divides that, so
+// the ring always holds whole periods and a new frequency is just a new sample rate (and a re-fill),
+// no driver reinstall, no DAC off/on. See triangleSetFrequency()..
+const uint16_t tRingFrames = sizeof(tBuff) / sizeof(tBuff[0]);
+bool triangleLive = false;  // Installed and playing (stopSignal() and ddsStart() clear this)
+
+// DDS state. The writer task reads these every block, so changes are picked up on-the-fly..
+volatile uint32_t ddsTuningWord = 0;  // Phase increment per sample
+volatile uint32_t ddsUpPoint = 0;     // Phase at which the rising edge ends (sawtooth angle)
+volatile uint32_t ddsSlopeUP = 0;     // Rise per unit of (24-bit) phase, Q32
+volatile uint32_t ddsSlopeDOWN = 0;   // Fall per unit of (24-bit) phase, Q32
+volatile uint8_t ddsAmplitude = 255;  // Peak (for sine/rectangle in Dual Channel mode)
+volatile bool ddsRunning = false;
+TaskHandle_t ddsTask = NULL;
+uint32_t ddsPhase = 0;                // Only ever touched by the writer task
+
+// Dual Channel state. loop() sets dualNext and the writer picks it up between blocks..
+SynthChannel dualNext[2];
+SynthChannel dualLive[2];             // Only ever touched by the writer task
+volatile bool dualChanged = false;    // dualNext has something new
+volatile bool dualResync = false;     // .. and the phases (offsets) should start again
+portMUX_TYPE dualMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Modulation on the DDS path (the writer task reads these every block)..
+volatile char ddsModType = 0;         // 0 == none
+volatile uint8_t ddsModDepth = 0;
+volatile uint32_t ddsModTuning = 0;   // Modulation rate, as a tuning word
+volatile uint8_t ddsModPulse = 50;    // The carrier's own pulse width (PWM swings around this)
+
+// Difference (Hz) between the requested and achieved triangle frequency (achieved - requested)..
+float_t triError = 0;
 
 // i2s port number.. (has to be 0 for DAC functions)
 static const i2s_port_t i2s_num = (i2s_port_t)0;
@@ -874,11 +1365,9 @@ bool recFailed = false;
 uint32_t touchTimer;
 
 
-// These are WebConsole commands which are created from clicks in the main web interface.
-String WebCommand = "";
-
 // We can chain commands with a delimiter (normally semicolon, ";").
-// These commands get queued, in here..
+// The rest of the chain we are working through waits in here (new commands wait in the command
+// queue, see queueCommand())..
 String QCommand = "";
 
 // This string is set with the output from commands. It is the console "output", like you would get
@@ -901,6 +1390,30 @@ const String _OUT_OF_RANGE_ = "Preset Number Out-Of-Range! (1-" + (String)preset
 uint16_t analogValue = 0;
 uint16_t analogValueOLD = analogValue;
 
+
+/*
+  Input Sampling..
+
+  Buttons, touch pads and the pot are read by their own little task (inputScan()), on the other
+  core, at a steady 200Hz, whatever loop() is up to. Buttons and touches must hold a new state for a
+  few scans before it counts (debounce), and the pot is oversampled and smoothed (EMA) and only
+  reported when it has moved more than a little (hysteresis). loop() just picks up the results.
+                                                                                  */
+const uint8_t inputScanMS = 5;          // 200 scans per second
+const uint8_t inputDebounce = 4;        // Scans a new button/touch state must hold (20ms)
+const uint8_t potOversample = 8;        // analogRead()s per scan
+const uint8_t potSmoothing = 3;         // EMA weight of each scan: 1/(2^3) (about 40ms to settle)
+
+struct InputState {
+  std::atomic<bool> pressed;            // A button was pressed (its command is already queued)
+  std::atomic<bool> touchUP;            // Debounced touches
+  std::atomic<bool> touchDOWN;
+  std::atomic<uint16_t> pot;            // Smoothed pot reading (0-4095)
+  std::atomic<bool> potMoved;           // .. which has moved since loop() last looked
+};
+InputState inputs;
+TaskHandle_t inputTask = NULL;
+
 // Loop settings..
 bool iLooping = false, eXiTmp; // iLooping is true when Signal Generator is playing a loop/macro.
 String loopCommands; // The currently loaded loop/macro commands.
@@ -909,6 +1422,7 @@ String loopCommands; // The currently loaded loop/macro commands.
 bool amDelaying = false;
 uint32_t delayTime = 500; // In case the first delay is blank
 uint32_t delayStart;
+uint32_t delayEnd = 0;    // When the last delay was /due/ to end (loops chain from here, no drift)
 // Not *too* important, but if you have *HUGE* delays in your loops, you /could/ prevent the ESP32
 // device from doing basic routine maintenance; so we use a simple non-blocking method.
 
@@ -921,8 +1435,8 @@ uint8_t myOctave = 4;
 struct button {
   uint8_t pin;
   String command;
-  uint8_t state;
-  uint8_t oldState;
+  uint8_t state;        // Debounced (see inputScan())
+  uint8_t changing;     // Scans a new state has held so far
 };
 
 struct SGButtons {
@@ -952,6 +1466,471 @@ const char *compile_time  = __TIMESTAMP__;
 // Experimental section:
 
 
+/*
+  Benchmark..
+
+  "bench" plays the currently-loaded loop/macro through the regular queue (QCommand) and times
+  every pass of the void, on the board. Delays (~) are skipped so we measure the commands, not the
+  waiting. It only sees QCommand (not serial or web input), and the heap can only tell us how many
+  blocks are held at the end compared to the start, not how many were allocated along the way. For
+  those, there's the host build (host/, "make run-bench"), which runs loop() on a PC.
+                                                                                              */
+struct SGBench {
+  bool running;
+  uint32_t target;      // Number of commands to process before we report
+  uint32_t commands;    // Commands processed so far
+  uint32_t passes;      // Passes of loop() (the void) so far
+  uint32_t startTime;   // micros()
+  uint32_t lastPass;    // micros() at the start of the previous pass
+  uint32_t passMax;     // Longest single pass (microseconds)
+  uint32_t heapStart;   // Free heap when we started
+  uint32_t blocksStart; // Allocated heap blocks when we started
+  uint32_t heapMin;     // Lowest free heap seen during the run
+};
+
+SGBench bench;
+
+
+/*
+  Frequency Planner..
+
+  One place that works out how each generator will actually produce a requested frequency; which
+  registers/driver settings to use, what frequency we'll really get, how far off that is (ppm) and
+  how fine the duty cycle can be. Solutions are kept in a small LRU cache, so sweeps, loops and
+  touch-stepping up and down over the same frequencies don't solve them again.
+                                                                                  */
+struct FreqPlan {
+  char mode;            // 's', 'r' or 't'
+  float_t target;       // What was asked for
+  float_t achieved;     // What we will actually get
+  float_t errorPPM;     // (achieved - target) in parts-per-million
+  uint8_t divider;      // Sine: RTC CK8M divider (0-7)
+  uint16_t step;        // Sine: SENS_SW_FSTEP
+  uint32_t rate;        // Triangle: I2S sample rate
+  uint8_t buffLen;      // Triangle: DMA buffer length (half a period)
+  uint32_t tuningWord;  // Triangle (DDS): phase increment per sample
+  uint8_t resBits;      // Square: resolution bit depth used
+  uint8_t bestBits;     // Square: highest resolution bit depth this frequency allows
+  uint32_t dutySteps;   // Number of distinct duty cycle steps available
+  float_t dutyAchieved; // The duty cycle (%) we will actually get
+  uint32_t variant;     // Cache: whatever else the solution depends on (sine factor, resolution, DDS)
+  uint32_t used;        // Cache: LRU stamp (0 == empty slot)
+};
+
+const uint8_t planCacheSize = 8;
+FreqPlan planCache[planCacheSize];
+uint32_t planClock = 0;   // Ticks on every lookup; the smallest "used" is the least-recently used.
+uint32_t planHits = 0, planMisses = 0;
+
+
+/*
+  Compiled Loops/Macros..
+
+  When you save or load a loop, its commands are compiled /once/ into this wee instruction array
+  (opcode + number), and a small interpreter steps through it, one instruction per pass of the void,
+  however many times you play it. No more
+  chopping up Strings on every command of every pass. Anything the compiler doesn't have an opcode
+  for is kept as text (LOOP_TEXT) and handed to the regular command path, exactly as before.
+                                                                                          */
+enum LoopOp : uint8_t {
+  LOOP_TEXT,      // Anything else: arg is an offset into loopText
+  LOOP_FREQ,      // value = frequency (Hz)
+  LOOP_FREQ_ADD,  // value = Hz to add (may be negative)
+  LOOP_PULSE,     // value = pulse width (%)
+  LOOP_PULSE_ADD, // value = % to add (may be negative)
+  LOOP_MODE,      // arg = 'r', 's' or 't'
+  LOOP_AMP,       // value = amplitude level (1-4)
+  LOOP_BITS,      // value = resolution bit depth
+  LOOP_DELAY,     // value = milliseconds (0 == same as last time)
+  LOOP_REPEAT,    // value = count, arg = index of the matching LOOP_NEXT
+  LOOP_NEXT,      // arg = index of the matching LOOP_REPEAT
+  LOOP_END        // End the loop
+};
+
+struct LoopInstruction {
+  LoopOp op;
+  uint16_t arg;
+  float_t value;
+};
+
+const uint16_t loopProgramMAX = 256;
+LoopInstruction loopProgram[loopProgramMAX];
+uint16_t loopLength = 0;  // Number of instructions in the compiled loop
+uint16_t loopPC = 0;      // The next instruction to run
+String loopSource = "";   // What loopProgram[] was compiled from (see setLoop())..
+bool loopCompiled = false; // .. and whether it all fit
+
+// LOOP_TEXT commands live in here, each null-terminated..
+char loopText[4096];
+uint16_t loopTextLength = 0;
+
+// Repeat blocks can be nested (a wee bit)..
+const uint8_t loopDepthMAX = 4;
+struct LoopCounter {
+  uint16_t start;     // First instruction inside the block
+  uint32_t remaining; // Passes left
+};
+LoopCounter loopStack[loopDepthMAX];
+uint8_t loopDepth = 0;
+
+// Total instructions executed (for the benchmark)..
+uint32_t loopInstructions = 0;
+
+
+/*
+  The Command Queue..
+
+  Everything that wants a command run (serial, web, buttons, ...) puts it in here, along with where
+  it came from, and loop() takes them out, in order, one at a time. Nobody overwrites anybody.
+
+  It's a fixed ring of slots, each with a sequence number that says whose turn it is (this is
+  Dmitry Vyukov's bounded queue). Any task can add commands without locks; only loop() takes them
+  out. When it's full, it's full; the web gets a 503 (try again), serial waits in the UART buffer
+  and anything else is dropped, and counted (see "queue").
+                                                                                        */
+enum CommandSource : uint8_t {
+  FROM_SERIAL,
+  FROM_WEB,       // Main page controls
+  FROM_CONSOLE,   // Web console and /URL commands
+  FROM_BUTTON,
+  FROM_BOOT,      // Commands queued before a reboot
+  FROM_BATCH,     // POST /batch
+  commandSources  // How many sources there are
+};
+const char *sourceNames[commandSources] = { "Serial", "Web", "Console", "Buttons", "Boot", "Batch" };
+
+struct QueuedCommand {
+  std::atomic<uint32_t> sequence;
+  CommandSource source;
+  String text;
+};
+
+const uint8_t commandQueueSize = 16; // Must be a power of two
+QueuedCommand commandQueue[commandQueueSize];
+std::atomic<uint32_t> queueHead(0);  // Next slot to fill
+std::atomic<uint32_t> queueTail(0);  // Next slot to run
+
+// Counted from every task that queues commands, like the queue itself, without a lock..
+struct QueueStats {
+  std::atomic<uint32_t> queued[commandSources];
+  std::atomic<uint32_t> dropped[commandSources];
+  std::atomic<uint8_t> highWater;         // Most commands ever waiting at once
+  std::atomic<uint32_t> serialOverflows;  // Serial lines too long to keep
+};
+QueueStats queueStats;
+
+// Serial bytes are put together into lines in here, as they arrive (see serialIngest())..
+String serialLine = "";
+const uint16_t serialLineMAX = 8192;
+bool serialOverflow = false;
+
+// A compact preset line (see exportCompact()) starts with this. Nothing else does; "~" was a delay.
+const char compactMark = '$';
+
+
+/*
+  Binary Serial Mode..
+
+  For test equipment. Send "binary" and the serial port stops talking text and takes frames
+  instead; no parsing, no settings dump, just a short answer with the frequency you actually got.
+
+  Host -> Generator:  A5 <len> <op> <payload..> <crc lo> <crc hi>
+  Generator -> Host:  5A <len> <op|80> <status> <frequency (float)> <mode> <pulse> <bits> <amp> <crc lo> <crc hi>
+
+  <len> counts the op and payload. The CRC is CRC-16/CCITT-FALSE (0x1021, start 0xFFFF) over
+  <len> through the end of the payload. Numbers are little-endian, frequency is a 32-bit float.
+                                                                                    */
+enum BinaryOp : uint8_t {
+  BIN_FREQUENCY = 0x01,   // float_t Hz
+  BIN_MODE      = 0x02,   // char 'r', 's' or 't'
+  BIN_PULSE     = 0x03,   // uint8_t 0-100
+  BIN_AMPLITUDE = 0x04,   // uint8_t 1-4
+  BIN_LOAD      = 0x05,   // uint8_t preset number
+  BIN_SAVE      = 0x06,   // uint8_t preset number
+  BIN_STATUS    = 0x07,   // (no payload)
+  BIN_TEXT      = 0x7F    // Back to the text console
+};
+
+enum BinaryStatus : uint8_t {
+  BIN_OK,
+  BIN_LIMITED,      // Frequency was clamped to the limits
+  BIN_BAD_VALUE,
+  BIN_BAD_CRC,
+  BIN_BAD_OP,
+  BIN_NO_PRESET,
+  BIN_SAVE_FAILED   // NVS didn't take it (full?)
+};
+
+const uint8_t binarySync = 0xA5, binaryReplySync = 0x5A;
+const uint8_t binaryFrameMAX = 32;
+const uint16_t binaryTimeout = 100; // ms, between bytes of a frame, before we give up on it
+
+bool binaryMode = false;
+bool binaryXi = false;              // Extended info (eXi) from before binary mode (it's off in there,
+                                    // as is anything else the console would say)
+uint8_t binaryFrame[binaryFrameMAX + 4];  // Sync + length + <length> bytes + two of CRC
+uint8_t binaryFill = 0;
+uint32_t binaryByteTime = 0;
+
+struct BinaryStats {
+  uint32_t frames;
+  uint32_t crcErrors;
+  uint32_t discarded;   // Bytes thrown away looking for the start of a frame
+  uint32_t timeouts;    // Frames that stopped halfway
+  uint64_t busy;        // Microseconds spent acting on frames
+  uint32_t started;     // millis() when binary mode began
+};
+BinaryStats binaryStats;
+portMUX_TYPE binaryMux = portMUX_INITIALIZER_UNLOCKED; // binaryStats are counted in loop(), but read
+                                                       // (and reset) wherever a command comes from
+
+
+/*
+  Timed Events..
+
+  The ~ delay is only as good as the slowest pass of the void; a web request or an NVS write in the
+  same pass and your delay is late. Timed events don't care what loop() is up to. Each event has
+  an absolute due time (in microseconds, from esp_timer) and a hardware timer wakes a high-priority
+  task at exactly that time, which applies the change. How late each one /actually/ was gets
+  recorded, so you can see how good (or bad) your timing is.
+                                                                                        */
+struct TimedEvent {
+  int64_t due;    // esp_timer_get_time() microseconds
+  char op;        // 'f' frequency, 'p' pulse width, 'm' mode, 'g' go (restart)
+  float_t value;  // Hz, %, or the mode char
+};
+
+const uint8_t eventsMAX = 32;
+TimedEvent events[eventsMAX]; // Sorted by due time, soonest first
+uint8_t eventCount = 0;
+int64_t eventEpoch = 0;       // "at0" happens here
+portMUX_TYPE eventMux = portMUX_INITIALIZER_UNLOCKED;
+esp_timer_handle_t eventTimer = NULL;
+TaskHandle_t eventTask = NULL;
+
+// Lateness statistics (microseconds)..
+struct EventStats {
+  uint32_t fired;
+  uint32_t dropped;     // Queue was full
+  int64_t lateMin;
+  int64_t lateMax;
+  int64_t lateTotal;
+  uint32_t over1ms;     // Events more than 1ms late
+};
+EventStats eventStats;        // Guarded by eventMux, like the queue itself
+
+/*
+  The signal lock..
+
+  With timed events, the signal (mode, frequency, pulse width, and the hardware behind them) can be
+  changed from the event worker as well as loop(), at any moment. Whoever is changing it holds this,
+  so an event never lands in the middle of a command's startSignal() (or the other way round). It's
+  recursive; a startSignal() inside a command inside a loop is all the one holder. Created first
+  thing in setup()..
+
+  Hold it only while changing things. A report (or a kernel benchmark) that holds it makes every
+  timed event wait for it; SignalLock hold(false) doesn't take it at all.
+                                                                                        */
+SemaphoreHandle_t signalLock = NULL;
+
+class SignalLock {
+  public:
+    SignalLock(bool take = true) : held(take && signalLock) {
+      if (held) xSemaphoreTakeRecursive(signalLock, portMAX_DELAY);
+    }
+    ~SignalLock() { if (held) xSemaphoreGiveRecursive(signalLock); }
+  private:
+    bool held;
+};
+
+
+/*
+  Sweeps..
+
+  A sweep moves the frequency from start to stop over a set time, from a periodic esp_timer. The
+  timer works out each step and the step worker (see stepWorker()) puts it straight on the hardware
+  (cosine generator registers, LEDC divider, DDS tuning word or I2S sample rate), skipping the
+  command parser and startSignal() altogether.
+                                                                                  */
+struct SGSweep {
+  bool running;
+  bool logSweep;        // Logarithmic (true) or linear
+  bool repeat;          // Start again at the end (true) or stop there
+  char mode;            // Mode the sweep was started in
+  float_t startFreq;
+  float_t stopFreq;
+  uint32_t duration;    // Milliseconds (1 to sweepTimeMAX)
+  uint32_t interval;    // Microseconds between updates
+  uint8_t buffLen;      // Regular triangle mode; the buffer stays the same size throughout
+  int64_t startTime;    // esp_timer_get_time() at the start of the current pass
+  int64_t firstTime;    // .. and of the whole sweep (for the update rate)
+  int64_t lastUpdate;
+  uint32_t updates;
+  uint32_t failed;      // Updates the hardware refused
+  uint32_t updateMax;   // Longest update (microseconds)
+  uint32_t gapMax;      // Longest time between updates (microseconds)
+};
+SGSweep sweep;
+esp_timer_handle_t sweepTimer = NULL;
+const uint32_t sweepTimeMAX = 86400000; // A day (ms) is plenty
+
+// Steps waiting for the step worker (stepMux covers these, sweep.running, modRunning and
+// songPlayer.playing)..
+TaskHandle_t stepTask = NULL;
+portMUX_TYPE stepMux = portMUX_INITIALIZER_UNLOCKED;
+float_t sweepNext;
+bool sweepPending = false;
+float_t modNext;              // Frequency (FM) or pulse width (PWM)..
+bool modPending = false;
+bool modRunning = false;
+// Song notes wait in a little queue, oldest first; unlike a sweep step, every one of them gets
+// played (a rest or the end is as important as any note)..
+const uint8_t songQueueMAX = 8;
+uint8_t songQueued[songQueueMAX]; // Pitch, songRest or songEnd
+uint8_t songQueueFirst = 0;
+uint8_t songQueueCount = 0;
+
+// Modulation on the timer path (rectangle and sine modes)..
+struct SGModTimer {
+  char mode;            // Mode it was started in
+  char type;            // (copies; the command can change the originals at any time)
+  uint8_t depth;
+  float_t baseFreq;     // The carrier's own frequency..
+  uint8_t basePulse;    // .. and pulse width
+  uint32_t phase;       // LFO phase (one cycle == 2^32)
+  uint32_t step;        // .. per update
+  uint32_t failed;      // Steps the hardware refused..
+  int64_t failedLogged; // .. and when we last said so (once a second, at most)
+};
+SGModTimer modTimerState;
+esp_timer_handle_t modTimer = NULL;
+const uint32_t modInterval = 1000;    // Microseconds between updates
+
+// The pulse train's RMT channel. It gets all eight memory blocks (512 items), as nothing else uses the RMT..
+const rmt_channel_t trainChannel = RMT_CHANNEL_0;
+const uint8_t trainBlocks = pulseBlocks;
+const size_t trainLoopMAX = pulseLoopMAX;   // (see Pulse.h)
+const size_t trainItemsMAX = pulseItemsMAX;
+uint32_t *trainItems = NULL;
+size_t trainItemCount = 0;
+uint32_t trainTickUs = 1;   // 1us (APB) or 100us (REF_TICK, for trains too long for 1us ticks)
+bool trainLoop = false;
+bool trainRunning = false;
+
+
+/*
+  Songs..
+
+  A song is compiled (once) from text into a wee binary list of notes, stored in NVS as a blob,
+  and played by a timer; no String comparisons, no ~ waits, no parsing between notes.
+                                                                                    */
+struct SongNote {
+  uint8_t pitch;  // (octave << 4) | note (0-11, same order as note_t). songRest == silence.
+  uint8_t ticks;  // Length in 1/16ths of a whole note (quarter note = 4)
+};
+
+struct SongHeader {
+  uint8_t version;
+  uint8_t length;  // Number of notes
+  uint16_t tempo;  // Quarter notes per minute
+};
+
+const uint8_t songRest = 0xFF;
+const uint8_t songEnd = 0xFE;   // (Never a note; the step worker's cue to unmute)
+const uint8_t songVersion = 1;
+const uint8_t songMAX = 255;
+SongHeader songHead = { songVersion, 0, 120 };
+SongNote song[songMAX];
+
+struct SongPlayer {
+  bool playing;
+  bool repeat;
+  char mode;            // Mode the song was started in
+  uint8_t buffLen;      // Regular triangle mode (see fastSetFrequency())
+  uint8_t position;     // Next note to play
+  int64_t due;          // When the next note is due (esp_timer_get_time() microseconds)
+  bool muted;           // In a rest (see songMute())
+  uint32_t mutedWord;   // DDS tuning word from before the rest
+  uint32_t notes;       // Notes played so far
+  uint32_t lateMax;     // Latest note (microseconds)
+  uint32_t dropped;     // Notes the queue had no room for (the worker was held up that long)
+};
+SongPlayer songPlayer;
+esp_timer_handle_t songTimer = NULL;
+
+
+/*
+  Performance Metrics..
+
+  Where does the time go? Every pass of the void, and the main jobs inside it, are timed with the
+  CPU's cycle counter (cheap; a register read) and dropped into a histogram of power-of-two buckets
+  (<1us, <2us, <4us .. <262ms, and everything slower). Phases can nest (a command calls startSignal()
+  which sets the frequency and so on), so they don't add up to the loop time; they're not meant to.
+  See "stats" and /metrics.
+                                                                                  */
+enum MetricPhase : uint8_t {
+  PHASE_LOOP,         // A whole pass of the void
+  PHASE_BUTTONS,      // Button scan (input task)
+  PHASE_TOUCH,        // Touch scan (input task)
+  PHASE_POT,          // Potentiometer sampling (input task)
+  PHASE_COMMAND,      // Parse and run a command
+  PHASE_START,        // startSignal()
+  PHASE_SET_FREQ,     // The per-mode *SetFrequency() functions
+  PHASE_NVS,          // Settings and preset writes to flash
+  PHASE_WEB,          // server.handleClient()
+  PHASE_RETUNE,       // In-place triangle retune (new rate + re-fill, driver stays put)
+  metricPhases
+};
+const char *phaseNames[metricPhases] = { "loop", "buttons", "touch", "pot", "command", "start_signal", \
+                                                                      "set_frequency", "nvs", "web", "retune" };
+
+const uint8_t metricBuckets = 20;
+struct PhaseMetrics {
+  uint32_t count;
+  uint64_t cycles;                  // Total
+  uint32_t maxCycles;
+  uint32_t buckets[metricBuckets];  // Bucket n: under 2^n microseconds (the last catches the rest)
+};
+PhaseMetrics metrics[metricPhases];
+portMUX_TYPE metricsMux = portMUX_INITIALIZER_UNLOCKED; // Timings come in from loop(), the input task,
+                                                        // the workers and the timers, on both cores
+uint32_t cyclesPerMicro = 240;      // CPU MHz (set in setup())
+uint32_t blockLow = UINT32_MAX;     // Smallest "largest free block" we've seen (fragmentation)
+uint32_t heapSampled = 0;           // When we last looked (millis(); it's a slow-ish walk of the heap)
+uint32_t metricsSince = 0;          // millis() at the last reset (for the loop() rate)
+
+// Record one timing..
+void recordPhase(MetricPhase phase, uint32_t cycles) {
+  PhaseMetrics &m = metrics[phase];
+  uint32_t us = cycles / cyclesPerMicro;
+  uint8_t bucket = (us == 0) ? 0 : 32 - __builtin_clz(us);
+  if (bucket >= metricBuckets) bucket = metricBuckets - 1;
+  portENTER_CRITICAL(&metricsMux);
+  m.buckets[bucket]++;
+  m.count++;
+  m.cycles += cycles;
+  if (cycles > m.maxCycles) m.maxCycles = cycles;
+  portEXIT_CRITICAL(&metricsMux);
+}
+
+// A copy of one phase's timings, all from the same moment (cycles is 64-bit; it can't tear)..
+PhaseMetrics phaseMetrics(uint8_t phase) {
+  portENTER_CRITICAL(&metricsMux);
+  PhaseMetrics m = metrics[phase];
+  portEXIT_CRITICAL(&metricsMux);
+  return m;
+}
+
+// Time a block. It's recorded when the timer goes out of scope, so every return is covered..
+class PhaseTimer {
+  public:
+    PhaseTimer(MetricPhase p) : phase(p), start(ESP.getCycleCount()) {}
+    ~PhaseTimer() { recordPhase(phase, ESP.getCycleCount() - start); }
+  private:
+    MetricPhase phase;
+    uint32_t start;
+};
+
 
 
 
@@ -1002,6 +1981,9 @@ i2s_driver_config_t i2s_config = {
                               */
 void startSignal(String from, bool doReport = false) {
 
+  PhaseTimer timer(PHASE_START);
+  SignalLock hold;  // (Everyone should have it already; this makes sure)
+
   // For tracking down hardware quirks when I thought they were bugs. I left it in as it's handy.
   // This lets us know where the signal was started /from/..
   if (eXi && doReport) \
@@ -1011,13 +1993,18 @@ void startSignal(String from, bool doReport = false) {
   frequency = abs(frequency);
 
   recFailed = false;
+  stopModulation(); // It starts again (around the new settings) below
+  stopTrain();      // The pin is ours again
 
   switch (mode) {
 
     case 't' :
       mode = 't';
-      stopSignal(); // Triangle always needs this
-      startTriangle();
+      // Already playing (the same flavour)? Then this is just a retune, in place, no restart..
+      if (oldMode != 't' || !((useDDS && ddsRunning) || (!useDDS && triangleLive))) {
+        stopSignal();
+        startTriangle();
+      }
       // This is always (the same as) what was sent (until that bug in i2s_driver_install is fixed)
       frequency = triangleSetFrequency(frequency, pulse);
 
@@ -1026,8 +2013,9 @@ void startSignal(String from, bool doReport = false) {
     case 'r' :
       mode = 'r';
       if (oldMode != 'r') stopSignal();
-      freq = startRectangle();
-      rectangleSetFrequency(frequency, pulse);
+      // Already running? Then we only touch what changed (see rectangleSetFrequency())..
+      if (oldMode != 'r' || ledcLive == 0) startRectangle();
+      freq = rectangleSetFrequency(frequency, pulse);
       if (freq == 0) recFailed = true;
     break;
 
@@ -1040,6 +2028,7 @@ void startSignal(String from, bool doReport = false) {
   }
 
   oldMode = mode;
+  startModulation();
 }
 
 
@@ -1048,8 +2037,12 @@ void startSignal(String from, bool doReport = false) {
                 */
 void stopSignal() {
 
+  stopModulation();
+  stopTrain();
   switch (oldMode) {
     case 't' :
+      ddsStop(); // If it's running.
+      triangleLive = false;
       if (INi2S == ESP_OK) {
         i2s_driver_uninstall(i2s_num);
         INi2S = -1;
@@ -1068,73 +2061,279 @@ void stopSignal() {
 
 
 
-// Wrappers for setting char-based prefs..
-
-void setMode(char myMode, bool doSave = true) {
-  if (myMode == 'r' || myMode == 't' || myMode == 's') {
-    mode = myMode;
-    if (doSave) prefs.putChar("m", myMode);
+/*
+  Remember a (main) setting. It goes to flash later (see commitSettings())..
+                                                                          */
+void cacheSetting(char key, float_t value) {
+  for (uint8_t i = 0; i < cachedSettings; i++) {
+    if (settingsCache[i].key == key) {
+      settingsCache[i].value = value;
+      settingsCache[i].dirty = true;
+      break;
+    }
   }
+  cacheStats.changes++;
+  cacheDirty = true;
+  cacheTouched = millis();
 }
 
-void setTouchMode(char myMode, bool doSave = true) {
-  switch (myMode) {
-    case 'p' :
-    case 'd' : // duty cycle
-      touchMode = 'p';
-      break;
-    case 'b' :
-    case 'r' : // resolution
-      touchMode = 'b';
-      break;
-    default:
-      touchMode = 'f';
+
+// Write any changed settings to flash. Only ever into the main namespace..
+void commitSettings() {
+  if (!cacheDirty || prefsNamespace != 0) return;
+  PhaseTimer timer(PHASE_NVS);
+  for (uint8_t i = 0; i < cachedSettings; i++) {
+    if (!settingsCache[i].dirty) continue;
+    char key[2] = { settingsCache[i].key, 0 };
+    switch (settingsCache[i].type) {
+      case 'f' : prefs.putFloat(key, settingsCache[i].value); break;
+      case 'u' : prefs.putUChar(key, (uint8_t)settingsCache[i].value); break;
+      case 'c' : prefs.putChar(key, (char)settingsCache[i].value); break;
+    }
+    settingsCache[i].dirty = false;
+    cacheStats.writes++;
   }
-  if (doSave) (prefs.putChar("h", touchMode));
+  cacheStats.commits++;
+  cacheDirty = false;
 }
 
 
-/*
+// Forget any changes (we're about to wipe them, anyway)..
+void discardSettings() {
+  for (uint8_t i = 0; i < cachedSettings; i++) settingsCache[i].dirty = false;
+  cacheDirty = false;
+}
 
-  Switch back-and-forth between default and specified preset's settings.
 
-  If a preset does not exist, return false, otherwise return true.
-  Whatever happens, we still switch.
+// Called every pass of the void. Nothing gets written while a loop, sweep or song is playing..
+void settingsIdle() {
+  if (!cacheDirty || iLooping || sweep.running || songPlayer.playing) return;
+  if (millis() - cacheTouched >= commitInterval) commitSettings();
+}
 
-  This is used a /lot/.
 
-  Call with *no* parameters to start the /main/ (default) prefs.
+/*
+  Settings cache statistics..
 
-  NOTE to Arduino IDE Devs:
+  usage: cache[<ms>]
+                    */
+String cacheReport() {
+  char cbuf[256];
+  uint8_t waiting = 0;
+  for (uint8_t i = 0; i < cachedSettings; i++) if (settingsCache[i].dirty) waiting++;
+  sprintf(cbuf, "\n Settings Cache: write after %ums quiet\n\n\tChanges:\t%u\n\tFlash Writes:\t%u (in %u commits)\n" \
+                "\tWrites Saved:\t%u\n\tWaiting:\t%u\n", commitInterval, cacheStats.changes, cacheStats.writes, \
+                cacheStats.commits, cacheStats.changes - cacheStats.writes - waiting, waiting);
+  return (String)cbuf;
+}
 
-    It's specifying default values for variables fed to functions which messes with the prototype
-    generator. i.e. this..
 
-                                 */
-bool prefsSwitch(int8_t preset = 0) {
+/*
+  Performance metrics (see PhaseMetrics), for humans..
 
-  String lPreset = "sg";
+  Average and worst times for each phase, with the middle (p50) and p99 of each histogram (these
+  are bucket tops, so "under" that many microseconds), plus memory and where commands came from.
 
-  // First, end the current prefs instance, whatever it is..
-  prefs.end();
+  usage: stats[ reset]
+                      */
+String statsReport() {
 
-  // If the new namespace is to be a preset, set a name for this preset's namespace..
-  // ("sg" with preset number appended, e.g. "sg3")
-  if (preset != 0) lPreset += (String)preset;
+  char sbuf[2048];
+  uint32_t upTime = millis() / 1000;
+  sprintf(sbuf, "\n Performance (up %uh %02um %02us, CPU %uMHz)..\n\n\tPhase\t\tCount\t\tAvg us\tMax us\tp50 <\tp99 <\n", \
+                                        upTime / 3600, (upTime / 60) % 60, upTime % 60, cyclesPerMicro);
 
-  // Start the new prefs instance..
-  prefs.begin(lPreset.c_str());
+  for (uint8_t i = 0; i < metricPhases; i++) {
+    PhaseMetrics m = phaseMetrics(i);
+    if (m.count == 0) {
+      sprintf(sbuf + strlen(sbuf), "\t%-14s\t-\n", phaseNames[i]);
+      continue;
+    }
+    sprintf(sbuf + strlen(sbuf), "\t%-14s\t%-10u\t%.1f\t%u\t%s\t%s\n", phaseNames[i], m.count, \
+                          m.cycles / (float_t)m.count / cyclesPerMicro, m.maxCycles / cyclesPerMicro, \
+                          metricPercentile(m, 50).c_str(), metricPercentile(m, 99).c_str());
+  }
 
-  // Check if this preset exists and return that status as a boolean..
-  if (prefs.getChar("i", -1) == -1) return false;
+  sprintf(sbuf + strlen(sbuf), "\n\tFree Heap:\t%u bytes (lowest: %u)\n\tLargest Block:\t%u bytes (lowest: %u)\n", \
+                            ESP.getFreeHeap(), ESP.getMinFreeHeap(), ESP.getMaxAllocHeap(), \
+                            (blockLow == UINT32_MAX) ? ESP.getMaxAllocHeap() : blockLow);
 
-  // It exists!
-  return true;
+  sprintf(sbuf + strlen(sbuf), "\n\tCommands:\t");
+  for (uint8_t i = 0; i < commandSources; i++) sprintf(sbuf + strlen(sbuf), "%s: %u  ", sourceNames[i], queueStats.queued[i].load());
+  sprintf(sbuf + strlen(sbuf), "\n\n");
+  return (String)sbuf;
 }
 
 
+// Top of the bucket where the given percentage of timings are in (or "-" for the slowest bucket)..
+String metricPercentile(const PhaseMetrics &m, uint8_t percent) {
+  uint32_t wanted = ((uint64_t)m.count * percent + 99) / 100;
+  uint32_t seen = 0;
+  for (uint8_t b = 0; b < metricBuckets - 1; b++) {
+    seen += m.buckets[b];
+    if (seen >= wanted) return (String)(1UL << b);
+  }
+  return "slow";
+}
+
+
+// Start again..
+void resetMetrics() {
+  portENTER_CRITICAL(&metricsMux);
+  memset(metrics, 0, sizeof(metrics));
+  portEXIT_CRITICAL(&metricsMux);
+  blockLow = UINT32_MAX;
+  metricsSince = millis();
+}
+
+
+// The linker's idea of our static RAM (initialised data, then zeroed)..
+extern "C" char _data_start, _data_end, _bss_start, _bss_end;
+
+/*
+  What was built (see "Build Features"), how big it is and how fast loop() goes round, so you can
+  compare configurations. "build" (send "stats reset" first, to time loop() from now on)..
+                                                                              */
+String buildReport() {
+
+  char bbuf[512];
+  String built = "", gone = "";
+  const bool features[] = { haveRemote, haveSoftAP, haveButtons, haveTouch, havePot, haveVerbose };
+  const char *names[] = { "remote", "soft AP", "buttons", "touch", "pot", "verbose" };
+  for (uint8_t i = 0; i < sizeof(features); i++) {
+    String &list = (features[i]) ? built : gone;
+    if (list != "") list += ", ";
+    list += names[i];
+  }
+
+  uint32_t staticRAM = (&_data_end - &_data_start) + (&_bss_end - &_bss_start);
+  uint32_t elapsed = millis() - metricsSince;
+  PhaseMetrics m = phaseMetrics(PHASE_LOOP);
+
+  sprintf(bbuf, "\n Build: v%s (%s %s)\n\n", version.c_str(), __DATE__, __TIME__);
+  sprintf(bbuf + strlen(bbuf), "\tBuilt in:\t%s\n", (built == "") ? "nothing optional" : built.c_str());
+  sprintf(bbuf + strlen(bbuf), "\tLeft out:\t%s\n", (gone == "") ? "nothing" : gone.c_str());
+  sprintf(bbuf + strlen(bbuf), "\tFlash:\t\t%u bytes (of %u for the sketch)\n", \
+                                                ESP.getSketchSize(), ESP.getSketchSize() + ESP.getFreeSketchSpace());
+  sprintf(bbuf + strlen(bbuf), "\tStatic RAM:\t%u bytes (data + bss)\n", staticRAM);
+  sprintf(bbuf + strlen(bbuf), "\tHeap:\t\t%u bytes free (of %u)\n", ESP.getFreeHeap(), ESP.getHeapSize());
+  if (elapsed > 0 && m.count > 0) {
+    sprintf(bbuf + strlen(bbuf), "\tloop():\t\t%.0f passes per second (average %.2fus)\n", \
+                        m.count * 1000.0 / elapsed, (double)m.cycles / m.count / cyclesPerMicro);
+  }
+  return (String)bbuf;
+}
+
+
+/*
+  Benchmark the waveform kernels (see Synth.h) against the reference generator, and check them
+  against it while we're at it. "kernels" (or kernels* for * samples each, default 100000, most
+  kernelsMAX).
+
+  This stops the loop for a moment (a second or so at the default), but not the signal. The
+  reference is floating point, so it's the slow half; at kernelsMAX that's a good while, which is
+  why there's a limit (the web server and everything else waits for it).
+                                                                            */
+const uint32_t kernelsMAX = 1000000;
+
+String kernelsReport(String samplesData) {
+
+  samplesData.trim();
+  uint32_t samples = (samplesData != "") ? samplesData.toInt() : 100000;
+  if (samples < synthBenchBlock) samples = synthBenchBlock;
+  if (samples > kernelsMAX) samples = kernelsMAX;
+
+  SynthBenchResult results[synthBenchKernels];
+  uint8_t failed = synthBenchmark(results, micros, samples);
+
+  char kbuf[1536];
+  sprintf(kbuf, "\n Waveform Kernels (%u samples each, %uMHz):\n\n", samples, getCpuFrequencyMhz());
+  sprintf(kbuf + strlen(kbuf), "\tWave\tLevel\tCheck\tKernel (S/s)\tReference (S/s)\tSpeed-up\n");
+  for (uint8_t i = 0; i < synthBenchKernels; i++) {
+    SynthBenchResult &r = results[i];
+    sprintf(kbuf + strlen(kbuf), "\t%c\t%u\t%s\t%.0f\t%.0f\t%.2fx\n", r.wave, r.amplitude, \
+                (r.matches) ? "OK" : "FAIL", r.kernelRate, r.referenceRate, \
+                (r.referenceRate) ? r.kernelRate / r.referenceRate : 0);
+  }
+  sprintf(kbuf + strlen(kbuf), "\n\t%s\n", (failed) ? "Some kernels DON'T match the reference!" : \
+                                                              "All kernels match the reference.");
+  sprintf(kbuf + strlen(kbuf), "\t(DDS needs %u samples/second per channel.)\n", ddsSampleRate);
+  return (String)kbuf;
+}
+
+
+// Wrappers for setting char-based prefs..
+
+void setMode(char myMode, bool doSave = true) {
+  if (myMode == 'r' || myMode == 't' || myMode == 's') {
+    mode = myMode;
+    if (doSave) cacheSetting('m', myMode);
+  }
+}
+
+void setTouchMode(char myMode, bool doSave = true) {
+  switch (myMode) {
+    case 'p' :
+    case 'd' : // duty cycle
+      touchMode = 'p';
+      break;
+    case 'b' :
+    case 'r' : // resolution
+      touchMode = 'b';
+      break;
+    default:
+      touchMode = 'f';
+  }
+  if (doSave) cacheSetting('h', touchMode);
+}
+
+
+/*
+
+  Switch back-and-forth between default and specified preset's settings.
+
+  If a preset does not exist, return false, otherwise return true.
+  Whatever happens, we still switch.
+
+  This is used a /lot/.
+
+  Call with *no* parameters to start the /main/ (default) prefs.
+
+  NOTE to Arduino IDE Devs:
+
+    It's specifying default values for variables fed to functions which messes with the prototype
+    generator. i.e. this..
+
+                                 */
+bool prefsSwitch(int8_t preset = 0) {
+
+  String lPreset = "sg";
+
+  // Write out any cached settings while we're still in the main namespace..
+  commitSettings();
+
+  // First, end the current prefs instance, whatever it is..
+  prefs.end();
+
+  // If the new namespace is to be a preset, set a name for this preset's namespace..
+  // ("sg" with preset number appended, e.g. "sg3")
+  if (preset != 0) lPreset += (String)preset;
+
+  // Start the new prefs instance..
+  prefs.begin(lPreset.c_str());
+  prefsNamespace = preset;
+
+  // Check if this preset exists and return that status as a boolean..
+  if (catalogReady && preset > 0 && preset <= presetMAX) return presetCatalog[preset].exists;
+  if (prefs.getChar("i", -1) == -1) return false;
+
+  // It exists!
+  return true;
+}
+
+
+
 
-
 /*
 
   Sine Wave..
@@ -1218,38 +2417,109 @@ void startSinus() {
   Calculate frequency for sine wave.
                                         */
 float_t sinusSetFrequency(float_t frequency) {
-  /*
-    Formula frequency = step * SINFAKT / div
-    step is the steps per clock pulse
-    div is the pre-scaler for the 8MHz clock (RTC 8M clock divider)
-    There are 8 pre-scalers from 1 to 1/8 around the combination pre-scaler and
-    to find the step count, we test all eight pre-scaler variants.
-    The combination with the smallest frequency deviation is chosen.
-  */
 
-  // if (eXi) Serial.println("\n Calculating frequency deviations.."); //debug
-  // if (eXi) Serial.println(" round        frequency    steps        delta"); //debug
+  PhaseTimer timer(PHASE_SET_FREQ);
+
+  // The planner tests all eight pre-scalers and keeps the one with the leastest deviance.
+  FreqPlan plan = planFrequency('s', frequency, 0);
+
+  // // Hmm..
+  // float_t foo = RTC_FAST_CLK_FREQ_APPROX / ( plan.divider + 1 ) * (float_t)plan.step / 65536; //debug
+  // if (eXi) Serial.printf("\n internal clock estimates frequency @ %.2f \n", foo); //debug
+
+  // Set frequency of internal CW generator common to both DAC channels
+  REG_SET_FIELD(RTC_CNTL_CLK_CONF_REG, RTC_CNTL_CK8M_DIV_SEL, plan.divider);
+
+  // Set steps per master clock pulse
+  SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL1_REG, SENS_SW_FSTEP, plan.step, SENS_SW_FSTEP_S);
+
+  if (eXi) Serial.printf(" returning frequency: %.2f (error: %.0fppm)\n", plan.achieved, plan.errorPPM);
+
+  return plan.achieved;
+}
+
+
+// TODO ASCII Art for each wave section (make it easy to find in overview)
+
+
+
+/*
+  Plan a frequency for a generator.
+
+  Returns the register/driver settings, the achieved frequency, the error (ppm) and the duty cycle
+  resolution for <mode> at <target> Hz with a <duty>% pulse width. Nothing here touches hardware,
+  so it's fine to ask "what would I get?" without changing the signal.
+
+  The frequency part of a solution only depends on the mode, the target and one "variant" (sine
+  factor, PWM resolution or DDS rate), so that's what we cache. Duty is cheap; we work that out
+  every time. loop(), the timed event worker and the step worker all plan, so the cache is only
+  touched under the signal lock (which they mostly hold already).
+                                                                          */
+FreqPlan planFrequency(char myMode, float_t target, uint8_t duty) {
+
+  SignalLock hold;
+  uint32_t variant = 0;
+  switch (myMode) {
+    case 's' : memcpy(&variant, &SINFAKT, sizeof(variant)); break; // The factor's bit pattern
+    case 'r' : variant = PWMResBits | (autoBits << 8); break;
+    case 't' : variant = (useDDS) ? ddsSampleRate : 0; break;
+  }
+
+  planClock++;
+  FreqPlan *slot = &planCache[0];
+
+  for (uint8_t i = 0; i < planCacheSize; i++) {
+    FreqPlan *p = &planCache[i];
+    if (p->used != 0 && p->mode == myMode && p->target == target && p->variant == variant) {
+      p->used = planClock;
+      planHits++;
+      planDuty(*p, duty);
+      return *p;
+    }
+    if (p->used < slot->used) slot = p; // Empty slots (0) always win.
+  }
+
+  // Not cached. Solve it and replace the least-recently used solution..
+  planMisses++;
+  FreqPlan plan = {};
+  plan.mode = myMode;
+  plan.target = target;
+  plan.variant = variant;
+
+  switch (myMode) {
+    case 's' : planSine(plan); break;
+    case 'r' : planRectangle(plan); break;
+    case 't' : planTriangle(plan); break;
+  }
+  plan.errorPPM = (target != 0) ? (plan.achieved - target) / target * 1000000 : 0;
+  plan.used = planClock;
+  *slot = plan;
+
+  planDuty(plan, duty);
+  return plan;
+}
+
+
+/*
+  Sine: frequency = step * SINFAKT / div
+
+  step is the steps per clock pulse
+  div is the pre-scaler for the 8MHz clock (RTC 8M clock divider)
+  There are 8 pre-scalers from 1 to 1/8 around the combination pre-scaler and
+  to find the step count, we test all eight pre-scaler variants.
+  The combination with the smallest frequency deviation is chosen.
+                                                                  */
+void planSine(FreqPlan &plan) {
 
   float_t f;
   float_t delta, delta_min = 9999999.0;
   int s, step = 1, divi = 0; // store best variant here
 
   for (uint8_t div = 0; div < 8; div++) {
-
-    s = round(frequency * (div+1) / SINFAKT);
+    s = round(plan.target * (div+1) / SINFAKT);
     if ((s > 0) && ((div == 0) || (s < 1024))) {
-
       f = SINFAKT * s / (div+1);
-      delta = abs(f - frequency);
-
-      // // handy for debugging and FOR SCIENCE!
-      // But will create empty mega-lines in your console even when eXi is false. Weird!
-      // (this is why the linebreak hack before the final output inside loop())
-      // if (eXi) Serial.print(div); Serial.print("        "); //debug
-      // if (eXi) Serial.print(f); Serial.print("        "); //debug
-      // if (eXi) Serial.print(s);Serial.print("        "); //debug
-      // if (eXi) Serial.println(delta); //debug
-
+      delta = abs(f - plan.target);
       if (delta < delta_min) { // Deviation is less! -> Store current values..
         step = s;
         divi = div;
@@ -1257,28 +2527,124 @@ float_t sinusSetFrequency(float_t frequency) {
       }
     }
   }
-  // We keep the one with the leastest deviance.
 
-  // Set the "real" frequency value
-  frequency = (SINFAKT * step) / (divi + 1);
+  plan.step = step;
+  plan.divider = divi;
+  plan.achieved = (SINFAKT * step) / (divi + 1);
+  plan.dutySteps = 1; // No pulse width for sine.
+}
 
-  // // Hmm..
-  // float_t foo = RTC_FAST_CLK_FREQ_APPROX / ( divi + 1 ) * (float_t)step / 65536; //debug
-  // if (eXi) Serial.printf("\n internal clock estimates frequency @ %.2f \n", foo); //debug
 
-  // Set frequency of internal CW generator common to both DAC channels
-  REG_SET_FIELD(RTC_CNTL_CLK_CONF_REG, RTC_CNTL_CK8M_DIV_SEL, divi);
+/*
+  Square: LEDC divides its clock (80MHz APB, or the 1MHz REF_TICK for the really low stuff) by a
+  10.8 fixed-point divider, then counts 2^bits per period. So..
 
-  // Set steps per master clock pulse
-  SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL1_REG, SENS_SW_FSTEP, step, SENS_SW_FSTEP_S);
+    divider = clock / (frequency * 2^bits)    (1.0 to 1023.996)
+    achieved = clock / (divider * 2^bits)
+
+  The best resolution is the most bits we can have before the divider drops below 1. That's what
+  we use with automatic resolution; otherwise it's your bit depth, unless this frequency can't have
+  it (then the best it can).
+                                                                          */
+void planRectangle(FreqPlan &plan) {
 
-  if (eXi) Serial.printf(" returning frequency: %.2f \n", frequency);
+  uint32_t apb = getApbFrequency();
+  float_t target = (plan.target > 0) ? plan.target : 1;
 
-  return frequency;
+  plan.bestBits = bestResolution(target, apb);
+  plan.resBits = (autoBits || ledcAchievable(target, PWMResBits, apb) == 0) ? plan.bestBits : PWMResBits;
+  plan.achieved = ledcAchievable(target, plan.resBits, apb);
 }
 
 
-// TODO ASCII Art for each wave section (make it easy to find in overview)
+// Most bits we can have at this frequency (switchResolution() tops out at 12)..
+uint8_t bestResolution(float_t target, uint32_t apb) {
+  for (uint8_t bits = 12; bits > 1; bits--) {
+    if ((float_t)apb / ((uint32_t)1 << bits) >= target && ledcAchievable(target, bits, apb) > 0) return bits;
+  }
+  return 1;
+}
+
+
+// What LEDC will really give us for this frequency/resolution (0 if it can't be done)..
+float_t ledcAchievable(float_t target, uint8_t bits, uint32_t apb) {
+  uint32_t clocks[2] = { apb, 1000000 }; // APB first, then REF_TICK
+  uint32_t steps = (uint32_t)1 << bits;
+  for (uint8_t c = 0; c < 2; c++) {
+    uint64_t divParam = ((uint64_t)clocks[c] << 8) / (uint64_t)(target * steps + 0.5);
+    if (divParam >= 256 && divParam < 0x40000) return ((float_t)clocks[c] * 256) / (divParam * steps);
+  }
+  return 0;
+}
+
+
+/*
+  Triangle: either the regular buffer-and-sample-rate method or DDS (see ddsSetFrequency()).
+                                                                          */
+void planTriangle(FreqPlan &plan) {
+
+  if (useDDS) {
+    double words = (double)plan.target * 4294967296.0 / ddsSampleRate;
+    if (words > 4294967295.0) words = 4294967295.0;
+    plan.tuningWord = (uint32_t)(words + 0.5);
+    if (plan.tuningWord == 0) plan.tuningWord = 1; // Always moving.
+    plan.rate = ddsSampleRate;
+    plan.achieved = (double)plan.tuningWord * ddsSampleRate / 4294967296.0;
+    return;
+  }
+
+  // First the appropriate buffer size is determined.
+  // Some trial-and-error here would probably produce even better numbers..
+  if (plan.target < 5001) {
+    plan.buffLen = 64;
+  } else if (plan.target < 10001) {
+    plan.buffLen = 32;
+  } else if (plan.target < 25001) {
+    plan.buffLen = 16;
+  } else {
+    plan.buffLen = 8; // 8 is the minimum
+  }
+  // Sample rate must output both buffers in one period.
+  plan.rate = plan.target * 2.000000 * plan.buffLen;
+
+  // For the output to work, the I2S sampling rate must be above 5200.
+  // If the sampling rate gets too low, you crash..
+  if (plan.rate < 5200) plan.rate = 5200;
+
+  plan.achieved = plan.rate / 2.000000 / plan.buffLen;
+}
+
+
+// Duty cycle resolution for a plan. The cheap bit, so not cached..
+void planDuty(FreqPlan &plan, uint8_t duty) {
+  if (duty > 100) duty = 100;
+  switch (plan.mode) {
+    case 'r' :
+      plan.dutySteps = (uint32_t)1 << plan.resBits;
+      break;
+    case 't' :
+      // One step per sample in a period, but pulse width is a whole percentage anyway..
+      if (useDDS) {
+        plan.dutySteps = min((uint32_t)100, (uint32_t)(0xFFFFFFFF / plan.tuningWord));
+      } else {
+        plan.dutySteps = plan.buffLen * 2;
+      }
+      break;
+    default :
+      plan.dutySteps = 1;
+  }
+  plan.dutyAchieved = (plan.dutySteps > 1) ? \
+                        round((float_t)plan.dutySteps * duty / 100) * 100 / plan.dutySteps : 50;
+}
+
+
+/*
+  The nearest frequency <myMode> can actually produce to <freq>, after limits.
+  Doesn't touch the hardware or the current signal.
+                                                      */
+FreqPlan nearestFrequency(char myMode, float_t freq) {
+  return planFrequency(myMode, limitFrequency(myMode, freq), pulse);
+}
 
 
 
@@ -1288,21 +2654,43 @@ float_t sinusSetFrequency(float_t frequency) {
                           */
 int startRectangle() {
   reallyDetatchPWM(); // No, really.
-  // if (ledcSetup(PWMChannel, frequency, PWMResBits) == 0) { return 0; } // debug
-  uint32_t ledc = ledcSetup(PWMChannel, frequency, PWMResBits);
+  // (ledcLive is 0 now, so this is a full setup, the way the planner says)..
+  uint32_t freq = rectangleSetFrequency(frequency, pulse);
   ledcAttachPin(PWMPin, PWMChannel);
-  ledcWrite(PWMChannel, (PWMSteps * pulse) / 100.0);
-  return ledc;
+  return freq;
 }
 
 /*
   Set frequency/resolution/duty cycle for rectangle wave..
+
+  The planner picks the resolution (see planRectangle()); that's what runs (ledcLiveBits), and the
+  duty cycle maths goes by it. Your bit depth (PWMResBits) stays as it is, so a frequency that can't
+  have it doesn't take it away for good. If the timer is already running at this frequency and
+  resolution, only the duty cycle changes; that's a single ledcWrite(), a few microseconds, no
+  glitch. Returns what ledcSetup() did (0 == failed).
                                                           */
-void rectangleSetFrequency(float_t frequency, int8_t pulse) {
-  ledcSetup(PWMChannel, frequency, PWMResBits);
-  // Set the pulse width / duty cycle..
+uint32_t rectangleSetFrequency(float_t frequency, int8_t pulse) {
+
+  PhaseTimer timer(PHASE_SET_FREQ);
+
+  FreqPlan plan = planFrequency('r', frequency, pulse);
+
   // No matter how many times I write this simple math, I still need to /think/ about it! perrrr-cent.
-  ledcWrite(PWMChannel, (PWMSteps * pulse) / 100.0);
+  uint32_t duty = (((uint32_t)1 << plan.resBits) * pulse) / 100.0;
+
+  if (ledcLive != 0 && plan.target == ledcLiveFreq && plan.resBits == ledcLiveBits) {
+    ledcWrite(PWMChannel, duty);
+    return ledcLive;
+  }
+
+  if (eXi) Serial.printf(" LEDC: %.3fHz (error: %.0fppm) @ %i bits (best: %i bits)\n", \
+                                  plan.achieved, plan.errorPPM, plan.resBits, plan.bestBits);
+  ledcLive = ledcSetup(PWMChannel, plan.target, plan.resBits);
+  ledcLiveFreq = plan.target;
+  ledcLiveBits = plan.resBits;
+  // Set the pulse width / duty cycle..
+  ledcWrite(PWMChannel, duty);
+  return ledcLive;
 }
 
 /*
@@ -1310,7 +2698,25 @@ void rectangleSetFrequency(float_t frequency, int8_t pulse) {
   This seems long-winded but unlike more sane approaches, works.
   Bash bash bash!
                           */
+// Resolution and duty steps of the running square wave (or your bit depth, before it's started)..
+uint8_t ledcBits() {
+  return (ledcLiveBits) ? ledcLiveBits : PWMResBits;
+}
+
+uint32_t ledcSteps() {
+  return (uint32_t)1 << ledcBits();
+}
+
+
+// " [4 at this frequency]" when the square wave can't have the bit depth you asked for..
+String resolutionNote() {
+  if (mode != 'r' || autoBits || ledcLive == 0 || ledcLiveBits == PWMResBits) return "";
+  return " [" + (String)ledcLiveBits + " at this frequency]";
+}
+
+
 void reallyDetatchPWM() {
+  ledcLive = 0; // Next time, it's a full setup
   ledcDetachPin(PWMPin);
   pinMode(PWMPin, INPUT);
   pinMode(PWMPin, OUTPUT);
@@ -1381,8 +2787,10 @@ void startTriangle() {
   Don't laugh, or you'll spoil it.
 
 
-  * There is no way to get a single ESP32 unit to simultaneously output two different triangle/sine
-    waves at different frequencies. So you need two modules. Just as well they are so cheap!
+  * Or just the one! Dual Channel mode ("duale") puts a different wave on each DAC pin, phase-locked
+    from the same sample clock. Set channel 2 with e.g. "dual2 w=t,f=1.001k,p=30" and you're away.
+    (It's DDS underneath, so keep to 25kHz and below.) Two modules still make the nicer shapes up
+    top, though. Just as well they are so cheap!
 
 
   ** If you are buying an oscilloscope, ffs, don't buy one with only one channel. These days, you
@@ -1412,64 +2820,71 @@ void startTriangle() {
 // Set frequency for triangle with corresponding pulse width (sawtooth angle)..
 float_t triangleSetFrequency(float_t frequency, int8_t pulse) {
 
+  PhaseTimer timer(PHASE_SET_FREQ);
+  if (useDDS) return ddsSetFrequency(frequency, pulse);
+
   float_t f = frequency;
-  uint8_t buffLen = 64;
-  // First the appropriate buffer size is determined.
-  // Some trial-and-error here would probably produce even better numbers..
-  if (frequency < 5001) {
-    buffLen = 64;
-  } else if (frequency < 10001) {
-    buffLen = 32;
-  } else if (frequency < 25001) {
-    buffLen = 16;
-  } else {
-    buffLen = 8; // 8 is the minimum
-  }
-  // Sample rate must output both buffers in one period.
-  uint32_t rate = frequency * 2.000000 * buffLen;
 
-  // For the output to work, the I2S sampling rate must be above 5200.
-  // If the sampling rate gets too low, you crash..
-  if (rate < 5200) rate = 5200;
+  // The planner picks the buffer size and sample rate (see planTriangle())..
+  FreqPlan plan = planFrequency('t', frequency, pulse);
+  uint8_t buffLen = plan.buffLen;
+  uint32_t rate = plan.rate;
 
   // Set the real frequency value..
-  frequency = rate / 2.000000 / buffLen;
+  frequency = plan.achieved;
 
-  // Remove I2S driver..
-  if (INi2S == ESP_OK) {
-    i2s_driver_uninstall(i2s_num);
-    INi2S = -1;
-  };
+  // Already playing? Then we keep the driver (and the DAC) and only retune, below..
+  bool retune = (triangleLive && INi2S == ESP_OK);
+  uint32_t retuneStart = ESP.getCycleCount();
 
-  // Customize the configuration..
-  i2s_config.sample_rate = rate;
-  i2s_config.dma_buf_len = buffLen;
+  if (!retune) {
 
-  // (re-)install driver with new settings..
-  INi2S = i2s_driver_install(i2s_num, &i2s_config, 0, NULL);
-  if(INi2S != ESP_OK) {
-  /*
-     This never happens because of a bug in i2s_driver_install()
-     which has STILL not been fixed (2023-2).
+    // Remove I2S driver..
+    if (INi2S == ESP_OK) {
+      i2s_driver_uninstall(i2s_num);
+      INi2S = -1;
+    };
 
-     So it always returns 0 (ESP_OK).
-                                                      */
-    delay(250); // This never happens, but just in case! One day ...
+    // Customize the configuration. The ring is always tBuff-sized; the period lives inside it..
+    i2s_config.sample_rate = rate;
+    i2s_config.dma_buf_len = tRingFrames / i2s_config.dma_buf_count;
+
+    // (re-)install driver with new settings..
     INi2S = i2s_driver_install(i2s_num, &i2s_config, 0, NULL);
-  } // MCU coding is some pragmatic sh*t!
+    if(INi2S != ESP_OK) {
+    /*
+       This never happens because of a bug in i2s_driver_install()
+       which has STILL not been fixed (2023-2).
 
-  if(INi2S == ESP_OK) {
+       So it always returns 0 (ESP_OK).
+                                                        */
+      delay(250); // This never happens, but just in case! One day ...
+      INi2S = i2s_driver_install(i2s_num, &i2s_config, 0, NULL);
+    } // MCU coding is some pragmatic sh*t!
+  }
 
-    // Set the sampling rate..
-    i2s_set_sample_rates(i2s_num, rate);
+  if(INi2S == ESP_OK) {
 
-    // Fill the buffer
-    fillBuffer(pulse, buffLen * 2);
+    // Fill one period, then repeat it round the whole ring..
+    uint16_t period = buffLen * 2;
+    fillBuffer(pulse, period);
+    for (uint16_t i = period; i < tRingFrames; i++) tBuff[i] = tBuff[i % period];
 
-    // And write it out..
+    /*
+       Write it out, then set the rate. i2s_write() only hands us buffers the DMA has finished with,
+       and setting the clock restarts the DMA from the top of the ring; so the new wave starts on a
+       buffer (and period) boundary, at its new rate. A fresh install does it in the same order..
+                                                                                          */
     size_t bytes_written;
-    i2s_write(i2s_num, (const char *)&tBuff, buffLen * 8, &bytes_written, portMAX_DELAY);
+    i2s_write(i2s_num, (const char *)&tBuff, sizeof(tBuff), &bytes_written, portMAX_DELAY);
+    i2s_set_sample_rates(i2s_num, rate);
+    triangleLive = true;
 
+    if (retune) recordPhase(PHASE_RETUNE, ESP.getCycleCount() - retuneStart);
+
+    triError = frequency - f;
+    if (eXi) Serial.printf(" returning frequency: %.2f (error: %.2fHz / %.0fppm)\n", \
+                                                      frequency, triError, triError / f * 1000000);
     // Guess what?
     return frequency;
   }
@@ -1539,54 +2954,224 @@ void fillBuffer(uint8_t upTime, uint8_t buffSize) {
 
 
 /*
-   Switch PWM resolution bit depth..
-   Also set the corresponding number of steps used to achieve the correct ratio:
+  Triangle/Sawtooth via DDS..
 
-   bits      =>  steps     approx. limits (min / max)
+  The I2S driver runs at a fixed ddsSampleRate and a wee task keeps the DMA fed from tBuff, stepping
+  a 32-bit phase accumulator through every sample. Frequency is simply how far the phase moves per
+  sample (the "tuning word"), so..
 
-   16        =>  1024      1Hz    -   78KHz
+    tuning word = frequency * 2^32 / sample rate
 
-   ...                     Observe*-> No change..
+  .. and because the tuning word is an integer, the achieved frequency is..
 
-   10        =>  1024      1Hz    -   78KHz
-   9         =>  512       2Hz    -   156kHz
-   8         =>  256       4Hz    -   313kHz
-   7         =>  128       8Hz    -   626kHz
-   6         =>  64        16Hz   -   1.25MHz
-   5         =>  32        31Hz   -   2.5MHz
-   4         =>  16        62Hz   -   5.01MHz
-   3         =>  8         123Hz  -   10MHz      (10019569.00Hz on this board)
-   2         =>  4         245Hz  -   20.04MHz   (20039000.00Hz)
-   1         =>  2         489Hz  -   40.08MHz   (40078000.00Hz)  Our square wave is now a beautiful Sine wave!
+    achieved = tuning word * sample rate / 2^32
 
-   NOTE: As you reduce the bits, your ability to get accurate duty cycles diminishes (unless they are 50%!).
+  .. which we return, along with the error, as usual.
+                                                      */
+float_t ddsSetFrequency(float_t frequency, int8_t pulse) {
 
-   * In the style of "Radio Silence", by Thomas Dolby.
+  FreqPlan plan = planFrequency('t', frequency, pulse);
+  float_t achieved = plan.achieved;
 
-                                                            */
-uint8_t switchResolution(uint8_t newbits, bool save = true) {
+  ddsSetShape(pulse);
+  ddsTuningWord = plan.tuningWord;
+  if (useDual) dualSetChannels(false);
 
-  if (newbits > 12) newbits = 12;
-  if (newbits < 1) newbits = 1;
+  if (!ddsRunning && !ddsStart()) return frequency; // Same as regular triangle mode when the driver fails.
 
-  switch (newbits) {
+  triError = achieved - frequency;
+  if (eXi) Serial.printf(" returning frequency: %.4f (DDS error: %.5fHz / %.2fppm)\n", \
+                                                    achieved, triError, triError / frequency * 1000000);
+  return achieved;
+}
 
-    case 1: PWMSteps = 2; break;
-    case 2: PWMSteps = 4; break;
-    case 3: PWMSteps = 8; break;
-    case 4: PWMSteps = 16; break;
-    case 5: PWMSteps = 32; break;
-    case 6: PWMSteps = 64; break;
-    case 7: PWMSteps = 128; break;
-    case 8: PWMSteps = 256; break;
-    case 9: PWMSteps = 512; break;
-    case 10: PWMSteps = 1024; break;
-    // No Point ...
-    case 11: PWMSteps = 2048; break;
-    case 12: PWMSteps = 4096; break;
+
+// Rise/fall slopes for the current pulse width (sawtooth angle) and amplitude (see synthSetShape())..
+void ddsSetShape(uint8_t upTime) {
+
+  // Same scaling as fillBuffer() (255, 127, 84, 63)..
+  uint8_t amplitude = (256 / (5-waveAmplitude)) - 1;
+
+  uint32_t upPoint, slopeUP, slopeDOWN;
+  synthSetShape(upPoint, slopeUP, slopeDOWN, upTime, amplitude);
+  ddsSlopeUP = slopeUP;
+  ddsSlopeDOWN = slopeDOWN;
+  ddsUpPoint = upPoint;
+  ddsAmplitude = amplitude;
+}
+
+
+/*
+  Set up both channels for Dual Channel mode. Channel 1 takes its frequency and shape from the
+  regular DDS settings (so sweeps, songs, touches, etc. all still work on it), channel 2 from its
+  own. With resync, both start again from their phase offsets, locked together..
+                                                                                    */
+void dualSetChannels(bool resync) {
+  SynthChannel a, b;
+  synthSetChannel(a, dual.waveA, frequency, ddsSampleRate, pulse, ddsAmplitude, dual.offsetA);
+  synthSetChannel(b, dual.waveB, dual.frequencyB, ddsSampleRate, dual.pulseB, \
+                                                      (256 / (5-dual.amplitudeB)) - 1, dual.offsetB);
+  portENTER_CRITICAL(&dualMux);
+  dualNext[0] = a;
+  dualNext[1] = b;
+  dualChanged = true;
+  if (resync) dualResync = true;
+  portEXIT_CRITICAL(&dualMux);
+}
+
+
+// The task that keeps the DMA fed..
+void ddsWriter(void *param) {
+  size_t bytes_written;
+  SynthChannel carrier = {};
+  carrier.wave = 't';
+  SynthModulator modulator = {};  // Its phase carries on from block to block
+  while (ddsRunning) {
+    if (useDual) {
+      // New settings? The phases carry on (no glitch), unless we've been asked to start again..
+      if (dualChanged) {
+        portENTER_CRITICAL(&dualMux);
+        uint32_t phaseA = dualLive[0].phase, phaseB = dualLive[1].phase;
+        dualLive[0] = dualNext[0];
+        dualLive[1] = dualNext[1];
+        if (!dualResync) {
+          dualLive[0].phase = phaseA;
+          dualLive[1].phase = phaseB;
+        }
+        dualChanged = false;
+        dualResync = false;
+        portEXIT_CRITICAL(&dualMux);
+      }
+      // Channel 1 follows the regular DDS settings (sweeps and songs change these directly)..
+      dualLive[0].tuningWord = ddsTuningWord;
+      dualLive[0].upPoint = ddsUpPoint;
+      dualLive[0].slopeUP = ddsSlopeUP;
+      dualLive[0].slopeDOWN = ddsSlopeDOWN;
+      synthFillStereo(tBuff, 128, dualLive[0], dualLive[1]);
+    } else {
+      // The carrier follows the regular DDS settings (sweeps and songs change these directly)..
+      carrier.phase = ddsPhase;
+      carrier.tuningWord = ddsTuningWord;
+      carrier.upPoint = ddsUpPoint;
+      carrier.slopeUP = ddsSlopeUP;
+      carrier.slopeDOWN = ddsSlopeDOWN;
+      carrier.amplitude = ddsAmplitude;
+      if (ddsModType) {
+        modulator.type = ddsModType;
+        modulator.depth = ddsModDepth;
+        modulator.tuningWord = ddsModTuning;
+        modulator.carrierTuning = ddsTuningWord;
+        modulator.carrierPulse = ddsModPulse;
+        synthFillModulated(tBuff, 128, carrier, modulator);
+      } else {
+        // Triangle's slopes have the amplitude built in, so the one kernel does them all..
+        synthBlock<'t', 255, false>(tBuff, 128, carrier);
+      }
+      ddsPhase = carrier.phase;
+    }
+    i2s_write(i2s_num, (const char *)&tBuff, sizeof(tBuff), &bytes_written, pdMS_TO_TICKS(100));
+  }
+  ddsTask = NULL;
+  vTaskDelete(NULL);
+}
+
+
+// Install the I2S driver at the fixed DDS rate and start the writer task..
+bool ddsStart() {
+
+  triangleLive = false; // The regular triangle's driver goes, if it was here
+  if (INi2S == ESP_OK) {
+    i2s_driver_uninstall(i2s_num);
+    INi2S = -1;
+  }
+
+  // Our own copy; the regular triangle mode expects i2s_config the way it left it.
+  i2s_driver_config_t dds_config = i2s_config;
+  dds_config.sample_rate = ddsSampleRate;
+  dds_config.dma_buf_count = 4;
+  dds_config.dma_buf_len = 128;
+
+  INi2S = i2s_driver_install(i2s_num, &dds_config, 0, NULL);
+  if (INi2S != ESP_OK) return false;
+  i2s_set_sample_rates(i2s_num, ddsSampleRate);
+
+  ddsPhase = 0;
+  if (useDual) dualSetChannels(true);
+  ddsRunning = true;
+  // Core 0, so loop() (core 1) can do whatever it likes without starving the DMA.
+  if (xTaskCreatePinnedToCore(ddsWriter, "ddsWriter", 2048, NULL, 5, &ddsTask, 0) != pdPASS) {
+    ddsRunning = false;
+    ddsTask = NULL;
+    return false;
+  }
+  return true;
+}
+
+
+// Stop the writer task (it finishes its current block first)..
+void ddsStop() {
+  if (!ddsRunning && ddsTask == NULL) return;
+  ddsRunning = false;
+  for (uint8_t i = 0; i < 50 && ddsTask != NULL; i++) delay(5);
+}
+
+
+
+/*
+   Switch PWM resolution bit depth..
+   Also set the corresponding number of steps used to achieve the correct ratio:
+
+   bits      =>  steps     approx. limits (min / max)
+
+   16        =>  1024      1Hz    -   78KHz
+
+   ...                     Observe*-> No change..
+
+   10        =>  1024      1Hz    -   78KHz
+   9         =>  512       2Hz    -   156kHz
+   8         =>  256       4Hz    -   313kHz
+   7         =>  128       8Hz    -   626kHz
+   6         =>  64        16Hz   -   1.25MHz
+   5         =>  32        31Hz   -   2.5MHz
+   4         =>  16        62Hz   -   5.01MHz
+   3         =>  8         123Hz  -   10MHz      (10019569.00Hz on this board)
+   2         =>  4         245Hz  -   20.04MHz   (20039000.00Hz)
+   1         =>  2         489Hz  -   40.08MHz   (40078000.00Hz)  Our square wave is now a beautiful Sine wave!
+
+   NOTE: As you reduce the bits, your ability to get accurate duty cycles diminishes (unless they are 50%!).
+
+   * In the style of "Radio Silence", by Thomas Dolby.
+
+                                                            */
+uint8_t switchResolution(uint8_t newbits, bool save = true) {
+
+  if (newbits > 12) newbits = 12;
+  if (newbits < 1) newbits = 1;
+
+  // A user picking the bits takes over from automatic resolution..
+  if (save && autoBits) {
+    autoBits = false;
+    prefs.putBool("B", false);
+  }
+
+  switch (newbits) {
+
+    case 1: PWMSteps = 2; break;
+    case 2: PWMSteps = 4; break;
+    case 3: PWMSteps = 8; break;
+    case 4: PWMSteps = 16; break;
+    case 5: PWMSteps = 32; break;
+    case 6: PWMSteps = 64; break;
+    case 7: PWMSteps = 128; break;
+    case 8: PWMSteps = 256; break;
+    case 9: PWMSteps = 512; break;
+    case 10: PWMSteps = 1024; break;
+    // No Point ...
+    case 11: PWMSteps = 2048; break;
+    case 12: PWMSteps = 4096; break;
     // Seriously, stop now. We need RMT or something for the really low stuff.
   }
-  if (save) prefs.putUChar("b", newbits);
+  if (save) cacheSetting('b', newbits);
   return newbits;
 }
 
@@ -1607,6 +3192,8 @@ String makeHumanMode(char myMode) {
     case 's' : return "Sine";
     case 't' : return "Triangle";
     case 'r' : return "Square";
+    case 'w' : return "Saw";      // (Dual Channel only)
+    case 'n' : return "Noise";    // (Dual Channel only)
   }
   return "";
 }
@@ -1669,15 +3256,22 @@ String makeHumanFrequency(float_t f, bool exporting = false) {
   Ensure the user hasn't attempted to go outside their own user-set limits..
                                 */
 void checkLimits(float_t freq) {
+    float_t limited = limitFrequency(mode, freq);
+    didLimit = (limited != freq);
+    if (didLimit) frequency = limited;
+}
+
+
+// Apply the limits for <myMode> to <freq> and return the result. Changes nothing.
+float_t limitFrequency(char myMode, float_t freq) {
 
     // We could set the lowest upper frequency limit (triangle wave).
     // etc.. but it's less confusing to just set them /all/ below..
     uint32_t u_limit = 0;
-    uint32_t l_limit = 0;
-    didLimit = false;
+    float_t l_limit = 0;
 
-    // Set frequency limits based on current mode..
-    switch (mode) {
+    // Set frequency limits based on mode..
+    switch (myMode) {
       case 's' : // Sine
         u_limit = SineUpperLimit;
         l_limit = SineLowerLimit;
@@ -1687,21 +3281,15 @@ void checkLimits(float_t freq) {
         l_limit = RectLowerLimit;
         break;
       case 't' : // Triangle/Sawtooth
-        u_limit = TriUpperLimit;
-        l_limit = TriLowerLimit;
+        u_limit = (useDDS) ? DDSUpperLimit : TriUpperLimit;
+        l_limit = (useDDS) ? DDSLowerLimit : TriLowerLimit;
         break;
     }
 
     // Check lower and upper limits. Simple.
-    if (freq < l_limit) {
-      frequency = l_limit;
-      didLimit = true;
-    }
-
-    if (freq > u_limit) {
-      frequency = u_limit;
-      didLimit = true;
-    }
+    if (freq < l_limit) return l_limit;
+    if (freq > u_limit) return u_limit;
+    return freq;
 }
 
 
@@ -1737,7 +3325,7 @@ void frequencyStepSet(String newFreq) {
   if (thisFreq < 1) thisFreq = 1; // 1Hz
   if (thisFreq > 10000000) thisFreq = 10000000; // 10MHz
   fStep = thisFreq; // NOW we set it.
-  prefs.putFloat("s", fStep);
+  cacheSetting('s', fStep);
 }
 
 
@@ -1745,12 +3333,17 @@ void frequencyStepSet(String newFreq) {
    Set signal frequency..
                                                         */
 void frequencySet(String newFreq, bool OVRide = false, bool doReport = true) {
+  setFrequency(humanFreqToFloat(newFreq), OVRide, doReport);
+}
+
+// The same, but for frequencies that are already numbers (compiled loops, notes, etc.)..
+void setFrequency(float_t newFreq, bool OVRide, bool doReport) {
 
-  frequency = humanFreqToFloat(newFreq);
+  frequency = newFreq;
 
   if (eXi && doReport) Serial.printf(" User requested frequency:\t%s\n", makeHumanFrequency(frequency).c_str());
   if (OVRide == false) checkLimits(frequency);
-  prefs.putFloat("f", frequency);
+  cacheSetting('f', frequency);
   if (eXi && doReport) Serial.printf(" Setting frequency:\t%s\n", makeHumanFrequency(frequency).c_str());
 }
 
@@ -1764,19 +3357,72 @@ void frequencySet(String newFreq, bool OVRide = false, bool doReport = true) {
   Except here we use it to set the frequency of *any* signal type..
 
                                                         */
-uint32_t setNoteFrequency(note_t note) {
-
-  const uint16_t noteFreqBase[12] = {
-  // Note:    C         C#       D        Eb       E        F       F#        G       G#        A       Bb        B
-  // typedef: NOTE_C,   NOTE_Cs, NOTE_D,  NOTE_Eb, NOTE_E,  NOTE_F, NOTE_Fs,  NOTE_G, NOTE_Gs,  NOTE_A, NOTE_Bb,  NOTE_B
-              4186,     4435,    4699,    4978,    5274,    5588,   5920,     6272,   6645,     7040,   7459,     7902
-  };
-  uint32_t noteFreq = (uint32_t)noteFreqBase[note] / (uint32_t)(1 << (8-myOctave));
-  frequencySet((String)noteFreq, false, false);
+float_t setNoteFrequency(note_t note) {
+  float_t noteFreq = noteFrequency(note, myOctave);
+  setFrequency(noteFreq, false, false);
   return noteFreq;
 }
 
 
+/*
+  Equal temperament (A4 = 440Hz), octave 8. Each octave down halves the frequency, exactly.
+  Floats, so the fractions of a Hz survive all the way down to octave 0.
+                                                                        */
+constexpr float_t noteFreqBase[12] = {
+// Note:    C           C#          D           Eb          E           F
+// typedef: NOTE_C,     NOTE_Cs,    NOTE_D,     NOTE_Eb,    NOTE_E,     NOTE_F,
+            4186.0090,  4434.9221,  4698.6363,  4978.0317,  5274.0409,  5587.6517,
+// Note:    F#          G           G#          A           Bb          B
+// typedef: NOTE_Fs,    NOTE_G,     NOTE_Gs,    NOTE_A,     NOTE_Bb,    NOTE_B
+            5919.9108,  6271.9270,  6644.8752,  7040.0000,  7458.6202,  7902.1328
+};
+
+float_t noteFrequency(uint8_t note, uint8_t octave) {
+  if (note > 11) note = 0;
+  if (octave > 8) octave = 8;
+  return noteFreqBase[note] / (float_t)(1 << (8-octave));
+}
+
+
+/*
+  Note name to note number (0-11, same order as note_t), or -1 if it isn't a note.
+  C C# D Eb E F F# G G# A Bb B, plus all the usual alternatives (Db, D#, Gb, etc.)
+                                                                                  */
+int8_t noteIndex(String thisNote) {
+
+  thisNote.trim();
+  thisNote.toLowerCase();
+  if (thisNote == "") return -1;
+
+  int8_t note;
+  switch (thisNote[0]) {
+    case 'c' : note = 0; break;
+    case 'd' : note = 2; break;
+    case 'e' : note = 4; break;
+    case 'f' : note = 5; break;
+    case 'g' : note = 7; break;
+    case 'a' : note = 9; break;
+    case 'b' : note = 11; break;
+    default : return -1;
+  }
+  if (thisNote.length() > 1) {
+    if (thisNote[1] == '#') note++;
+    else if (thisNote[1] == 'b') note--;
+  }
+  return (note + 12) % 12;
+}
+
+
+// Cb is the B below it, and B# the C above; everything else stays in its own octave..
+int8_t noteOctaveShift(String thisNote) {
+  thisNote.trim();
+  thisNote.toLowerCase();
+  if (thisNote.startsWith("cb")) return -1;
+  if (thisNote.startsWith("b#")) return 1;
+  return 0;
+}
+
+
 /*
 
   Play a specific musical note.
@@ -1802,11 +3448,10 @@ uint32_t setNoteFrequency(note_t note) {
   But really it's designed to play single musical notes, for reference, tuning, etc..
 
                                           */
-uint32_t playMusicalNote(String musicData) {
+float_t playMusicalNote(String musicData) {
 
   int16_t Split = musicData.indexOf("|");
   String thisNote;
-  uint32_t newFreq;
 
   if (Split != -1) {
     thisNote = musicData.substring(0, Split);
@@ -1826,34 +3471,340 @@ uint32_t playMusicalNote(String musicData) {
   }
 
   if(myOctave > 8) myOctave = 8;
-  thisNote.trim();
 
-  if (thisNote == "c#" || thisNote == "db") {
-    newFreq = setNoteFrequency(NOTE_Cs);
-  } else if (thisNote == "d") {
-    newFreq = setNoteFrequency(NOTE_D);
-  } else if (thisNote == "eb" || thisNote == "d#") {
-    newFreq = setNoteFrequency(NOTE_Eb);
-  } else if (thisNote == "e") {
-    newFreq = setNoteFrequency(NOTE_E);
-  } else if (thisNote == "f") {
-    newFreq = setNoteFrequency(NOTE_F);
-  } else if (thisNote == "f#" || thisNote == "gb") {
-    newFreq = setNoteFrequency(NOTE_Fs);
-  } else if (thisNote == "g") {
-    newFreq = setNoteFrequency(NOTE_G);
-  } else if (thisNote == "g#" || thisNote == "ab") {
-    newFreq = setNoteFrequency(NOTE_Gs);
-  } else if (thisNote == "a") {
-    newFreq = setNoteFrequency(NOTE_A);
-  } else if (thisNote == "bb" || thisNote == "a#") {
-    newFreq = setNoteFrequency(NOTE_Bb);
-  } else if (thisNote == "b") {
-    newFreq = setNoteFrequency(NOTE_B);
-  } else {
-    newFreq = setNoteFrequency(NOTE_C);
+  int8_t note = noteIndex(thisNote);
+  if (note == -1) note = NOTE_C;
+  int8_t octave = myOctave + noteOctaveShift(thisNote);
+  if (octave >= 0 && octave <= 8 && octave != myOctave) {
+    float_t noteFreq = noteFrequency(note, octave);
+    setFrequency(noteFreq, false, false);
+    return noteFreq;
+  }
+  return setNoteFrequency((note_t)note);
+}
+
+
+
+
+
+/*
+  Songs..
+
+  usage: song=<tempo> <notes>
+
+  Notes are the same as for *, with the octave straight after the note (it carries on to the next
+  note if you leave it off) and the length after a /. 1 = whole note, 2 = half, 4 = quarter (the
+  default), 8 = eighth, 16 = sixteenth. Add a . for a dotted note. r is a rest. e.g..
+
+    song=120 g4/4 g d5 d e/8 f# g e d/2 r/4
+
+  The song is saved to NVS (so it's there after a reboot) and played with "song". Then..
+
+    song?      Song info
+    songrep    Play the song on repeat
+    song end   Stop the song (so does "stop")
+    song-      Wipe the song
+
+  Songs play in whatever mode you are in, at exact equal temperament frequencies, with a hardware
+  timer keeping time.
+                                                    */
+String songCommand(String songData) {
+
+  songData.trim();
+
+  if (songData == "" || songData == "rep") return playSong(songData == "rep");
+  if (songData == "?") return songReport();
+  if (songData == "end" || songData == ".") {
+    if (!songPlayer.playing) return "No song playing";
+    stopSong();
+    return "Song stopped";
+  }
+  if (songData == "-") {
+    stopSong();
+    songHead.length = 0;
+    prefs.remove("g");
+    return "Song wiped";
+  }
+  if (songData[0] == '=') {
+    String result = compileSong(songData.substring(1));
+    if (songHead.length != 0) {
+      size_t songSize = sizeof(SongHeader) + songHead.length * sizeof(SongNote);
+      uint8_t songBlob[sizeof(SongHeader) + sizeof(song)];
+      memcpy(songBlob, &songHead, sizeof(SongHeader));
+      memcpy(songBlob + sizeof(SongHeader), song, songHead.length * sizeof(SongNote));
+      if (prefs.putBytes("g", songBlob, songSize) != songSize) result += " (failed to save!)";
+    }
+    return result;
+  }
+  return "Usage: song=<tempo> <notes> (RTFM!), song, song?, songrep, song end, song-";
+}
+
+
+// Text to notes..
+String compileSong(String songData) {
+
+  stopSong();
+  songData.trim();
+  songData.toLowerCase();
+
+  uint8_t length = 0;
+  uint8_t octave = myOctave;
+  uint16_t tempo = 120;
+  bool first = true;
+
+  while (songData != "") {
+
+    int16_t spacePos = songData.indexOf(" ");
+    if (spacePos == -1) spacePos = songData.length();
+    String token = songData.substring(0, spacePos);
+    songData = songData.substring(spacePos + 1);
+    songData.trim();
+    if (token == "") continue;
+
+    // The tempo comes first..
+    if (first && isDigit(token[0])) {
+      tempo = token.toInt();
+      first = false;
+      continue;
+    }
+    first = false;
+
+    if (length == songMAX) return "Song Too Long! (" + (String)songMAX + " notes maximum)";
+
+    // Length..
+    uint8_t ticks = 4;
+    int16_t slashPos = token.indexOf("/");
+    if (slashPos != -1) {
+      String lengthData = token.substring(slashPos + 1);
+      token = token.substring(0, slashPos);
+      uint8_t value = lengthData.toInt();
+      if (value != 1 && value != 2 && value != 4 && value != 8 && value != 16) \
+                                        return "Bad note length (1, 2, 4, 8 or 16): " + lengthData;
+      ticks = 16 / value;
+      if (lengthData.endsWith(".")) ticks += ticks / 2;
+    }
+
+    // Rest..
+    if (token == "r" || token == "-") {
+      song[length].pitch = songRest;
+      song[length++].ticks = ticks;
+      continue;
+    }
+
+    // Note and (maybe) octave..
+    int8_t note = noteIndex(token);
+    if (note == -1) return "Not a note: " + token;
+    uint8_t nameLength = (token.length() > 1 && (token[1] == '#' || token[1] == 'b')) ? 2 : 1;
+    if ((int16_t)token.length() > nameLength) {
+      String octaveData = token.substring(nameLength);
+      if (octaveData == "+") octave++;
+      else if (octaveData == "-") { if (octave > 0) octave--; }
+      else octave = octaveData.toInt();
+      if (octave > 8) octave = 8;
+    }
+    // (Only this note; cb4 is B3, and the next note is back in octave 4)..
+    int8_t noteOctave = octave + noteOctaveShift(token);
+    if (noteOctave < 0 || noteOctave > 8) noteOctave = octave;
+    song[length].pitch = (noteOctave << 4) | note;
+    song[length++].ticks = ticks;
+  }
+
+  if (tempo < 10) tempo = 10;
+  songHead.version = songVersion;
+  songHead.length = length;
+  songHead.tempo = tempo;
+  return "Song loaded: " + (String)length + " notes @ " + (String)tempo + " bpm";
+}
+
+
+// Load the stored song (if there is one)..
+void loadSong() {
+  songHead.length = 0;
+  size_t songSize = prefs.getBytesLength("g");
+  if (songSize < sizeof(SongHeader) || songSize > sizeof(SongHeader) + sizeof(song)) return;
+  uint8_t songBlob[sizeof(SongHeader) + sizeof(song)];
+  prefs.getBytes("g", songBlob, songSize);
+  SongHeader header;
+  memcpy(&header, songBlob, sizeof(SongHeader));
+  if (header.version != songVersion || songSize != sizeof(SongHeader) + header.length * sizeof(SongNote)) return;
+  memcpy(song, songBlob + sizeof(SongHeader), header.length * sizeof(SongNote));
+  songHead = header;
+}
+
+
+String playSong(bool repeat) {
+
+  if (songHead.length == 0) return "No song loaded! (song=<tempo> <notes> first)";
+
+  stopSong();
+  if (!startStepWorker()) return "Failed to start the step worker!";
+
+  if (songTimer == NULL) {
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = &songNextNote;
+    timerArgs.name = "song";
+    if (esp_timer_create(&timerArgs, &songTimer) != ESP_OK) {
+      songTimer = NULL;
+      return "Failed to start the song timer!";
+    }
+  }
+
+  // Start the signal at the first real note, the regular way. The rest is up to the timer..
+  for (uint8_t i = 0; i < songHead.length; i++) {
+    if (song[i].pitch != songRest) {
+      frequency = noteFrequency(song[i].pitch & 0x0F, song[i].pitch >> 4);
+      break;
+    }
+  }
+  startSignal("Song");
+
+  songPlayer.mode = mode;
+  songPlayer.buffLen = (mode == 't' && !useDDS) ? planFrequency('t', frequency, pulse).buffLen : 0;
+  songPlayer.repeat = repeat;
+  songPlayer.position = 0;
+  songPlayer.notes = 0;
+  songPlayer.lateMax = 0;
+  songPlayer.dropped = 0;
+  songPlayer.muted = false;
+  songPlayer.playing = true;
+  songPlayer.due = esp_timer_get_time();
+  songNextNote(NULL);
+
+  return "Playing song: " + (String)songHead.length + " notes @ " + (String)songHead.tempo + " bpm" + \
+                                                                      ((repeat) ? " (repeating)" : "");
+}
+
+
+// (Commands only; the signal lock is held.)
+void stopSong() {
+  if (songTimer != NULL) esp_timer_stop(songTimer);
+  // As stopSweep(); a note that's still on its way can't turn up after this..
+  portENTER_CRITICAL(&stepMux);
+  songPlayer.playing = false;
+  songQueueCount = 0;
+  portEXIT_CRITICAL(&stepMux);
+  // Don't leave it on a rest. (If the mode changed, it's a new signal; nothing to unmute.)
+  if (mode == songPlayer.mode) songMute(false);
+  else songPlayer.muted = false;
+}
+
+
+/*
+  Play the next note and set the timer for the one after.
+
+  Each note is due at an exact time from the start of the song, so lateness doesn't add up.
+  Like the sweep, this runs in the esp_timer task; it keeps time, and the step worker plays the
+  notes (see songQueue()).
+                                                                                */
+void songNextNote(void *param) {
+
+  if (!songPlayer.playing) return;
+
+  // Something else changed the mode; that's the end of the song..
+  if (mode != songPlayer.mode) {
+    songPlayer.playing = false;
+    return;
+  }
+
+  if (songPlayer.position >= songHead.length) {
+    if (!songPlayer.repeat) {
+      songQueue(songEnd);
+      return;
+    }
+    songPlayer.position = 0;
+  }
+
+  int64_t now = esp_timer_get_time();
+  uint32_t late = (now > songPlayer.due) ? now - songPlayer.due : 0;
+  if (late > songPlayer.lateMax) songPlayer.lateMax = late;
+
+  SongNote &thisNote = song[songPlayer.position++];
+  songQueue(thisNote.pitch);
+  songPlayer.notes++;
+
+  // A quarter note (4 ticks) is one beat..
+  songPlayer.due += (int64_t)thisNote.ticks * 15000000 / songHead.tempo;
+  int64_t wait = songPlayer.due - esp_timer_get_time();
+  esp_timer_start_once(songTimer, (wait > 0) ? wait : 1);
+}
+
+
+// Hand a note (or a rest, or the end) to the step worker, if the song is still on..
+void songQueue(uint8_t pitch) {
+  portENTER_CRITICAL(&stepMux);
+  bool queued = songPlayer.playing;
+  if (queued) {
+    // Full? Then the worker's been held up a long time; the oldest note is long past anyway..
+    if (songQueueCount == songQueueMAX) {
+      songQueueFirst = (songQueueFirst + 1) % songQueueMAX;
+      songQueueCount--;
+      songPlayer.dropped++;
+    }
+    songQueued[(songQueueFirst + songQueueCount++) % songQueueMAX] = pitch;
+    if (pitch == songEnd) songPlayer.playing = false;
   }
-  return newFreq;
+  portEXIT_CRITICAL(&stepMux);
+  if (queued) xTaskNotifyGive(stepTask);
+}
+
+
+// Play a note from the song (step worker)..
+void songPlay(uint8_t pitch) {
+  if (pitch == songRest) {
+    songMute(true);
+    return;
+  }
+  if (pitch != songEnd) {
+    float_t noteFreq = noteFrequency(pitch & 0x0F, pitch >> 4);
+    fastSetFrequency(songPlayer.mode, noteFreq, songPlayer.buffLen);
+    frequency = noteFreq;
+  }
+  songMute(false);
+}
+
+
+// Silence (for rests) without stopping the signal..
+void songMute(bool mute) {
+  if (mute == songPlayer.muted) return;
+  songPlayer.muted = mute;
+  switch (songPlayer.mode) {
+    case 'r' :
+      ledcWrite(PWMChannel, (mute) ? 0 : (ledcSteps() * pulse) / 100.0);
+      break;
+    case 's' :
+      if (mute) {
+        CLEAR_PERI_REG_MASK(SENS_SAR_DAC_CTRL1_REG, SENS_SW_TONE_EN);
+      } else {
+        SET_PERI_REG_MASK(SENS_SAR_DAC_CTRL1_REG, SENS_SW_TONE_EN);
+      }
+      break;
+    case 't' :
+      if (useDDS) {
+        // The phase stops; so does the wave. The word comes back afterwards, unless the next note
+        // has already set its own (a song can end, or be stopped, on a rest)..
+        if (mute) {
+          songPlayer.mutedWord = ddsTuningWord;
+          ddsTuningWord = 0;
+        } else if (ddsTuningWord == 0) {
+          ddsTuningWord = songPlayer.mutedWord;
+        }
+      } else {
+        // Regular triangle; the buffer keeps going round, the DAC stops playing it..
+        i2s_set_dac_mode((mute) ? I2S_DAC_CHANNEL_DISABLE : I2S_DAC_CHANNEL_BOTH_EN);
+      }
+      break;
+  }
+}
+
+
+String songReport() {
+  char sbuf[256];
+  sprintf(sbuf, "\n Song: %u notes @ %u bpm%s\n", songHead.length, songHead.tempo, \
+                                                  (songPlayer.playing) ? " [playing]" : "");
+  if (songPlayer.notes) sprintf(sbuf + strlen(sbuf), "\tNotes played:\t%u\n\tLatest note:\t%uus\n", \
+                                                                    songPlayer.notes, songPlayer.lateMax);
+  if (songPlayer.dropped) sprintf(sbuf + strlen(sbuf), "\tNotes dropped:\t%u\n", songPlayer.dropped);
+  return (String)sbuf;
 }
 
 
@@ -1865,7 +3816,7 @@ uint32_t playMusicalNote(String musicData) {
 bool setAmplitude(uint8_t newAmp) {
   if (newAmp > 0 && newAmp <= 4) {
     waveAmplitude = newAmp;
-    prefs.putUChar("a", waveAmplitude);
+    cacheSetting('a', waveAmplitude);
     return true;
   }
   return false;
@@ -1888,7 +3839,7 @@ bool setAmplitude(uint8_t newAmp) {
 
 */
 String directDACVolts(float_t voltsValue) {
-  if (voltsValue > 3.3) Serial.printf(" Value exceeds 3.3! Will be automatically limited to 3.3\n");
+  if (voltsValue > 3.3 && !binaryMode) Serial.printf(" Value exceeds 3.3! Will be automatically limited to 3.3\n");
   uint16_t vV = min((int)(voltsValue * 100), 330); // map() uses integer math
   uint8_t newVal = map(vV, 0, 330, 0, 255);
   String ret = "Writing Mapped value (0-255): " + (String)newVal + " to DAC.\n";
@@ -1919,7 +3870,7 @@ void frequencyStepUP(int8_t stepSource) {
   if (stepsObeyLimits) checkLimits(frequency);
   // the compiler will sort this out! (for readability..)
   if ((stepSource == 0 && storeTouch == true) || (stepSource >= 1 && storeButton == true)) {
-    prefs.putFloat("f", frequency);
+    cacheSetting('f', frequency);
   }
   if (stepSource == 3) {
     LastMessage = "Frequency UP to " + makeHumanFrequency(frequency);
@@ -1937,7 +3888,7 @@ void frequencyStepDOWN(int8_t stepSource) {
   frequency -= fStep;
   if (stepsObeyLimits) checkLimits(frequency);
   if ((stepSource == 0 && storeTouch == true) || (stepSource == 1 && storeButton == true)) {
-    prefs.putFloat("f", frequency);
+    cacheSetting('f', frequency);
   }
   if (stepSource == 3) {
     LastMessage = "Frequency DOWN to " + makeHumanFrequency(frequency);
@@ -1971,7 +3922,7 @@ String stepFROM(int8_t stepSource) {
 bool setPulseStep(int8_t newStepSize) {
   if (newStepSize > 0 && newStepSize <= 100) {
     pStep = newStepSize;
-    prefs.putUChar("j", pStep);
+    cacheSetting('j', pStep);
     return true;
   }
   return false;
@@ -1985,7 +3936,7 @@ int8_t setPulseWidth(int16_t newPulse, bool doSave = true) {
   if (newPulse > 100) newPulse = 100;
   if (newPulse < 0) newPulse = 0;
   pulse = newPulse;
-  if (doSave) prefs.putUChar("p", pulse);
+  if (doSave) cacheSetting('p', pulse);
   return pulse;
 }
 
@@ -2117,6 +4068,9 @@ void loadDefaultPrefs() {
                                */
 void loadPrefs(bool isPreset) {
 
+  // Anything still in the cache is newer than what's in flash..
+  commitSettings();
+
   // Signal settings..
   mode = prefs.getChar("m", mode);
   frequency =  prefs.getFloat("f", frequency);
@@ -2124,8 +4078,11 @@ void loadPrefs(bool isPreset) {
   pulse = prefs.getUChar("p", pulse);
   pStep = prefs.getUChar("j", pStep);
   PWMResBits = switchResolution(prefs.getUChar("b", PWMResBits), false);
+  autoBits = prefs.getBool("B", autoBits);
   touchMode = prefs.getChar("h", touchMode);
   waveAmplitude = prefs.getUChar("a", waveAmplitude);
+  if (prefs.getBytesLength("M") == sizeof(SGModulation)) prefs.getBytes("M", &modulation, sizeof(SGModulation));
+  if (prefs.getBytesLength("T") == sizeof(PulseTrain)) prefs.getBytes("T", &train, sizeof(PulseTrain));
 
   // Global Switches..  (loaded once at INIT only)
   if (!isPreset) {
@@ -2151,16 +4108,36 @@ void loadPrefs(bool isPreset) {
     exportALL = prefs.getBool("x", exportALL);
     if (eXi) Serial.printf(" Export ALL Settings: %s\n", exportALL ? "Enabled" : "Disabled");
 
+    syncRole = prefs.getChar("S", syncRole);
+    if (eXi && syncRole) Serial.printf(" Network Sync: %s\n", (syncRole == 'l') ? "Leader" : "Follower");
+
+    useDDS = prefs.getBool("d", useDDS);
+    if (eXi) Serial.printf(" Triangle DDS Mode: %s\n", useDDS ? "Enabled" : "Disabled");
+
+    // Dual Channel mode (enabled flag first, then its settings)..
+    if (prefs.getBytesLength("v") == sizeof(DualSettings) + 1) {
+      uint8_t dualData[sizeof(DualSettings) + 1];
+      prefs.getBytes("v", dualData, sizeof(dualData));
+      useDual = dualData[0] && useDDS;
+      memcpy(&dual, dualData + 1, sizeof(DualSettings));
+    }
+    if (eXi) Serial.printf(" Dual Channel Mode: %s\n", useDual ? "Enabled" : "Disabled");
+
     usePOT = prefs.getBool("u", usePOT);
     if (eXi) Serial.printf(" Use Potentiometer: %s\n", usePOT ? "Enabled" : "Disabled");
 
-    loopCommands = prefs.getString("o", loopCommands);
+    setLoop(prefs.getString("o", loopCommands));
     if (eXi && loopCommands != "") Serial.printf(" Default Loop/Macro: %s\n", loopCommands.c_str());
 
+    loadSong();
+    if (eXi && songHead.length) Serial.printf(" Song: %u notes @ %u bpm\n", songHead.length, songHead.tempo);
+
     cpuSpeed = prefs.getUInt("z", cpuSpeed);
     if (eXi) Serial.printf(" CPU Speed: %iMHz\n", cpuSpeed);
 
-    Serial.printf("\n Touch UP Pin: %i\n Touch DOWN Pin: %i\n", touchUPPin, touchDOWNPin);
+    commitInterval = prefs.getUInt("k", commitInterval);
+
+    if (haveTouch) Serial.printf("\n Touch UP Pin: %i\n Touch DOWN Pin: %i\n", touchUPPin, touchDOWNPin);
   }
 }
 
@@ -2220,34 +4197,16 @@ String copyPreset(uint8_t copyFrom, uint8_t copyTo) {
   if (copyFrom < 1 || copyFrom > presetMAX) return "Source " + _OUT_OF_RANGE_;
   if (copyTo < 1 || copyTo > presetMAX) return "Target " + _OUT_OF_RANGE_;
 
-  if (prefsSwitch(copyFrom)) {
-
-    // Sure, we could just write from one to the other, but this could potentially waste "entries",
-    // creating prefs that don't exist.
-    char Cmode = prefs.getChar("m", '~');
-    float_t Cfrequency =  prefs.getFloat("f", -1);
-    float_t CfStep = prefs.getFloat("s", -1);
-    char CtouchMode = prefs.getChar("h", '~');
-    uint8_t CwaveAmplitude = prefs.getUChar("a", '~');
-    uint8_t CPWMResBits = prefs.getUChar("b", '~');
-    uint8_t Cpulse = prefs.getUChar("p", '~');
-    uint8_t CpStep = prefs.getUChar("j", '~');
-    String CloopCommands = prefs.getString("o", "");
-    String CmyName = prefs.getString("n", "");
-    String newName = "(COPY)";
+  if (presetCatalog[copyFrom].exists) {
 
-    prefsSwitch(copyTo);
-    prefs.putChar("i", 1);
+    PresetBlob copy = presetCatalog[copyFrom].preset;
+    String CmyName = copy.name;
+    String newName = "(COPY)";
 
-    if (Cmode != '~') prefs.putChar("m", Cmode);
-    if (Cfrequency != -1) prefs.putFloat("f", Cfrequency);
-    if (CfStep != -1) prefs.putFloat("s", CfStep);
-    if (CtouchMode != '~') prefs.putChar("h", CtouchMode);
-    if (CwaveAmplitude != '~') prefs.putUChar("a", CwaveAmplitude);
-    if (CPWMResBits != '~') prefs.putUChar("b", CPWMResBits);
-    if (Cpulse != '~') prefs.putUChar("p", Cpulse);
-    if (CpStep != '~') prefs.putUChar("j", CpStep);
-    if (CloopCommands != "") prefs.putString("o", CloopCommands);
+    // Loops are stored on their own..
+    prefsSwitch(copyFrom);
+    String CloopCommands = prefs.getString("o", "");
+    prefsSwitch();
 
     // There is a name to copy..
     // This is the sort of code "no one" writes. erm..
@@ -2260,9 +4219,19 @@ String copyPreset(uint8_t copyFrom, uint8_t copyTo) {
         cNum = CmyName.substring(foundCpyPOS+5, CmyName.lastIndexOf(")")).toInt();
         newName = CmyName.substring(0, foundCpyPOS) + "(COPY" + (String)((cNum != 0) ? cNum += 1 : 2) + ")"; // Hah!
       }
-      prefs.putString("n", newName);
+      setPresetName(copy, newName);
+    } else {
+      // No name to copy; the target keeps its own..
+      setPresetName(copy, presetCatalog[copyTo].preset.name);
+    }
+
+    if (!putPreset(copyTo, copy)) return "Failed to copy preset!";
+
+    if (CloopCommands != "") {
+      prefsSwitch(copyTo);
+      prefs.putString("o", CloopCommands);
+      prefsSwitch();
     }
-    prefsSwitch();
     return "Preset copied OK";
   }
   return "Source Preset Not Found!";
@@ -2271,27 +4240,251 @@ String copyPreset(uint8_t copyFrom, uint8_t copyTo) {
 
 
 /*
-  Load a Preset..
+  Read this namespace's preset blob. False if there isn't one (or it's damaged).
+                                                                          */
+bool getPresetBlob(PresetBlob &blob) {
+  memset(&blob, 0, sizeof(PresetBlob));
+  size_t size = prefs.getBytesLength("y");
+  if (size == 0) return false;
+  uint8_t bytes[sizeof(PresetBlob)];
+  if (size > sizeof(bytes) || prefs.getBytes("y", bytes, size) != size || !presetFromBytes(bytes, size, blob)) {
+    if (eXi) Serial.printf(" Preset data in namespace %i is damaged!\n", prefsNamespace);
+    memset(&blob, 0, sizeof(PresetBlob));
+    return false;
+  }
+  return true;
+}
 
-  Presets are very simply stored the exact same way as your regular preferences, except with
-  "<number>" appended to the regular "sg" we normally use for a "NameSpace" name.
 
-                                     */
-String loadPreset(int8_t presetNumber) {
+/*
+  Check a stored (or imported) blob and bring it up to date. Version 1 blobs (no modulation) are
+  converted; they come back as the current version, with a new checksum..
+                                                                        */
+bool presetFromBytes(const uint8_t *bytes, size_t size, PresetBlob &blob) {
 
-  if (presetNumber < 0 || presetNumber > presetMAX) return _OUT_OF_RANGE_;
+  memset(&blob, 0, sizeof(PresetBlob));
 
-  // If young programmers would only learn this one simple thing, it would change lives..
-  bool presetExists = true;
-  //
-  // *ahem* young programmers; note how this variable is named after *exactly what it represents*
-  // and not HoneyBunny or foo2 or mVar or x or whatthefuckelse. Your code may (unbelievably) be of
-  // interest to *other* people, who have no clue what you mean by "funkDoodle". By "other people",
-  // I also mean YOU, five or ten years from now, looking at code YOU wrote thinking WTF is going
-  // on here?!? Trust me; memory is fickle. I can't even remember starting this sentence.
-  //
-  // What am I saying? In a decade there will be no more coders! Chat GPT et al FTW!
-  //
+  if (size == sizeof(PresetBlob)) {
+    memcpy(&blob, bytes, size);
+    return (blob.version == presetVersion && blob.checksum == presetChecksum(blob));
+  }
+
+  if (size == sizeof(PresetBlobV1)) {
+    PresetBlobV1 old;
+    memcpy(&old, bytes, size);
+    if (old.version != 1 || old.checksum != crc16((const uint8_t *)&old, offsetof(PresetBlobV1, checksum))) \
+                                                                                          return false;
+    blob.version = presetVersion;
+    blob.has = old.has;
+    blob.mode = old.mode;
+    blob.touchMode = old.touchMode;
+    blob.amplitude = old.amplitude;
+    blob.bits = old.bits;
+    blob.pulse = old.pulse;
+    blob.pStep = old.pStep;
+    blob.frequency = old.frequency;
+    blob.fStep = old.fStep;
+    memcpy(blob.name, old.name, sizeof(blob.name));
+    blob.checksum = presetChecksum(blob);
+    return true;
+  }
+
+  return false;
+}
+
+
+uint16_t presetChecksum(const PresetBlob &blob) {
+  return crc16((const uint8_t *)&blob, offsetof(PresetBlob, checksum));
+}
+
+
+// Save a preset; blob to flash, copy to RAM..
+bool putPreset(uint8_t presetNumber, PresetBlob &blob) {
+  if (presetNumber < 1 || presetNumber > presetMAX) return false;
+  PhaseTimer timer(PHASE_NVS);
+  blob.version = presetVersion;
+  blob.checksum = presetChecksum(blob);
+  prefsSwitch(presetNumber);
+  // Create an id so that in future we can check for a preset's existence..
+  if (!presetCatalog[presetNumber].exists) prefs.putChar("i", 1);
+  bool saved = (prefs.putBytes("y", &blob, sizeof(PresetBlob)) == sizeof(PresetBlob));
+  prefsSwitch();
+  // RAM only ever holds what made it into the flash..
+  if (!saved) return false;
+  presetCatalog[presetNumber].exists = true;
+  presetCatalog[presetNumber].preset = blob;
+  return true;
+}
+
+
+void setPresetName(PresetBlob &blob, const String &name) {
+  strncpy(blob.name, name.c_str(), presetNameMAX);
+  blob.name[presetNameMAX] = '\0';
+}
+
+
+/*
+  Read the settings stored in this namespace the old (and defaults) way, one key each..
+                                                                              */
+void getPresetKeys(PresetBlob &blob) {
+  memset(&blob, 0, sizeof(PresetBlob));
+  if ((blob.mode = prefs.getChar("m", '~')) != '~') blob.has |= HAS_MODE;
+  if ((blob.frequency = prefs.getFloat("f", -1)) != -1) blob.has |= HAS_FREQ;
+  if ((blob.fStep = prefs.getFloat("s", -1)) != -1) blob.has |= HAS_STEP;
+  if ((blob.touchMode = prefs.getChar("h", '~')) != '~') blob.has |= HAS_TOUCH;
+  if ((blob.amplitude = prefs.getUChar("a", '~')) != '~') blob.has |= HAS_AMP;
+  if ((blob.bits = prefs.getUChar("b", '~')) != '~') blob.has |= HAS_BITS;
+  if ((blob.pulse = prefs.getUChar("p", '~')) != '~') blob.has |= HAS_PULSE;
+  if ((blob.pStep = prefs.getUChar("j", '~')) != '~') blob.has |= HAS_PSTEP;
+  SGModulation mod;
+  if (prefs.getBytesLength("M") == sizeof(SGModulation) && prefs.getBytes("M", &mod, sizeof(mod))) {
+    blob.modType = mod.type;
+    blob.modDepth = mod.depth;
+    blob.modRate = mod.rate;
+    blob.has |= HAS_MOD;
+  }
+}
+
+// .. and write them..
+void putPresetKeys(const PresetBlob &blob) {
+  if (blob.has & HAS_MODE) prefs.putChar("m", blob.mode);
+  if (blob.has & HAS_FREQ) prefs.putFloat("f", blob.frequency);
+  if (blob.has & HAS_STEP) prefs.putFloat("s", blob.fStep);
+  if (blob.has & HAS_TOUCH) prefs.putChar("h", blob.touchMode);
+  if (blob.has & HAS_AMP) prefs.putUChar("a", blob.amplitude);
+  if (blob.has & HAS_BITS) prefs.putUChar("b", blob.bits);
+  if (blob.has & HAS_PULSE) prefs.putUChar("p", blob.pulse);
+  if (blob.has & HAS_PSTEP) prefs.putUChar("j", blob.pStep);
+  if (blob.has & HAS_MOD) {
+    SGModulation mod = { blob.modType, blob.modDepth, blob.modRate };
+    prefs.putBytes("M", &mod, sizeof(mod));
+  }
+}
+
+// .. and remove them.
+void removePresetKeys() {
+  prefs.remove("m");
+  prefs.remove("f");
+  prefs.remove("s");
+  prefs.remove("h");
+  prefs.remove("a");
+  prefs.remove("b");
+  prefs.remove("p");
+  prefs.remove("j");
+  prefs.remove("M");
+}
+
+
+/*
+  The settings stored for a preset (from RAM), or the defaults (0, from the main namespace).
+  Returns false if there's no such preset.
+                                          */
+bool readSettings(uint8_t presetNumber, PresetBlob &blob) {
+  if (presetNumber > presetMAX) {
+    memset(&blob, 0, sizeof(PresetBlob));
+    return false;
+  }
+  if (presetNumber != 0) {
+    blob = presetCatalog[presetNumber].preset;
+    return presetCatalog[presetNumber].exists;
+  }
+  commitSettings();
+  getPresetKeys(blob);
+  return true;
+}
+
+
+// Make a preset's settings the current settings (just like loadPrefs(), but without the reads)..
+void applyPreset(const PresetBlob &blob) {
+  if (blob.has & HAS_MODE) mode = blob.mode;
+  if (blob.has & HAS_FREQ) frequency = blob.frequency;
+  if (blob.has & HAS_STEP) fStep = blob.fStep;
+  if (blob.has & HAS_PULSE) pulse = blob.pulse;
+  if (blob.has & HAS_PSTEP) pStep = blob.pStep;
+  if (blob.has & HAS_BITS) PWMResBits = switchResolution(blob.bits, false);
+  if (blob.has & HAS_TOUCH) touchMode = blob.touchMode;
+  if (blob.has & HAS_AMP) waveAmplitude = blob.amplitude;
+  if (blob.has & HAS_MOD) modulation = { blob.modType, blob.modDepth, blob.modRate };
+}
+
+
+/*
+  Once, at boot: read every preset into RAM.
+
+  Presets saved by older versions (one key per setting) get moved into a blob as we go; they load
+  exactly as before, only faster. Older blobs get rewritten at the current version. This also
+  creates the preset namespaces on the very first run.
+                                                                                    */
+String loadCatalog() {
+
+  uint8_t found = 0, moved = 0;
+  String shortened;
+
+  for (uint8_t i = 1; i <= presetMAX; i++) {
+    presetCatalog[i].exists = prefsSwitch(i);
+    if (!presetCatalog[i].exists) continue;
+    found++;
+    PresetBlob &blob = presetCatalog[i].preset;
+    if (getPresetBlob(blob)) {
+      // Saved by an older version? Store it the current way..
+      if (prefs.getBytesLength("y") != sizeof(PresetBlob) && \
+                          prefs.putBytes("y", &blob, sizeof(PresetBlob)) == sizeof(PresetBlob)) moved++;
+      continue;
+    }
+    if (prefs.getBytesLength("y") != 0) continue;
+
+    // Old-style preset?
+    getPresetKeys(blob);
+    String myName = prefs.getString("n", "");
+    if (blob.has == 0 && myName == "") continue; // Just loops in here.
+    // Old names had no limit; the blob has room for presetNameMAX characters..
+    if (myName.length() > presetNameMAX) shortened += " " + (String)i;
+    setPresetName(blob, myName);
+    blob.version = presetVersion;
+    blob.checksum = presetChecksum(blob);
+    if (prefs.putBytes("y", &blob, sizeof(PresetBlob)) == sizeof(PresetBlob)) {
+      removePresetKeys();
+      prefs.remove("n");
+      moved++;
+    }
+  }
+  prefsSwitch();
+  catalogReady = true;
+
+  char cbuf[128];
+  sprintf(cbuf, " Presets: %u stored", found);
+  if (moved) sprintf(cbuf + strlen(cbuf), " (%u converted to the new format)", moved);
+  if (shortened != "") {
+    return (String)cbuf + "\n Preset names cut to " + (String)presetNameMAX + \
+                                    " characters in presets:" + shortened + getFreeEntries();
+  }
+  return (String)cbuf + getFreeEntries();
+}
+
+
+
+/*
+  Load a Preset..
+
+  Presets are very simply stored the exact same way as your regular preferences, except with
+  "<number>" appended to the regular "sg" we normally use for a "NameSpace" name.
+
+                                     */
+String loadPreset(int8_t presetNumber) {
+
+  if (presetNumber < 0 || presetNumber > presetMAX) return _OUT_OF_RANGE_;
+
+  // If young programmers would only learn this one simple thing, it would change lives..
+  bool presetExists = true;
+  //
+  // *ahem* young programmers; note how this variable is named after *exactly what it represents*
+  // and not HoneyBunny or foo2 or mVar or x or whatthefuckelse. Your code may (unbelievably) be of
+  // interest to *other* people, who have no clue what you mean by "funkDoodle". By "other people",
+  // I also mean YOU, five or ten years from now, looking at code YOU wrote thinking WTF is going
+  // on here?!? Trust me; memory is fickle. I can't even remember starting this sentence.
+  //
+  // What am I saying? In a decade there will be no more coders! Chat GPT et al FTW!
+  //
   // I should add, once the code passes through the compiler, the variable names go POOF! Vanishing
   // into machine instructions, jumping around memory registers... Tokens. Readability will always
   // trump any other imagined improvements. Humans first!
@@ -2301,21 +4494,29 @@ String loadPreset(int8_t presetNumber) {
   // Preset 0 is special - it's the main preset (0 used internally only, there is no "sg0" preset)
   if (presetNumber == 0) {
     retStr += "Defaults: ";
-  } else {
-    // Check this preset exists..
-    if (prefsSwitch(presetNumber)) {
-      retStr += "Preset " + (String)presetNumber + " '" + prefs.getString("n") + "': ";
-    } else {
-      presetExists = false;
-    }
-  }
+    loadPrefs(true);
 
-  // Load prefs as usual..
-  if (presetExists) loadPrefs(true);
+  // Check this preset exists (no need to ask the flash)..
+  } else if (presetCatalog[presetNumber].exists) {
+    // One read. If flash and RAM ever disagree, flash wins..
+    PresetBlob blob;
+    prefsSwitch(presetNumber);
+    bool blobRead = getPresetBlob(blob);
+    bool blobDamaged = (!blobRead && prefs.getBytesLength("y") != 0);
+    prefsSwitch();
+    // .. unless the flash is damaged, in which case nothing changes; not the catalog, not the signal.
+    if (blobDamaged) return "Preset " + (String)presetNumber + " is damaged! Not loaded (save over it to fix it)";
+    // (No blob at all is a loops-only preset, or one loadCatalog() couldn't move; RAM has it.)
+    if (blobRead) presetCatalog[presetNumber].preset = blob;
+    else blob = presetCatalog[presetNumber].preset;
+    retStr += "Preset " + (String)presetNumber + " '" + (String)blob.name + "': ";
+    applyPreset(blob);
 
-  // Back to regular prefs..
-  if (presetNumber != 0) prefsSwitch();
+  } else {
+    presetExists = false;
+  }
 
+  if (presetExists) pushEvent("preset", (String)presetNumber);
   return (presetExists) ? retStr + "OK" : "No Such Preset!";
 }
 
@@ -2332,58 +4533,65 @@ String savePreset(int8_t presetNumber, bool defaults = false) {
   String ret = "Saving Defaults: ";
 
   // For layering, we save only settings which have been manually set (to defaults).
-  // So we grab those (checking they exist) before we switch to the preset's preferences namespace.
-
-  char lMode = prefs.getChar("m", '~');       // Mode
-  float_t lFreq = prefs.getFloat("f", -1);    // Frequency
-  float_t lStep = prefs.getFloat("s", -1);    // Frequency Step Size
-  char lTcMd = prefs.getChar("h", '~');       // Touch Handler
-  uint8_t lAMP = prefs.getUChar("a", '~');    // Wave Amplitude
-  uint8_t lBits = prefs.getUChar("b", '~');   // Resolution Bit Depth
-  uint8_t lPulse = prefs.getUChar("p", '~');  // Pulse Width (Duty Cycle)
-  uint8_t lpStep = prefs.getUChar("j", '~');  // PWM Step Size
+  // So we grab those (checking they exist)..
+  PresetBlob stored;
+  readSettings(0, stored);
 
-  if (presetNumber != 0) {
-    ret = "Saving Preset " + (String)presetNumber + ": ";
-    prefsSwitch(presetNumber);
-    // Create an id so that in future we can check for a preset's existence..
-    prefs.putChar("i", 1);
-    // If it doesn't have an id (==1),
-    // it's just an empty preset space (or rather, "NameSpace") which we will ignore.
-  }
+  // Whatever is already in the preset stays, unless we overwrite it..
+  PresetBlob save;
+  readSettings(presetNumber, save);
 
   if (layerPresets && !defaults) {
 
-    // Layering uses the absolute minimum "entries" to save a preset..
-
-    if (lMode != '~') prefs.putChar("m", lMode);
-    if (lFreq != -1) prefs.putFloat("f", lFreq);
-    if (lStep != -1) prefs.putFloat("s", lStep);
-    if (lTcMd != '~') prefs.putChar("h", lTcMd);
-    if ((mode != 'r' || saveALL) && lAMP != '~') prefs.putUChar("a", lAMP);
-    if ((mode == 'r' || saveALL) && lBits != '~') prefs.putUChar("b", lBits);
-    if ((mode != 's' || saveALL) && lPulse != '~') prefs.putUChar("p", lPulse);
-    if ((mode != 's' || saveALL) && lpStep != '~') prefs.putUChar("j", lpStep);
+    // Layering uses the absolute minimum to save a preset..
+    uint16_t layer = HAS_MODE | HAS_FREQ | HAS_STEP | HAS_TOUCH | HAS_MOD;
+    if (mode != 'r' || saveALL) layer |= HAS_AMP;
+    if (mode == 'r' || saveALL) layer |= HAS_BITS;
+    if (mode != 's' || saveALL) layer |= HAS_PULSE | HAS_PSTEP;
+    layer &= stored.has;
+
+    if (layer & HAS_MODE) save.mode = stored.mode;
+    if (layer & HAS_FREQ) save.frequency = stored.frequency;
+    if (layer & HAS_STEP) save.fStep = stored.fStep;
+    if (layer & HAS_TOUCH) save.touchMode = stored.touchMode;
+    if (layer & HAS_AMP) save.amplitude = stored.amplitude;
+    if (layer & HAS_BITS) save.bits = stored.bits;
+    if (layer & HAS_PULSE) save.pulse = stored.pulse;
+    if (layer & HAS_PSTEP) save.pStep = stored.pStep;
+    if (layer & HAS_MOD) {
+      save.modType = stored.modType;
+      save.modDepth = stored.modDepth;
+      save.modRate = stored.modRate;
+    }
+    save.has |= layer;
 
   } else {
 
     // No layering - simply save "all" (/applicable) current settings..
-
-    prefs.putChar("m", mode);
-    prefs.putFloat("f", frequency);
-    prefs.putFloat("s", fStep);
-    prefs.putChar("h", touchMode);
-    if (mode != 'r' || saveALL) prefs.putUChar("a", waveAmplitude);
-    if (mode == 'r' || saveALL) prefs.putUChar("b", PWMResBits);
-    if (mode != 's' || saveALL) prefs.putUChar("p", pulse);
-    if (mode != 's' || saveALL) prefs.putUChar("j", pStep);
+    save.mode = mode;
+    save.frequency = frequency;
+    save.fStep = fStep;
+    save.touchMode = touchMode;
+    save.amplitude = waveAmplitude;
+    save.bits = PWMResBits;
+    save.pulse = pulse;
+    save.pStep = pStep;
+    save.modType = modulation.type;
+    save.modDepth = modulation.depth;
+    save.modRate = modulation.rate;
+    save.has |= HAS_MODE | HAS_FREQ | HAS_STEP | HAS_TOUCH | HAS_MOD;
+    if (mode != 'r' || saveALL) save.has |= HAS_AMP;
+    if (mode == 'r' || saveALL) save.has |= HAS_BITS;
+    if (mode != 's' || saveALL) save.has |= HAS_PULSE | HAS_PSTEP;
   }
 
-  if (prefs.getChar("i") == 1) ret += "OK"; // Looks Good
-
   if (presetNumber != 0) {
-    prefsSwitch();
+    ret = "Saving Preset " + (String)presetNumber + ": ";
+    // One blob, one write..
+    if (putPreset(presetNumber, save)) ret += "OK"; // Looks Good
   } else {
+    putPresetKeys(save);
+    if (prefs.getChar("i") == 1) ret += "OK";
     ret += " (Saving current settings to DEFAULTS  - will persist on reboot).";
   }
 
@@ -2458,13 +4666,14 @@ String namePreset(String presetNameData) {
   if (presetNAME == "") success = -4;
 
   if (success == -1) {
-    prefsSwitch(presetNUM.toInt());
-    if (prefs.getChar("i", -1) != -1) {
-      if (prefs.putString("n", presetNAME) != 0) success = 0;
+    if (presetCatalog[NUM].exists) {
+      PresetBlob blob = presetCatalog[NUM].preset;
+      presetNAME = presetNAME.substring(0, presetNameMAX); // It has to fit
+      setPresetName(blob, presetNAME);
+      if (putPreset(NUM, blob)) success = 0;
     } else {
       success = -2;
     }
-    prefsSwitch();
   }
 
   String result;
@@ -2485,8 +4694,9 @@ String namePreset(String presetNameData) {
     default: // 0
       // NOTE: the web controller looks for this *exact* text to switch out the button titles
       // on-the-fly when you rename a preset with the built-in console. If you make changes to
-      // the text here, you should also change the text in getCommandStatus(), inside WebPage.h
+      // the text here, you should also change the text in commandOutput(), inside WebPage.h
       result = "Set name of preset [" + presetNUM + "] to \"" + presetNAME + "\"";
+      pushEvent("names", ""); // Pages with live events just fetch the names again.
   }
 
   return result;
@@ -2503,10 +4713,8 @@ String namePreset(String presetNameData) {
   Way cooler than lesser mortals might think.
                                          */
 String getPresetName(uint8_t thisPreset) {
-  prefsSwitch(thisPreset);
-  String myName = prefs.getString("n", "");
-  prefsSwitch();
-  return myName;
+  if (thisPreset < 1 || thisPreset > presetMAX) return "";
+  return (String)presetCatalog[thisPreset].preset.name; // From RAM. Nice and quick.
 }
 
 
@@ -2526,52 +4734,39 @@ bool wipePreset(int8_t presetNumber) {
 
   if (presetNumber > presetMAX) return false;
 
+  // It may already be cleared (or not exist)..
+  PresetBlob blob;
+  if (!readSettings(presetNumber, blob) || blob.has == 0) return false;
+
   bool cleared = false;
 
   if (presetNumber != 0) prefsSwitch(presetNumber);
 
-  // It may already be cleared..
-  if (presetEmpty()) {
-
-    cleared = false;
+  // Loops stored here, remove only the settings..
+  bool hasLoops = (prefs.getString("o", "") != "");
+  if (hasLoops) {
+    if (presetNumber == 0) removePresetKeys();
+    blob.has = 0; // (the name stays)
+    cleared = true;
 
   } else {
 
-    // Check this preset exists. If so, wipe it.
-    if (prefs.getChar("i", -1) != -1) {
-
-      // Loops stored here, remove individual keys..
-      String wLoops = prefs.getString("o", "");
-      if (wLoops != "") {
-        prefs.remove("m");
-        prefs.remove("f");
-        prefs.remove("s");
-        prefs.remove("h");
-        prefs.remove("a");
-        prefs.remove("b");
-        prefs.remove("p");
-        prefs.remove("j");
-        cleared = true;
-
-      } else {
-
-        // No loops here. We can do a proper clear().
-        cleared = prefs.clear();
-      }
-
-    } else {
-
-      // No such preset..
-      cleared = false;
-    }
-
+    // No loops here. We can do a proper clear().
+    cleared = prefs.clear();
   }
+
   if (presetNumber != 0) {
     prefsSwitch();
+    if (hasLoops) {
+      putPreset(presetNumber, blob);
+    } else if (cleared) {
+      memset(&presetCatalog[presetNumber], 0, sizeof(CatalogEntry));
+    }
   } else {
     prefs.putChar("i", 1); // Now it's a "real" Pinocchio, erm, preset.
   }
 
+  if (cleared) pushEvent("names", ""); // Web pages; fetch the preset names again.
   return cleared;
 }
 
@@ -2580,23 +4775,13 @@ bool wipePreset(int8_t presetNumber) {
 /*
   Check if there are any settings in a preset (used for loop/preset wipes).
 
-  Remember to switchPrefs(*) before you call this.
-
-  Returns true if the /current/ preset namespace is empty of signal settings (of which there are 8).
+  Returns true if the preset (or defaults, 0) is empty of signal settings (of which there are 8).
   See inside loop() for a list of which letter means what.
 
                    */
-bool presetEmpty() {
-  bool isEmpty = true;
-  if (prefs.getChar("m", '~') != '~') isEmpty = false;
-  if (prefs.getFloat("f", -1) != -1) isEmpty = false;
-  if (prefs.getFloat("s", -1) != -1) isEmpty = false;
-  if (prefs.getChar("h", '~') != '~') isEmpty = false;
-  if (prefs.getUChar("a", '~') != '~') isEmpty = false;
-  if (prefs.getUChar("b", '~') != '~') isEmpty = false;
-  if (prefs.getUChar("p", '~') != '~') isEmpty = false;
-  if (prefs.getUChar("j", '~') != '~') isEmpty = false;
-  return isEmpty;
+bool presetEmpty(uint8_t presetNumber) {
+  PresetBlob blob;
+  return (!readSettings(presetNumber, blob) || blob.has == 0);
 }
 
 
@@ -2728,16 +4913,23 @@ String getCurrentSettings() {
         wForm = "\u25B3"; //  △
     }
   }
-  char buffer[164];
+  char buffer[512];
   sprintf(buffer, "\t%s Wave %s %s\n", \
     makeHumanMode(mode).c_str(), wForm.c_str(), makeHumanFrequency(frequency).c_str());
+  if (mode == 't' && useDDS) sprintf(buffer + strlen(buffer), "\tDDS @ %s (error: %.5fHz)\n", \
+                                                  makeHumanFrequency(ddsSampleRate).c_str(), triError);
+  if (mode == 't' && useDual) sprintf(buffer + strlen(buffer), "\tDual Channel: %s Wave %s on pin 26\n", \
+                                    makeHumanMode(dual.waveB).c_str(), makeHumanFrequency(dual.frequencyB).c_str());
   if (mode != 's') sprintf(buffer + strlen(buffer), "\tPulse Width: %i%%\n", pulse);
   // Resolution should not matter for Triangle wave. No really. Hmm.
-  if (mode == 'r') sprintf(buffer + strlen(buffer), "\tPWM Resolution: %i bit%c\n", PWMResBits, bpl);
+  if (mode == 'r') sprintf(buffer + strlen(buffer), "\tPWM Resolution: %i bit%c%s%s (duty steps of %.4g%%)\n", \
+                  (autoBits) ? ledcBits() : PWMResBits, bpl, (autoBits) ? " [auto]" : "", \
+                                                          resolutionNote().c_str(), 100.0 / ledcSteps());
   sprintf(buffer + strlen(buffer), "\tFreq Step Size: %s\n", makeHumanFrequency(fStep).c_str());
   if (mode != 's') sprintf(buffer + strlen(buffer), "\tPWM Step Size: %i%%\n", pStep);
   if (mode != 'r') sprintf(buffer + strlen(buffer), "\tAmplitude Level: %i\n", waveAmplitude);
   sprintf(buffer + strlen(buffer), "\tTouch Mode: %s\n", makeHumanTouchMode(touchMode).c_str());
+  if (modulation.type) sprintf(buffer + strlen(buffer), "\t%s\n", modulationReport().c_str());
 
   return (String)buffer;
 }
@@ -2754,7 +4946,8 @@ String getCurrentSettings() {
  aka. "Help".
                      */
 String getCommands() {
-  char cbuf[3000];
+  // Static, as it has outgrown the loop() task's stack. It's only ever used from here.
+  static char cbuf[6144];
   sprintf(cbuf, "\n Commands:\n\n");
   sprintf(cbuf + strlen(cbuf), "\ts              Sine Wave\n");
   sprintf(cbuf + strlen(cbuf), "\tr              Rectangle / Square Wave\n");
@@ -2762,7 +4955,8 @@ String getCommands() {
   sprintf(cbuf + strlen(cbuf), "\t'              Cycle through Rectangle > Sine > Triangle Waves\n");
   sprintf(cbuf + strlen(cbuf), "\t*[k/m]         Frequency [Hz/kHz/MHz]\n");
   sprintf(cbuf + strlen(cbuf), "\t+/-*[k/m]      Increase/Decrease Frequency by *[Hz/kHz/MHz]\n");
-  sprintf(cbuf + strlen(cbuf), "\tb*             Resolution Bit Depth [1-10]\n");
+  sprintf(cbuf + strlen(cbuf), "\tf?[*[k/m]]     Nearest Achievable Frequency [to *] (without changing signal)\n");
+  sprintf(cbuf + strlen(cbuf), "\tb*             Resolution Bit Depth [1-10] (or \"b auto\")\n");
   sprintf(cbuf + strlen(cbuf), "\tp*             Pulse Width (Duty Cycle ~ percent[0-100]) \n");
   sprintf(cbuf + strlen(cbuf), "\ts*[k/m]        Step size for Frequency [Hz/kHz/MHz]\n");
   sprintf(cbuf + strlen(cbuf), "\tj*             Step size for Pulse Width (Jump!) [1-100]\n");
@@ -2787,6 +4981,11 @@ String getCommands() {
   sprintf(cbuf + strlen(cbuf), "\tl              Load Stored Default Signal Settings\n");
   sprintf(cbuf + strlen(cbuf), "\tbuttons        Print Out Current Physical Button Control Assignments\n");
   sprintf(cbuf + strlen(cbuf), "\tsa[e/d]        Toggle Save ALL Settings [enable/disable]\n");
+  sprintf(cbuf + strlen(cbuf), "\tdds[e/d]       Toggle Triangle DDS Mode (0.01Hz resolution) [enable/disable]\n");
+  sprintf(cbuf + strlen(cbuf), "\tdual[e/d/?]    Toggle Dual Channel Mode (two waves, pins 25 & 26) [enable/disable/info]\n");
+  sprintf(cbuf + strlen(cbuf), "\tdual[1/2] *    Set Dual Channel [1/2] (w=t/s/r/w/n,f=*,p=*,a=*,o=*)\n");
+  sprintf(cbuf + strlen(cbuf), "\tmod * ? ~      Modulation: * = am/fm/pwm/off, ? = depth %%, ~ = rate Hz (mod? for info)\n");
+  sprintf(cbuf + strlen(cbuf), "\ttrain[ *]      Pulse Train on the RMT [f=*,w=*,n=*,g=*,s=*/*] (train? / train stop)\n");
   sprintf(cbuf + strlen(cbuf), "\tea[e/d]        Toggle (Individual) Export ALL Settings [enable/disable]\n");
   sprintf(cbuf + strlen(cbuf), "\trt[e/d]        Toggle the Reporting of Touches [enable/disable]\n");
   sprintf(cbuf + strlen(cbuf), "\tup[e/d]        Toggle Use Potentiometer Control [enable/disable]\n");
@@ -2795,14 +4994,32 @@ String getCommands() {
   sprintf(cbuf + strlen(cbuf), "\tw[*]           Wipe Stored Signal Settings [for Preset *]\n");
   sprintf(cbuf + strlen(cbuf), "\twipe           WIPE ENTIRE NVRAM (and reboot). Careful now!\n");
   sprintf(cbuf + strlen(cbuf), "\texport[*/all]  Export Importable Settings [for preset/all]\n");
+  sprintf(cbuf + strlen(cbuf), "\texport all compact  Export ALL as base64 (one line per preset)\n");
   sprintf(cbuf + strlen(cbuf), "\timport *       Please Read The Fine Manual!\n");
   sprintf(cbuf + strlen(cbuf), "\tloop[*]=[?]    Load [?] Commands into Loop/Macro [number *] (RTFM!)\n");
   sprintf(cbuf + strlen(cbuf), "\tloop[*]        Start Playing Loop/Macro [number *] (RTFM!)\n");
+  sprintf(cbuf + strlen(cbuf), "\trepeat*[:?]    In Loops: Repeat [?] or Block (up to \"next\") * Times\n");
+  sprintf(cbuf + strlen(cbuf), "\tf+=* / p+=*    In Loops: Ramp Frequency / Pulse Width by * (also f-= / p-=)\n");
   sprintf(cbuf + strlen(cbuf), "\tend            End the Currently Playing Queue/Loop/Macro\n");
   sprintf(cbuf + strlen(cbuf), "\t@*             Set * Volts directly on the DAC Pin (0 - 3.3).\n");
   sprintf(cbuf + strlen(cbuf), "\tstop/.         Stop the Currently Playing Signal (enter to restart)\n");
   sprintf(cbuf + strlen(cbuf), "\tll[l]          List Loops/Macros (if available) [single importable list]\n");
   sprintf(cbuf + strlen(cbuf), "\tmem            Print Out Memory Usage Information\n");
+  sprintf(cbuf + strlen(cbuf), "\tsong=* ?       Load Song at * bpm, ? = Notes, e.g. song=120 c4 e g/8 c5/2 (RTFM!)\n");
+  sprintf(cbuf + strlen(cbuf), "\tsong[rep/?]    Play Song [on Repeat] / Song Info (song end to Stop)\n");
+  sprintf(cbuf + strlen(cbuf), "\tsweep * ? ~    Sweep From * to ? Over ~ ms [lin/log] [once/rep] (RTFM!)\n");
+  sprintf(cbuf + strlen(cbuf), "\tsweep[?/ end]  Report Sweep (and Actual Update Rate) / End Sweep\n");
+  sprintf(cbuf + strlen(cbuf), "\tat*:?          Timed Event: Frequency/Pulse Width/Mode Change ? at * ms (RTFM!)\n");
+  sprintf(cbuf + strlen(cbuf), "\tat[?/c/z]      Timed Events: Report Lateness / Clear / Zero the Sequence Time\n");
+  sprintf(cbuf + strlen(cbuf), "\tsync [*]       Network Sync: * = leader / follow / off (? or nothing to Report)\n");
+  sprintf(cbuf + strlen(cbuf), "\tsync *:?       (Leader) Timed Event ? on Every Unit in * ms (e.g. sync 500:go)\n");
+  sprintf(cbuf + strlen(cbuf), "\tbinary[?]      Switch Serial to Binary Frames (for test equipment - RTFM!) [statistics]\n");
+  sprintf(cbuf + strlen(cbuf), "\tcache[*]       Settings Cache Statistics [write to flash after * ms quiet]\n");
+  sprintf(cbuf + strlen(cbuf), "\tqueue          Command Queue Statistics (waiting, queued & dropped per source)\n");
+  sprintf(cbuf + strlen(cbuf), "\tkernels[*]     Benchmark & Check the Waveform Kernels [* samples each, up to 1000000]\n");
+  sprintf(cbuf + strlen(cbuf), "\tstats[ reset]  Performance Metrics (loop phase times, heap, commands per source)\n");
+  sprintf(cbuf + strlen(cbuf), "\tbuild          Build Features, Flash/RAM Size & loop() Rate\n");
+  sprintf(cbuf + strlen(cbuf), "\tbench[*]       Benchmark the Current Loop/Macro for * Commands (default 1000)\n");
   sprintf(cbuf + strlen(cbuf), "\tcpu*           Set CPU Frequency to *[240/160/80] MHz%s\n", \
                                                                    RemControl ? " (and reboot)" : "");
   sprintf(cbuf + strlen(cbuf), "\tremote[e/d]    Remote Control Toggle [Enable/Disable]\n");
@@ -2812,153 +5029,2465 @@ String getCommands() {
 }
 
 
-/*
-  Print contents of NVS/NVRAM (settings); either the default settings or for a preset.
+/*
+  Print contents of NVS/NVRAM (settings); either the default settings or for a preset.
+
+  Don't assign anything, just print out what's stored in the NVRAM..
+
+  (Presets are printed from their copy in RAM, which is always the same as what's in the NVRAM.)
+                                                                                   */
+String getNVRAMPresetData(uint8_t presetNumber = 0, bool listing = false) {
+
+  // Presets come from RAM (see loadCatalog()), defaults from the main namespace..
+  PresetBlob blob;
+  if (!readSettings(presetNumber, blob)) {
+    if (!listing) LastMessage = (presetNumber > presetMAX) ? _OUT_OF_RANGE_ : \
+                                        "Preset " + (String)presetNumber + " does not exist";
+    return "";
+  }
+
+  char nvbuf[1024] = {'\0'};
+  if (presetNumber != 0) {
+    if (blob.has != 0) {
+      sprintf(nvbuf, "\n NVRAM Settings for Preset %i: ", presetNumber);
+      if (blob.name[0] != '\0') {
+        sprintf(nvbuf + strlen(nvbuf), "\n\n\t\"%s\"\n\n", blob.name);
+      } else {
+        sprintf(nvbuf + strlen(nvbuf), "\n\n");
+      }
+    }
+  } else {
+    sprintf(nvbuf, "\n\tDefault NVRAM Settings:\n\n");
+  }
+
+  char bpl;
+  if (blob.bits != 1) bpl = 's';
+
+  // Only collect settings that exist..
+  if (blob.has & HAS_MODE) {
+    sprintf(nvbuf + strlen(nvbuf), "\tGenerator Mode:\t\t%s Wave\n", makeHumanMode(blob.mode).c_str());
+  }
+  if (blob.has & HAS_FREQ) {
+      sprintf(nvbuf + strlen(nvbuf), "\tFrequency:\t\t%s\n", makeHumanFrequency(blob.frequency).c_str());
+  }
+  if (blob.has & HAS_AMP) {
+    sprintf(nvbuf + strlen(nvbuf), "\tAmplitude Level:\t%i \n", blob.amplitude);
+  }
+  if (blob.has & HAS_STEP) {
+    sprintf(nvbuf + strlen(nvbuf), "\tFrequency Step:\t\t%s \n", makeHumanFrequency(blob.fStep).c_str());
+  }
+  if (blob.has & HAS_PULSE) {
+    sprintf(nvbuf + strlen(nvbuf), "\tPulse Width:\t\t%i%% \n", blob.pulse);
+  }
+  if (blob.has & HAS_PSTEP) {
+    sprintf(nvbuf + strlen(nvbuf), "\tPWM Step:\t\t%i%% \n", blob.pStep);
+  }
+  if (blob.has & HAS_BITS) {
+    sprintf(nvbuf + strlen(nvbuf), "\tPWM resolution:\t\t%i bit%c\n", blob.bits, bpl);
+  }
+  if (blob.has & HAS_TOUCH) {
+    sprintf(nvbuf + strlen(nvbuf), "\tTouch Mode:\t\t%s\n", makeHumanTouchMode(blob.touchMode).c_str());
+  }
+  if (blob.has & HAS_MOD) {
+    sprintf(nvbuf + strlen(nvbuf), "\tModulation:\t\t%s\n", \
+                                            modulationText(blob.modType, blob.modDepth, blob.modRate).c_str());
+  }
+
+  if (eXi && !listing) sprintf(nvbuf + strlen(nvbuf), getFreeEntries().c_str());
+
+  return (String)nvbuf;
+}
+
+
+
+/*
+  Return the list of presets and their settings as a String.
+
+  Straight from RAM; no flash reads. (The NameSpaces themselves get created by loadCatalog().)
+
+  This function needs to be below getNVRAMPresetData() or Arduino IDE prototype generator pukes.
+
+                                     */
+String listPresets() {
+  String xMSG;
+  for( uint8_t i = 1; i <= presetMAX; i++ ) xMSG += getNVRAMPresetData(i, true);
+  xMSG = (xMSG != "") ? "Listing Preset Memories..\n" + xMSG : "No Presets Exist!\n";
+  return xMSG + getFreeEntries();
+}
+
+
+
+/*
+  Return the stored loops/macros as a String (command: ll / lll)
+
+  Output can be imported directly into Signal Generator..
+
+    ll
+
+  for individual lines (one for each stored loop/macro)
+
+    lll
+
+  for one long line containing all loops/macros so you can import them all-at-once.
+
+                                 */
+String listLoops(bool oneLine) {
+
+  String xMSG, loopEnd = "\n", divider = "";
+  if (oneLine) {
+    loopEnd = commandDelimiter;
+    divider = "\n";
+  }
+  String sLoops = prefs.getString("o", "");
+  if (sLoops != "") xMSG = " loop=" + sLoops + loopEnd;
+
+  for( uint8_t i = 1; i <= presetMAX; i++ ) {
+    if (!presetCatalog[i].exists) continue; // No preset, no loops.
+    prefsSwitch(i);
+    sLoops = prefs.getString("o", "");
+    if (sLoops != "") xMSG += " loop" + (String)i + "=" + sLoops + loopEnd;
+  }
+
+  prefsSwitch();
+  return (xMSG != "") ? "Listing Stored Loops/Macros..\n\n" + xMSG + divider + getFreeEntries(): "No loops found!";
+}
+
+
+
+/*
+  Make <commands> the current loop/macro.
+
+  It's compiled here, when it's saved or loaded, and only if it's not what loopProgram[] already
+  holds; playing it (again, and again) just starts from the top (see rewindLoop()). Returns false
+  if it was too big to compile; then there's no program at all (not half of one) and a loop that
+  was playing stops.
+                                                            */
+bool setLoop(const String &commands) {
+  loopCommands = commands;
+  while (loopCommands.endsWith(commandDelimiter)) loopCommands.remove(loopCommands.length()-1);
+  if (loopCommands != loopSource) {
+    loopCompiled = compileLoop(loopCommands);
+    loopSource = loopCommands;
+    if (!loopCompiled) {
+      loopLength = 0;
+      loopTextLength = 0;
+      if (iLooping) endLoop();
+    }
+  }
+  return loopCompiled;
+}
+
+
+// Back to the first instruction, with no blocks open..
+void rewindLoop() {
+  loopPC = 0;
+  loopDepth = 0;
+}
+
+
+
+/*
+
+  End the currently running queue/loop/macro..
+
+                */
+void endLoop() {
+  iLooping = false; // Switch the looping flag
+  QCommand = "";   // Remove remaining commands from the queue
+  loopPC = 0;     // Next time, start at the start
+  loopDepth = 0;
+  eXi = eXiTmp;   // Put extended info flag back to what it was before we started looping
+}
+
+
+
+/*
+  Compile loop/macro commands into loopProgram[]..
+
+  Everything the interpreter can do by itself becomes an opcode + number. On top of the regular
+  commands, loops get counters and ramps..
+
+    repeat 100: f+=10         Step the frequency up 10Hz, 100 times (one step per pass)
+    repeat 20;p+=5;~50;next   Ramp the pulse width up in 5% steps, with a delay between each
+
+  f+=* / f-=* and p+=* / p-=* ramp frequency / pulse width ("+*" and "-*" still work, too).
+  Blocks nest up to four deep. Spaces are ignored.
+
+  Returns false if the loop was too big to compile (in which case it won't play).
+                                                                          */
+bool compileLoop(String commands) {
+
+  loopLength = 0;
+  loopTextLength = 0;
+  loopPC = 0;
+  loopDepth = 0;
+
+  uint16_t openRepeats[loopDepthMAX];
+  uint8_t open = 0;
+  int16_t start = 0;
+
+  trimDelims(commands);
+
+  while (start < (int16_t)commands.length()) {
+
+    int16_t end = commands.indexOf(commandDelimiter, start);
+    if (end == -1) end = commands.length();
+    String command = commands.substring(start, end);
+    command.trim();
+
+    // Loop load commands swallow everything after them (see the loop load code in loop()),
+    // so the rest goes through the regular command path in one piece..
+    String lower = command;
+    lower.toLowerCase();
+    if (lower.startsWith("loop") && lower.indexOf("=") != -1) {
+      command = commands.substring(start);
+      command.trim();
+      end = commands.length();
+    }
+    start = end + 1;
+
+    if (command == "" || command[0] == ':') continue; // Comments / names do nothing.
+
+    // "repeat N: command" is the same as "repeat N;command;next"..
+    String body = "";
+    if (lower.startsWith("repeat") && lower.indexOf(":") != -1) {
+      body = command.substring(lower.indexOf(":") + 1);
+      body.trim();
+      command = command.substring(0, lower.indexOf(":"));
+    }
+
+    if (loopLength >= loopProgramMAX - 1) return false;
+    LoopInstruction &in = loopProgram[loopLength];
+
+    if (!compileCommand(command, in)) {
+      // No opcode for this one; keep it as text..
+      if (loopTextLength + command.length() + 1 > sizeof(loopText)) return false;
+      in.op = LOOP_TEXT;
+      in.arg = loopTextLength;
+      in.value = 0;
+      strcpy(loopText + loopTextLength, command.c_str());
+      loopTextLength += command.length() + 1;
+    }
+
+    if (in.op == LOOP_REPEAT) {
+      if (open == loopDepthMAX) return false;
+      openRepeats[open++] = loopLength;
+    }
+    if (in.op == LOOP_NEXT) {
+      if (open == 0) continue; // A "next" without a "repeat" does nothing.
+      in.arg = openRepeats[--open];
+      loopProgram[in.arg].arg = loopLength;
+    }
+    loopLength++;
+
+    if (body != "") {
+      LoopInstruction &inBody = loopProgram[loopLength];
+      if (!compileCommand(body, inBody)) {
+        if (loopTextLength + body.length() + 1 > sizeof(loopText)) return false;
+        inBody.op = LOOP_TEXT;
+        inBody.arg = loopTextLength;
+        inBody.value = 0;
+        strcpy(loopText + loopTextLength, body.c_str());
+        loopTextLength += body.length() + 1;
+      }
+      loopLength++;
+      if (loopLength >= loopProgramMAX) return false;
+      LoopInstruction &inNext = loopProgram[loopLength];
+      inNext.op = LOOP_NEXT;
+      inNext.arg = openRepeats[--open];
+      inNext.value = 0;
+      loopProgram[inNext.arg].arg = loopLength;
+      loopLength++;
+    }
+  }
+
+  // Close any blocks left open at the end of the loop..
+  while (open > 0) {
+    if (loopLength >= loopProgramMAX) return false;
+    LoopInstruction &inNext = loopProgram[loopLength];
+    inNext.op = LOOP_NEXT;
+    inNext.arg = openRepeats[--open];
+    inNext.value = 0;
+    loopProgram[inNext.arg].arg = loopLength;
+    loopLength++;
+  }
+
+  return true;
+}
+
+
+// Compile one command into an instruction. Returns false if there is no opcode for it.
+bool compileCommand(String command, LoopInstruction &in) {
+
+  command.toLowerCase();
+  command.replace(" ", "");
+  if (command == "") return false;
+
+  char cmd = command[0];
+  String cmdData = command.substring(1);
+  bool isNumber = (cmdData != "" && (isDigit(cmdData[0]) || cmdData[0] == '.'));
+  in.arg = 0;
+  in.value = 0;
+
+  if (command == "r" || command == "s" || command == "t") {
+    in.op = LOOP_MODE;
+    in.arg = cmd;
+    return true;
+  }
+  if (command == "end") {
+    in.op = LOOP_END;
+    return true;
+  }
+  if (command == "next") {
+    in.op = LOOP_NEXT;
+    return true;
+  }
+  if (command.startsWith("repeat")) {
+    in.op = LOOP_REPEAT;
+    in.value = max(0L, command.substring(6).toInt()); // "repeat -5" is "repeat 0" (skip the block)
+    return true;
+  }
+  if (command.startsWith("f+=") || command.startsWith("f-=")) {
+    in.op = LOOP_FREQ_ADD;
+    in.value = humanFreqToFloat(command.substring(3)) * ((command[1] == '-') ? -1 : 1);
+    return true;
+  }
+  if (command.startsWith("p+=") || command.startsWith("p-=")) {
+    in.op = LOOP_PULSE_ADD;
+    in.value = command.substring(3).toInt() * ((command[1] == '-') ? -1 : 1);
+    return true;
+  }
+
+  switch (cmd) {
+    case '0' ... '9' :
+      in.op = LOOP_FREQ;
+      in.value = humanFreqToFloat(command);
+      return true;
+    case '+' :
+    case '-' :
+      if (cmdData == "") return false; // On their own, they are PWM steps.
+      in.op = LOOP_FREQ_ADD;
+      in.value = humanFreqToFloat(cmdData) * ((cmd == '-') ? -1 : 1);
+      return true;
+    case '~' :
+      in.op = LOOP_DELAY;
+      in.value = cmdData.toInt();
+      return true;
+    case 'p' :
+      if (!isNumber) return false;
+      in.op = LOOP_PULSE;
+      in.value = cmdData.toInt();
+      return true;
+    case 'a' :
+      if (!isNumber) return false;
+      in.op = LOOP_AMP;
+      in.value = cmdData.toInt();
+      return true;
+    case 'b' :
+      if (!isNumber) return false;
+      in.op = LOOP_BITS;
+      in.value = cmdData.toInt();
+      return true;
+  }
+  return false;
+}
+
+
+/*
+  Run the compiled loop.
+
+  One "real" instruction per pass of the void, just like the old one-command-per-pass queue, so
+  buttons, touches, delays and the web server all still get a look in. Repeat/next bookkeeping
+  doesn't count as a pass.
+                                      */
+void runLoopInstruction() {
+
+  for (uint8_t guard = 0; guard < 32; guard++) { // An empty "repeat 1000000;next" shouldn't hang us.
+
+    // Loop around..
+    if (loopPC >= loopLength) {
+      loopPC = 0;
+      loopDepth = 0;
+    }
+
+    LoopInstruction &in = loopProgram[loopPC++];
+    loopInstructions++;
+
+    switch (in.op) {
+
+      case LOOP_REPEAT :
+        if ((uint32_t)in.value == 0) {
+          loopPC = in.arg + 1; // Skip the whole block
+        } else if (loopDepth < loopDepthMAX) {
+          loopStack[loopDepth].start = loopPC;
+          loopStack[loopDepth].remaining = in.value;
+          loopDepth++;
+        }
+        continue;
+
+      case LOOP_NEXT :
+        if (loopDepth > 0) {
+          if (--loopStack[loopDepth-1].remaining > 0) {
+            loopPC = loopStack[loopDepth-1].start;
+          } else {
+            loopDepth--;
+          }
+        }
+        continue;
+
+      case LOOP_FREQ :
+        setFrequency(in.value, false, false);
+        startSignal("Loop");
+        break;
+
+      case LOOP_FREQ_ADD :
+        setFrequency(frequency + in.value, false, false);
+        startSignal("Loop");
+        break;
+
+      case LOOP_PULSE :
+        setPulseWidth(in.value);
+        startSignal("Loop");
+        break;
+
+      case LOOP_PULSE_ADD :
+        setPulseWidth(pulse + in.value);
+        startSignal("Loop");
+        break;
+
+      case LOOP_MODE :
+        if (mode != (char)in.arg) {
+          mode = in.arg;
+          startSignal("Loop");
+        }
+        cacheSetting('m', mode);
+        break;
+
+      case LOOP_AMP :
+        if (mode != 'r' && in.value != waveAmplitude && setAmplitude(in.value)) startSignal("Loop");
+        break;
+
+      case LOOP_BITS :
+        PWMResBits = switchResolution(in.value);
+        startSignal("Loop");
+        break;
+
+      case LOOP_DELAY :
+        if (bench.running) break; // We're measuring commands, not waiting.
+        amDelaying = true;
+        if (in.value != 0) delayTime = in.value;
+        delayStart = loopDelayStart();
+        break;
+
+      case LOOP_END :
+        if (bench.running) {
+          LastMessage = benchReport(); // This also ends the loop.
+          if (!binaryMode) Serial.print(LastMessage);
+          return;
+        }
+        endLoop();
+        break;
+
+      case LOOP_TEXT :
+        // Over to the regular command path..
+        QCommand = (String)(loopText + in.arg);
+        return; // Counted there.
+    }
+
+    if (bench.running) bench.commands++;
+    return;
+  }
+}
+
+
+
+/*
+  Benchmark the command path..
+
+  usage: bench[*]
+
+  Plays the currently-loaded loop/macro for * commands (default 1000) and then reports commands per
+  second, time per pass of loop() and what happened to the heap along the way. Load a loop first..
+
+    loop=f1k;p25;f2k;p75;t;r
+    bench5000
+
+  Use the same loop every time and you have a repeatable baseline.
+                                                                                */
+String startBench(String benchData) {
+
+  if (loopCommands == "") return "No Loop/Macro loaded to benchmark! (loop=<commands> first)";
+  if (!setLoop(loopCommands)) return "Loop Too Large To Compile! (" + (String)loopProgramMAX + " instructions maximum)";
+
+  benchData.trim();
+  uint32_t target = benchData.toInt();
+  if (target == 0) target = 1000;
+
+  multi_heap_info_t heapInfo;
+  heap_caps_get_info(&heapInfo, MALLOC_CAP_8BIT);
+
+  bench.target = target;
+  bench.commands = 0;
+  bench.passes = 0;
+  bench.passMax = 0;
+  bench.lastPass = 0;
+  bench.heapStart = heapInfo.total_free_bytes;
+  bench.heapMin = heapInfo.total_free_bytes;
+  bench.blocksStart = heapInfo.allocated_blocks;
+  bench.running = true;
+
+  // Same as playing a loop..
+  iLooping = true;
+  rewindLoop();
+  QCommand = "";
+  eXiTmp = eXi;
+  eXi = false;
+
+  loopInstructions = 0;
+  bench.startTime = micros();
+  return "Benchmarking " + (String)target + " commands (" + (String)loopLength + " instructions): " + loopCommands;
+}
+
+
+// Called at the top of every pass of loop() while the benchmark is running..
+void benchPass() {
+  uint32_t now = micros();
+  if (bench.lastPass != 0) {
+    uint32_t passTime = now - bench.lastPass;
+    if (passTime > bench.passMax) bench.passMax = passTime;
+    bench.passes++;
+  }
+  bench.lastPass = now;
+  uint32_t freeHeap = esp_get_free_heap_size();
+  if (freeHeap < bench.heapMin) bench.heapMin = freeHeap;
+}
+
+
+// Stop the benchmark, end the loop and return the results..
+String benchReport() {
+
+  uint32_t elapsed = micros() - bench.startTime;
+  bench.running = false;
+  endLoop();
+
+  multi_heap_info_t heapInfo;
+  heap_caps_get_info(&heapInfo, MALLOC_CAP_8BIT);
+
+  float_t seconds = elapsed / 1000000.0;
+  int32_t heapDelta = (int32_t)heapInfo.total_free_bytes - (int32_t)bench.heapStart;
+  int32_t blockDelta = (int32_t)heapInfo.allocated_blocks - (int32_t)bench.blocksStart;
+
+  char bbuf[512];
+  sprintf(bbuf, "\n Benchmark Results:\n\n");
+  sprintf(bbuf + strlen(bbuf), "\tCommands:\t\t%u in %.3f seconds\n", bench.commands, seconds);
+  sprintf(bbuf + strlen(bbuf), "\tCommands/second:\t%.1f\n", bench.commands / seconds);
+  sprintf(bbuf + strlen(bbuf), "\tInstructions/second:\t%.1f (%u compiled, %u executed)\n", \
+                                                    loopInstructions / seconds, loopLength, loopInstructions);
+  sprintf(bbuf + strlen(bbuf), "\tloop() passes:\t\t%u\n", bench.passes);
+  sprintf(bbuf + strlen(bbuf), "\tTime per pass:\t\t%.1fus (max: %uus)\n", \
+                                          (bench.passes) ? elapsed / (float_t)bench.passes : 0.0, bench.passMax);
+  sprintf(bbuf + strlen(bbuf), "\tFree heap:\t\t%u -> %u bytes (%+i, lowest: %u)\n", \
+                                          bench.heapStart, heapInfo.total_free_bytes, heapDelta, bench.heapMin);
+  sprintf(bbuf + strlen(bbuf), "\tHeap blocks held:\t%+i (net change, not allocations)\n", blockDelta);
+  sprintf(bbuf + strlen(bbuf), "\tLargest free block:\t%u bytes\n", heapInfo.largest_free_block);
+  return (String)bbuf;
+}
+
+
+
+
+/*
+  Inside a loop, a delay starts from when the /previous/ delay was due to end, rather than now, so
+  the time spent on the commands in-between (and any slow passes of the void) doesn't pile up,
+  pass after pass. If the commands took longer than the delay itself, we start from now.
+                                                                                    */
+uint32_t loopDelayStart() {
+  uint32_t now = millis();
+  if (iLooping && delayEnd != 0 && now - delayEnd < delayTime) return delayEnd;
+  return now;
+}
+
+
+/*
+  Timed Events..
+
+  usage: at<ms>:<command>
+
+  Where <ms> is milliseconds from the start of the sequence and <command> is a frequency, pulse
+  width (p*) or mode (r/s/t) change, or "go" (restart the signal as it is), e.g..
+
+    at0:r;at0:1k;at250:2k;at500:p25;at750:s;at1000:t
+
+  The sequence starts with the first event added to an empty queue (or use "atz" to start it
+  again, right now). Timed changes are not saved to NVS (they'd be late!).
+
+    at?   Report events waiting and lateness statistics
+    atc   Clear waiting events and statistics
+    atz   Zero the sequence time (the next at0 happens now)
+
+  Unlike the other commands, these happen on time even if loop() is busy.
+                                                                                   */
+String timedEvent(String eventData) {
+
+  eventData.trim();
+
+  if (eventData == "?") return eventReport();
+
+  if (eventData == "c") {
+    portENTER_CRITICAL(&eventMux);
+    eventCount = 0;
+    memset(&eventStats, 0, sizeof(eventStats));
+    portEXIT_CRITICAL(&eventMux);
+    if (eventTimer != NULL) esp_timer_stop(eventTimer);
+    return "Timed events and statistics cleared";
+  }
+
+  if (eventData == "z") {
+    eventEpoch = esp_timer_get_time();
+    return "Timed event sequence starts now";
+  }
+
+  int16_t colonPos = eventData.indexOf(":");
+  if (colonPos < 1) return "Usage: at<ms>:<command> (e.g. at250:1k)";
+
+  uint32_t atTime = eventData.substring(0, colonPos).toInt();
+  String command = eventData.substring(colonPos + 1);
+  command.replace(" ", "");
+
+  TimedEvent newEvent;
+  if (!parseEvent(command, newEvent)) return "Timed events can be frequency, pulse width (p*), mode (r/s/t) or go";
+
+  portENTER_CRITICAL(&eventMux);
+  if (eventCount == 0 && eventEpoch < esp_timer_get_time() - 1000000) eventEpoch = esp_timer_get_time();
+  newEvent.due = eventEpoch + (int64_t)atTime * 1000;
+  portEXIT_CRITICAL(&eventMux);
+
+  String failed = queueEvent(newEvent);
+  if (failed != "") return failed;
+  return "Timed event at " + (String)atTime + "ms: " + command;
+}
+
+
+// What a timed event command (1k, p25, s, go, ...) does..
+bool parseEvent(const String &command, TimedEvent &newEvent) {
+  if (command == "r" || command == "s" || command == "t") {
+    newEvent.op = 'm';
+    newEvent.value = command[0];
+  } else if (command == "go") {
+    newEvent.op = 'g'; // Just (re)start the signal; on several units at once, that lines them up.
+    newEvent.value = 0;
+  } else if (command[0] == 'p' && isDigit(command[1])) {
+    newEvent.op = 'p';
+    newEvent.value = command.substring(1).toInt();
+  } else if (isDigit(command[0]) || command[0] == '.') {
+    newEvent.op = 'f';
+    newEvent.value = humanFreqToFloat(command);
+  } else {
+    return false;
+  }
+  return true;
+}
+
+
+// Add an event (due time already set) to the queue and make sure the timer knows. "" == OK..
+String queueEvent(TimedEvent &newEvent) {
+
+  if (!startEventTimer()) return "Failed to start the event timer!";
+
+  portENTER_CRITICAL(&eventMux);
+  bool added = (eventCount < eventsMAX);
+  if (added) {
+    // Insertion sort; it's a short queue..
+    uint8_t i = eventCount++;
+    while (i > 0 && events[i-1].due > newEvent.due) {
+      events[i] = events[i-1];
+      i--;
+    }
+    events[i] = newEvent;
+  } else {
+    eventStats.dropped++;
+  }
+  portEXIT_CRITICAL(&eventMux);
+
+  if (!added) return "Timed event queue is full! (" + (String)eventsMAX + " events maximum)";
+
+  armEventTimer();
+  return "";
+}
+
+
+// Create the timer and its worker task (once)..
+bool startEventTimer() {
+
+  if (eventTimer != NULL) return true;
+
+  portENTER_CRITICAL(&eventMux);
+  memset(&eventStats, 0, sizeof(eventStats));
+  portEXIT_CRITICAL(&eventMux);
+
+  // Same core as loop(), higher priority; so an event gets in ahead of whatever the void is doing..
+  if (xTaskCreatePinnedToCore(eventWorker, "eventWorker", 4096, NULL, 3, &eventTask, 1) != pdPASS) return false;
+
+  esp_timer_create_args_t timerArgs = {};
+  timerArgs.callback = &eventFire;
+  timerArgs.name = "events";
+  if (esp_timer_create(&timerArgs, &eventTimer) != ESP_OK) {
+    vTaskDelete(eventTask);
+    eventTask = NULL;
+    eventTimer = NULL;
+    return false;
+  }
+  return true;
+}
+
+
+// (Re)start the timer for the soonest event..
+void armEventTimer() {
+
+  if (eventTimer == NULL) return;
+
+  esp_timer_stop(eventTimer); // Fine if it wasn't running.
+
+  portENTER_CRITICAL(&eventMux);
+  bool waiting = (eventCount != 0);
+  int64_t wait = (waiting) ? events[0].due - esp_timer_get_time() : 0;
+  portEXIT_CRITICAL(&eventMux);
+
+  if (!waiting) return;
+  if (wait <= 0) {
+    xTaskNotifyGive(eventTask);
+  } else {
+    esp_timer_start_once(eventTimer, wait);
+  }
+}
+
+
+// The timer callback. Keep it short; the work is done in eventWorker()..
+void eventFire(void *param) {
+  xTaskNotifyGive(eventTask);
+}
+
+
+// Applies every event that's due, records how late it was, then waits for the next one..
+void eventWorker(void *param) {
+
+  while (true) {
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    while (true) {
+
+      TimedEvent thisEvent;
+      int64_t now = esp_timer_get_time();
+
+      portENTER_CRITICAL(&eventMux);
+      bool isDue = (eventCount != 0 && events[0].due <= now);
+      if (isDue) {
+        thisEvent = events[0];
+        eventCount--;
+        for (uint8_t i = 0; i < eventCount; i++) events[i] = events[i+1];
+        int64_t late = now - thisEvent.due;
+        if (eventStats.fired == 0 || late < eventStats.lateMin) eventStats.lateMin = late;
+        if (late > eventStats.lateMax) eventStats.lateMax = late;
+        if (late > 1000) eventStats.over1ms++;
+        eventStats.lateTotal += late;
+        eventStats.fired++;
+      }
+      portEXIT_CRITICAL(&eventMux);
+
+      if (!isDue) break;
+
+      // Not while loop() is halfway through changing things itself..
+      SignalLock hold;
+
+      switch (thisEvent.op) {
+        case 'f' :
+          frequency = thisEvent.value;
+          checkLimits(frequency);
+          break;
+        case 'p' :
+          setPulseWidth(thisEvent.value, false);
+          break;
+        case 'm' :
+          setMode((char)thisEvent.value, false);
+          break;
+        // 'g' (go) changes nothing; it's just the restart..
+      }
+      // Triangles (and squares) otherwise retune in place; a go is a real restart (that's what lines units up)..
+      if (thisEvent.op == 'g' && (mode == 't' || mode == 'r')) stopSignal();
+      startSignal("Timed Event");
+    }
+
+    armEventTimer();
+  }
+}
+
+
+// Events waiting and lateness statistics..
+String eventReport() {
+
+  char ebuf[384];
+
+  portENTER_CRITICAL(&eventMux);
+  uint8_t waiting = eventCount;
+  int64_t next = (waiting) ? events[0].due - esp_timer_get_time() : 0;
+  EventStats stats = eventStats;
+  portEXIT_CRITICAL(&eventMux);
+
+  sprintf(ebuf, "\n Timed Events:\n\n");
+  sprintf(ebuf + strlen(ebuf), "\tWaiting:\t%u", waiting);
+  if (waiting) sprintf(ebuf + strlen(ebuf), " (next in %.3fms)", next / 1000.0);
+  sprintf(ebuf + strlen(ebuf), "\n\tFired:\t\t%u\n", stats.fired);
+  if (stats.fired) {
+    sprintf(ebuf + strlen(ebuf), "\tLateness:\t%lldus min, %.1fus average, %lldus max\n", \
+                          stats.lateMin, stats.lateTotal / (float_t)stats.fired, stats.lateMax);
+    sprintf(ebuf + strlen(ebuf), "\tOver 1ms late:\t%u\n", stats.over1ms);
+  }
+  if (stats.dropped) sprintf(ebuf + strlen(ebuf), "\tDropped:\t%u (queue full)\n", stats.dropped);
+  return (String)ebuf;
+}
+
+
+
+/*
+  Network Sync..
+
+  The leader broadcasts a beacon every syncInterval. A follower that hears one starts swapping
+  timestamps with it (NTP-style), every syncInterval..
+
+    offset = ((t2 - t1) + (t3 - t4)) / 2        round trip = (t4 - t1) - (t3 - t2)
+
+  .. where t1 and t4 are the follower's clock (request out, reply in) and t2 and t3 are the
+  leader's (request in, reply out). The offset is only as good as the trip was symmetrical, and
+  WiFi round trips wander all over the place (power save, retries, a busy core), so we keep the last
+  few and trust the one with the shortest round trip. Each new estimate goes back to the leader
+  (SYNC_REPORT), so "sync?" there shows how everyone's doing.
+
+  A scheduled change (SYNC_EVENT) carries the leader's time. A follower takes off its offset and
+  drops it into the timed event queue (see timedEvent()), which makes it happen on time.
+
+  All the network business happens in syncTask() (core 0); loop() never waits on a packet.
+                                                                                    */
+#if defined REMOTE
+
+void syncSend(int sock, SyncPacket &packet, uint32_t ip) {
+  sockaddr_in to = {};
+  to.sin_family = AF_INET;
+  to.sin_port = htons(syncPort);
+  to.sin_addr.s_addr = ip;
+  packet.magic[0] = 'S';
+  packet.magic[1] = 'G';
+  packet.version = syncVersion;
+  if (syncRole == 'l') packet.epoch = syncState.epoch;
+  sendto(sock, &packet, sizeof(SyncPacket), 0, (sockaddr *)&to, sizeof(to));
+}
+
+
+// To everyone, on whichever networks we're on..
+void syncBroadcast(int sock, SyncPacket &packet) {
+  if (WiFi.status() == WL_CONNECTED) syncSend(sock, packet, (uint32_t)WiFi.broadcastIP());
+  if (WiFi.getMode() & WIFI_MODE_AP) syncSend(sock, packet, (uint32_t)WiFi.softAPBroadcastIP());
+}
+
+
+// (Followers, with syncMux held) a new leader, or the same one started over (maybe rebooted); new
+// clock, and its events count from 1 again..
+void syncNewLeader(uint32_t ip, uint32_t epoch) {
+  syncState.leaderIP = ip;
+  syncState.epoch = epoch;
+  syncState.sampleCount = 0;
+  syncState.nextSample = 0;
+  syncState.lastEvent = 0;
+}
+
+
+// One packet in. <now> is when it arrived (our clock)..
+void syncHandle(int sock, SyncPacket &packet, uint32_t ip, int64_t now) {
+
+  switch (packet.type) {
+
+    case SYNC_BEACON :
+      if (syncRole != 'f') return;
+      portENTER_CRITICAL(&syncMux);
+      if (ip != syncState.leaderIP || packet.epoch != syncState.epoch) syncNewLeader(ip, packet.epoch);
+      syncState.leaderSeen = millis();
+      portEXIT_CRITICAL(&syncMux);
+      return;
+
+    case SYNC_REQUEST :
+      if (syncRole != 'l') return;
+      packet.type = SYNC_REPLY;
+      packet.t2 = now;
+      packet.t3 = esp_timer_get_time();
+      syncSend(sock, packet, ip);
+      return;
+
+    case SYNC_REPLY : {
+      if (syncRole != 'f' || ip != syncState.leaderIP) return;
+      int64_t rtt = (now - packet.t1) - (packet.t3 - packet.t2);
+      if (rtt < 0) return;
+      SyncSample sample = { ((packet.t2 - packet.t1) + (packet.t3 - now)) / 2, (uint32_t)rtt };
+
+      portENTER_CRITICAL(&syncMux);
+      syncState.samples[syncState.nextSample] = sample;
+      syncState.nextSample = (syncState.nextSample + 1) % syncSamples;
+      if (syncState.sampleCount < syncSamples) syncState.sampleCount++;
+      uint8_t best = 0;
+      for (uint8_t i = 1; i < syncState.sampleCount; i++) {
+        if (syncState.samples[i].rtt < syncState.samples[best].rtt) best = i;
+      }
+      syncState.offset = syncState.samples[best].offset;
+      syncState.rtt = syncState.samples[best].rtt;
+      portEXIT_CRITICAL(&syncMux);
+
+      // Tell the leader how we're doing..
+      memset(&packet, 0, sizeof(SyncPacket));
+      packet.type = SYNC_REPORT;
+      packet.offset = syncState.offset;
+      packet.rtt = syncState.rtt;
+      syncSend(sock, packet, ip);
+      return;
+    }
+
+    case SYNC_EVENT : {
+      if (syncRole != 'f' || ip != syncState.leaderIP) return;
+      // The leader started over (before its beacon told us); its seq has too..
+      if (packet.epoch != syncState.epoch) {
+        portENTER_CRITICAL(&syncMux);
+        syncNewLeader(ip, packet.epoch);
+        portEXIT_CRITICAL(&syncMux);
+      }
+      if (packet.seq == syncState.lastEvent) return;
+      syncState.lastEvent = packet.seq;
+      if (syncState.sampleCount == 0) {
+        syncState.eventsMissed++;
+        return;
+      }
+      TimedEvent newEvent;
+      newEvent.due = packet.due - syncState.offset;
+      newEvent.op = packet.op;
+      newEvent.value = packet.value;
+      if (queueEvent(newEvent) == "") syncState.eventsIn++; else syncState.eventsMissed++;
+      return;
+    }
+
+    case SYNC_REPORT : {
+      if (syncRole != 'l') return;
+      // Their slot, or a free one, or the one we heard from longest ago..
+      uint8_t slot = 0;
+      portENTER_CRITICAL(&syncMux);
+      for (uint8_t i = 0; i < syncFollowersMAX; i++) {
+        if (syncState.followers[i].ip == ip) {
+          slot = i;
+          break;
+        }
+        if (syncState.followers[i].ip == 0 || \
+            syncState.followers[i].lastSeen < syncState.followers[slot].lastSeen) slot = i;
+      }
+      syncState.followers[slot].ip = ip;
+      syncState.followers[slot].offset = packet.offset;
+      syncState.followers[slot].rtt = packet.rtt;
+      syncState.followers[slot].lastSeen = millis();
+      portEXIT_CRITICAL(&syncMux);
+      return;
+    }
+  }
+}
+
+
+// The sync task; listens, answers, and sends beacons/requests and any events loop() left for us..
+void syncTask(void *param) {
+
+  int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  sockaddr_in local = {};
+  local.sin_family = AF_INET;
+  local.sin_port = htons(syncPort);
+  local.sin_addr.s_addr = htonl(INADDR_ANY);
+  if (sock < 0 || bind(sock, (sockaddr *)&local, sizeof(local)) < 0) {
+    if (sock >= 0) close(sock);
+    syncRunning = false;
+    syncTaskHandle = NULL;
+    vTaskDelete(NULL);
+    return;
+  }
+
+  int yes = 1;
+  setsockopt(sock, SOL_SOCKET, SO_BROADCAST, &yes, sizeof(yes));
+  // Short, so outgoing events never wait long behind a quiet network..
+  timeval timeout = { 0, 10000 };
+  setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+  uint32_t lastTick = 0;
+  SyncPacket packet;
+
+  while (syncRunning) {
+
+    sockaddr_in from;
+    socklen_t fromLength = sizeof(from);
+    int got = recvfrom(sock, &packet, sizeof(SyncPacket), 0, (sockaddr *)&from, &fromLength);
+    int64_t now = esp_timer_get_time();
+    if (got == sizeof(SyncPacket) && packet.magic[0] == 'S' && packet.magic[1] == 'G' && \
+                            packet.version == syncVersion) syncHandle(sock, packet, from.sin_addr.s_addr, now);
+
+    // Events; three times over. UDP can lose one, and followers ignore the repeats..
+    while (xQueueReceive(syncOutbox, &packet, 0) == pdTRUE) {
+      for (uint8_t i = 0; i < 3; i++) syncBroadcast(sock, packet);
+    }
+
+    if (millis() - lastTick < syncInterval) continue;
+    lastTick = millis();
+    memset(&packet, 0, sizeof(SyncPacket));
+    if (syncRole == 'l') {
+      packet.type = SYNC_BEACON;
+      syncBroadcast(sock, packet);
+    } else if (syncRole == 'f' && syncState.leaderIP != 0) {
+      packet.type = SYNC_REQUEST;
+      packet.t1 = esp_timer_get_time();
+      syncSend(sock, packet, syncState.leaderIP);
+    }
+  }
+
+  close(sock);
+  syncTaskHandle = NULL;
+  vTaskDelete(NULL);
+}
+
+
+bool startSync() {
+
+  stopSync();
+  if (syncRole == 0 || !RemControl) return false;
+
+  // A leader's events count from 1 again, so followers need to know this is a new run..
+  portENTER_CRITICAL(&syncMux);
+  memset(&syncState, 0, sizeof(SyncState));
+  if (syncRole == 'l') syncState.epoch = esp_random() | 1;
+  portEXIT_CRITICAL(&syncMux);
+
+  if (syncOutbox == NULL) syncOutbox = xQueueCreate(4, sizeof(SyncPacket));
+  if (syncOutbox == NULL) return false;
+
+  // The sync task queues events too; the timer has to be there first (startEventTimer() isn't
+  // safe to race with loop())..
+  if (!startEventTimer()) return false;
+
+  syncRunning = true;
+  // Core 0, with the WiFi; above the input scan, below the DDS writer..
+  if (xTaskCreatePinnedToCore(syncTask, "syncTask", 4096, NULL, 3, &syncTaskHandle, 0) != pdPASS) {
+    syncRunning = false;
+    syncTaskHandle = NULL;
+    return false;
+  }
+  return true;
+}
+
+
+void stopSync() {
+  if (syncTaskHandle == NULL) return;
+  syncRunning = false;
+  for (uint8_t i = 0; i < 50 && syncTaskHandle != NULL; i++) delay(5);
+}
+
+
+/*
+  (On the leader) schedule a timed event command on every unit, <ms> from now..
+
+    sync 500:1k     sync go (syncLead ms from now)
+                                                  */
+String syncSchedule(String data) {
+
+  int16_t colonPos = data.indexOf(":");
+  uint32_t ms = (colonPos > 0) ? data.substring(0, colonPos).toInt() : syncLead;
+  String command = data.substring(colonPos + 1);
+  command.replace(" ", "");
+
+  TimedEvent newEvent;
+  if (!parseEvent(command, newEvent)) return "Sync events can be frequency, pulse width (p*), mode (r/s/t) or go";
+  newEvent.due = esp_timer_get_time() + (int64_t)ms * 1000;
+
+  SyncPacket packet;
+  memset(&packet, 0, sizeof(SyncPacket));
+  packet.type = SYNC_EVENT;
+  packet.seq = ++syncState.lastEvent;
+  packet.due = newEvent.due;
+  packet.op = newEvent.op;
+  packet.value = newEvent.value;
+  if (xQueueSend(syncOutbox, &packet, 0) != pdTRUE) return "Sync is busy; try again";
+  syncState.eventsOut++;
+
+  String failed = queueEvent(newEvent);
+  if (failed != "") return failed;
+  return "All units: " + command + " in " + (String)ms + "ms";
+}
+
+
+String syncReport() {
+
+  char sbuf[1024];
+
+  portENTER_CRITICAL(&syncMux);
+  SyncState state = syncState;
+  portEXIT_CRITICAL(&syncMux);
+  uint32_t now = millis();
+
+  if (syncRole == 0) return "\n Network Sync: Off (sync leader / sync follow)\n";
+
+  sprintf(sbuf, "\n Network Sync: %s (UDP port %u)%s\n\n", (syncRole == 'l') ? "Leader" : "Follower", syncPort, \
+                                                      (syncRunning) ? "" : " [NOT RUNNING]");
+  if (syncRole == 'l') {
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < syncFollowersMAX; i++) if (state.followers[i].ip) count++;
+    sprintf(sbuf + strlen(sbuf), "\tEvents sent:\t%u\n\tFollowers:\t%u\n\n", state.eventsOut, count);
+    for (uint8_t i = 0; i < syncFollowersMAX; i++) {
+      SyncFollower &f = state.followers[i];
+      if (f.ip == 0) continue;
+      sprintf(sbuf + strlen(sbuf), "\t%s\toffset %+lldus\tround trip %uus\t(%.1fs ago)\n", \
+                      IPAddress(f.ip).toString().c_str(), f.offset, f.rtt, (now - f.lastSeen) / 1000.0);
+    }
+  } else {
+    if (state.leaderIP) {
+      sprintf(sbuf + strlen(sbuf), "\tLeader:\t\t%s (heard %.1fs ago)\n", \
+                      IPAddress(state.leaderIP).toString().c_str(), (now - state.leaderSeen) / 1000.0);
+    } else {
+      sprintf(sbuf + strlen(sbuf), "\tLeader:\t\tnot found yet\n");
+    }
+    if (state.sampleCount) sprintf(sbuf + strlen(sbuf), "\tClock offset:\t%+lldus (round trip %uus, best of %u)\n", \
+                                                            state.offset, state.rtt, state.sampleCount);
+    sprintf(sbuf + strlen(sbuf), "\tEvents:\t\t%u received, %u missed (at? for how late they ran)\n", \
+                                                            state.eventsIn, state.eventsMissed);
+  }
+  return (String)sbuf;
+}
+
+#endif
+
+
+// The sync command..
+String syncCommand(String data) {
+#if defined REMOTE
+  data.trim();
+  if (data == "" || data == "?") return syncReport();
+
+  if (data == "leader" || data == "follow" || data == "off") {
+    syncRole = (data == "off") ? 0 : data[0];
+    prefs.putChar("S", syncRole);
+    if (syncRole == 0) {
+      stopSync();
+      return "Network Sync is Off.";
+    }
+    if (!startSync()) return "Network Sync failed to start! (it needs remote control)";
+    return (syncRole == 'l') ? "This unit is the Sync Leader." : "This unit is a Sync Follower.";
+  }
+
+  if (syncRole != 'l' || !syncRunning) return "Only a (running) leader can schedule sync events. (sync leader)";
+  return syncSchedule(data);
+#else
+  return "Network Sync needs remote control (#define REMOTE)";
+#endif
+}
+
+
+
+
+/*
+  Sweeps..
+
+  usage: sweep <start> <stop> <ms> [lin/log] [once/rep]
+
+  e.g.  sweep 100 10k 5000 log rep
+
+  Sweeps from 100Hz to 10kHz over five seconds, logarithmically, over and over. The default is a
+  linear, one-shot sweep. Works in whatever mode you are in (set that up first). Stop with
+  "sweep end" (or "stop"), or check on it with "sweep?", which also gives the update rate we
+  actually managed.
+
+  Updates happen 1000 times a second, except for triangle waves in regular (non-DDS) mode, where
+  they're 200/second, on purpose. Each of those steps restarts the I2S DMA at the new rate and then
+  waits (up to 2ms) for a free DMA buffer to write the period into, all holding the signal lock; at
+  1000/second the worker would spend nearly all its time in the I2S driver, the commands would
+  queue up behind it and every restart would chop the wave. (Coalescing doesn't save us there; the
+  steps would simply land back to back.) 5ms apart, it's still a small fraction of the time. The
+  full in-place retune (triangleSetFrequency()) rewrites the whole ring, so it's slower still. For
+  smooth triangle sweeps, enable DDS (ddse), which changes a tuning word and nothing else.
+                                                                                      */
+String startSweep(String sweepData) {
+
+  sweepData.trim();
+  if (sweepData == "?" || sweepData == "") return sweepReport();
+  if (sweepData == "end" || sweepData == ".") {
+    if (!sweep.running) return "No sweep running";
+    stopSweep();
+    return sweepReport();
+  }
+
+  // Split the arguments on spaces..
+  String args[5];
+  uint8_t argCount = 0;
+  while (sweepData != "" && argCount < 5) {
+    int16_t spacePos = sweepData.indexOf(" ");
+    if (spacePos == -1) spacePos = sweepData.length();
+    args[argCount++] = sweepData.substring(0, spacePos);
+    sweepData = sweepData.substring(spacePos + 1);
+    sweepData.trim();
+  }
+  if (argCount < 3) return "Usage: sweep <start> <stop> <ms> [lin/log] [once/rep]";
+
+  stopSweep();
+
+  sweep.mode = mode;
+  sweep.startFreq = limitFrequency(mode, humanFreqToFloat(args[0]));
+  sweep.stopFreq = limitFrequency(mode, humanFreqToFloat(args[1]));
+  long sweepTime = args[2].toInt();
+  if (sweepTime < 1 || sweepTime > (long)sweepTimeMAX) return "Sweep time must be from 1ms to 86400000ms (a day)";
+  sweep.duration = sweepTime;
+  sweep.logSweep = false;
+  sweep.repeat = false;
+  for (uint8_t i = 3; i < argCount; i++) {
+    if (args[i] == "log") sweep.logSweep = true;
+    if (args[i] == "rep") sweep.repeat = true;
+  }
+
+  if (sweep.logSweep && (sweep.startFreq <= 0 || sweep.stopFreq <= 0)) \
+                                                    return "Logarithmic sweeps can't start or stop at 0Hz";
+
+  // Setup the signal at the start frequency, the regular way..
+  frequency = sweep.startFreq;
+  startSignal("Sweep");
+
+  sweep.interval = 1000;
+  if (mode == 't' && !useDDS) {
+    sweep.interval = 5000;
+    sweep.buffLen = planFrequency('t', sweep.startFreq, pulse).buffLen;
+  }
+
+  if (!startStepWorker()) return "Failed to start the step worker!";
+  if (sweepTimer == NULL) {
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = &sweepUpdate;
+    timerArgs.name = "sweep";
+    if (esp_timer_create(&timerArgs, &sweepTimer) != ESP_OK) {
+      sweepTimer = NULL;
+      return "Failed to start the sweep timer!";
+    }
+  }
+
+  sweep.updates = 0;
+  sweep.failed = 0;
+  sweep.updateMax = 0;
+  sweep.gapMax = 0;
+  sweep.startTime = esp_timer_get_time();
+  sweep.firstTime = sweep.startTime;
+  sweep.lastUpdate = sweep.startTime;
+  sweep.running = true;
+  esp_timer_start_periodic(sweepTimer, sweep.interval);
+
+  char sbuf[128];
+  sprintf(sbuf, "Sweeping %s from %.2fHz to %.2fHz in %ums (%s, %s)", makeHumanMode(mode).c_str(), \
+                sweep.startFreq, sweep.stopFreq, sweep.duration, (sweep.logSweep) ? "log" : "linear", \
+                (sweep.repeat) ? "repeating" : "once");
+  return (String)sbuf;
+}
+
+
+void stopSweep() {
+  if (sweepTimer != NULL) esp_timer_stop(sweepTimer);
+  // esp_timer_stop() doesn't wait for a callback that's already going; this way, it can't leave
+  // another step behind for the worker..
+  portENTER_CRITICAL(&stepMux);
+  sweep.running = false;
+  sweepPending = false;
+  portEXIT_CRITICAL(&stepMux);
+}
+
+
+// Where the sweep should be <elapsed> microseconds in..
+float_t sweepFrequency(int64_t elapsed) {
+  float_t progress = (double)elapsed / (sweep.duration * 1000.0);
+  if (progress > 1) progress = 1;
+  if (sweep.logSweep) return sweep.startFreq * pow(sweep.stopFreq / sweep.startFreq, progress);
+  return sweep.startFreq + (sweep.stopFreq - sweep.startFreq) * progress;
+}
+
+
+/*
+  The sweep timer callback.
+
+  This runs in the esp_timer task, which has a small stack and other timers to serve, so it only
+  works out where the sweep should be and hands that to the step worker; an I2S rate change (and
+  the write after it) can take a couple of milliseconds, which would hold up every other timer.
+                                                                  */
+void sweepUpdate(void *param) {
+
+  // Something else changed the mode; that's the end of that..
+  if (mode != sweep.mode) {
+    stopSweep();
+    return;
+  }
+
+  int64_t now = esp_timer_get_time();
+  uint32_t gap = now - sweep.lastUpdate;
+  if (gap > sweep.gapMax && sweep.updates) sweep.gapMax = gap;
+  sweep.lastUpdate = now;
+
+  int64_t elapsed = now - sweep.startTime;
+  bool done = (elapsed >= (int64_t)sweep.duration * 1000);
+  float_t newFreq = sweepFrequency(elapsed);
+
+  if (done) {
+    if (sweep.repeat) {
+      sweep.startTime = now;
+    } else {
+      esp_timer_stop(sweepTimer); // Fine from inside the callback.
+    }
+  }
+
+  portENTER_CRITICAL(&stepMux);
+  bool queued = sweep.running;
+  if (queued) {
+    sweepNext = newFreq;
+    sweepPending = true;
+    if (done && !sweep.repeat) sweep.running = false;
+  }
+  portEXIT_CRITICAL(&stepMux);
+
+  if (queued) xTaskNotifyGive(stepTask);
+}
+
+
+/*
+  The step worker..
+
+  Sweep and modulation steps and song notes (worked out by their timers) go on the hardware here, in a task of
+  their own, holding the signal lock (see SignalLock); so a step can take as long as the hardware
+  needs without holding up the other timers, and never lands in the middle of a command changing
+  things. If a sweep or modulation step comes in while the last is still going, only the newest
+  gets made; song notes queue up (see songQueue()) and all get played, in order. Same core as
+  loop(), above it, below the event worker..
+                                                                  */
+void stepWorker(void *param) {
+
+  while (true) {
+
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    SignalLock hold;
+
+    portENTER_CRITICAL(&stepMux);
+    bool doSweep = sweepPending;
+    float_t newFreq = sweepNext;
+    sweepPending = false;
+    bool doMod = modPending;
+    float_t modValue = modNext;
+    modPending = false;
+    uint8_t pitches[songQueueMAX];
+    uint8_t songNotes = songQueueCount;
+    for (uint8_t i = 0; i < songNotes; i++) pitches[i] = songQueued[(songQueueFirst + i) % songQueueMAX];
+    songQueueFirst = (songQueueFirst + songNotes) % songQueueMAX;
+    songQueueCount = 0;
+    portEXIT_CRITICAL(&stepMux);
+
+    // (Anything that changed the mode while we waited for the lock also stopped the sweep.)
+    if (doSweep && mode == sweep.mode) {
+      int64_t start = esp_timer_get_time();
+      if (!fastSetFrequency(sweep.mode, newFreq, sweep.buffLen)) sweep.failed++;
+      frequency = newFreq;
+      sweep.updates++;
+      uint32_t updateTime = esp_timer_get_time() - start;
+      if (updateTime > sweep.updateMax) sweep.updateMax = updateTime;
+    }
+
+    // Modulation (the carrier's own settings stay as they are)..
+    if (doMod && mode == modTimerState.mode && !sweep.running && !songPlayer.playing) {
+      if (modTimerState.type == 'f') {
+        // Kept inside the mode's limits; anything LEDC still can't do is skipped (and counted)..
+        if (!fastSetFrequency(modTimerState.mode, limitFrequency(modTimerState.mode, modValue), 0)) {
+          modTimerState.failed++;
+          int64_t now = esp_timer_get_time();
+          if (now - modTimerState.failedLogged >= 1000000) {
+            modTimerState.failedLogged = now;
+            if (eXi) Serial.printf(" FM: the hardware refused %u steps so far (last at %.2fHz)\n", \
+                                                                      modTimerState.failed, modValue);
+          }
+        }
+      } else {
+        ledcWrite(PWMChannel, (ledcSteps() * modValue) / 100.0);
+      }
+    }
+
+    // Every song note, in order..
+    for (uint8_t i = 0; i < songNotes && mode == songPlayer.mode; i++) songPlay(pitches[i]);
+  }
+}
+
+
+// Start the step worker (once)..
+bool startStepWorker() {
+  if (stepTask != NULL) return true;
+  return xTaskCreatePinnedToCore(stepWorker, "stepWorker", 4096, NULL, 2, &stepTask, 1) == pdPASS;
+}
+
+
+/*
+  Change the frequency of the running signal, straight to the hardware (sweeps, songs)..
+
+  No parsing, no NVS, no startSignal(), no printing. It can wait on the I2S driver, though (a
+  couple of milliseconds), so call it from a task, not an esp_timer callback (see stepWorker()).
+  For regular (non-DDS) triangle waves, buffLen is the buffer size the signal was started with,
+  we only change the sample rate.
+                                                                            */
+bool fastSetFrequency(char myMode, float_t newFreq, uint8_t buffLen) {
+
+  FreqPlan plan = {};
+  size_t bytes_written;
+
+  switch (myMode) {
+
+    case 's' :
+      // The planner's sine solver, without the cache (every step of a sweep is a new frequency)..
+      plan.target = newFreq;
+      planSine(plan);
+      REG_SET_FIELD(RTC_CNTL_CLK_CONF_REG, RTC_CNTL_CK8M_DIV_SEL, plan.divider);
+      SET_PERI_REG_BITS(SENS_SAR_DAC_CTRL1_REG, SENS_SW_FSTEP, plan.step, SENS_SW_FSTEP_S);
+      return true;
+
+    case 'r' :
+      // Only the divider changes, so the pulse width stays put. Check first; the LEDC driver logs
+      // every frequency it can't do, and FM would have it doing that a thousand times a second..
+      if (ledcAchievable(newFreq, ledcLiveBits, getApbFrequency()) == 0) return false;
+      if (ledcChangeFrequency(PWMChannel, newFreq, ledcLiveBits) == 0) return false;
+      ledcLiveFreq = newFreq;
+      return true;
+
+    case 't' : {
+      if (useDDS) {
+        double words = (double)newFreq * 4294967296.0 / ddsSampleRate;
+        if (words > 4294967295.0) words = 4294967295.0;
+        ddsTuningWord = (words < 1) ? 1 : (uint32_t)words;
+        return true;
+      }
+      // Same buffer, new sample rate..
+      uint32_t rate = newFreq * 2 * buffLen;
+      if (rate < 5200) rate = 5200;
+      if (i2s_set_sample_rates(i2s_num, rate) != ESP_OK) return false;
+      i2s_write(i2s_num, (const char *)&tBuff, buffLen * 8, &bytes_written, pdMS_TO_TICKS(2));
+      return true;
+    }
+  }
+  return false;
+}
+
+
+String sweepReport() {
+
+  char sbuf[384];
+  float_t seconds = (esp_timer_get_time() - sweep.firstTime) / 1000000.0;
+
+  if (sweep.updates == 0) return "No sweep yet! (sweep <start> <stop> <ms> [lin/log] [once/rep])";
+
+  sprintf(sbuf, "\n Sweep: %s %.2fHz -> %.2fHz in %ums (%s, %s)%s\n\n", makeHumanMode(sweep.mode).c_str(), \
+                sweep.startFreq, sweep.stopFreq, sweep.duration, (sweep.logSweep) ? "log" : "linear", \
+                (sweep.repeat) ? "repeating" : "once", (sweep.running) ? "" : " [finished]");
+  sprintf(sbuf + strlen(sbuf), "\tUpdates:\t%u (%u failed)\n", sweep.updates, sweep.failed);
+  if (sweep.running) sprintf(sbuf + strlen(sbuf), "\tUpdate rate:\t%.1f/second (asked for %u)\n", \
+                                                      sweep.updates / seconds, 1000000 / sweep.interval);
+  sprintf(sbuf + strlen(sbuf), "\tLongest update:\t%uus\n", sweep.updateMax);
+  sprintf(sbuf + strlen(sbuf), "\tLongest gap:\t%uus\n", sweep.gapMax);
+  return (String)sbuf;
+}
+
+
+/*
+  Set a channel's Dual Channel settings, import-style (key=value, comma-separated)..
+
+    w = wave (t/s/r/w/n), f = frequency, p = pulse width, a = amplitude (1-4), o = phase offset (degrees)
+
+  Channel 1's frequency, pulse width and amplitude are the regular settings, so they get set the
+  regular way. Changing a phase offset starts both channels again from their offsets.
+                                                                                    */
+String dualSettings(uint8_t channel, String data) {
+
+  String changed = "";
+  bool resync = false;
+  data.trim();
+  data += ",";
+
+  while (data.indexOf(',') != -1) {
+    String setting = data.substring(0, data.indexOf(','));
+    data = data.substring(data.indexOf(',') + 1);
+    setting.trim();
+    if (setting.length() < 3 || setting[1] != '=') continue;
+    String value = setting.substring(2);
+
+    switch (setting[0]) {
+      case 'w' :
+        if (strchr(synthWaves, value[0]) == NULL) continue;
+        if (channel == 1) dual.waveA = value[0]; else dual.waveB = value[0];
+        break;
+      case 'f' : {
+        float_t newFreq = humanFreqToFloat(value);
+        if (channel == 1) {
+          setFrequency(newFreq, false, false);
+        } else {
+          dual.frequencyB = constrain(newFreq, DDSLowerLimit, (float_t)DDSUpperLimit);
+        }
+        break;
+      }
+      case 'p' :
+        if (channel == 1) setPulseWidth(constrain(value.toInt(), 0, 100));
+        else dual.pulseB = constrain(value.toInt(), 0, 100);
+        break;
+      case 'a' :
+        if (channel == 1) {
+          waveAmplitude = constrain(value.toInt(), 1, 4);
+          cacheSetting('a', waveAmplitude);
+        } else {
+          dual.amplitudeB = constrain(value.toInt(), 1, 4);
+        }
+        break;
+      case 'o' :
+        if (channel == 1) dual.offsetA = value.toInt() % 360; else dual.offsetB = value.toInt() % 360;
+        resync = true;
+        break;
+      default :
+        continue;
+    }
+    changed += (changed == "") ? setting : ", " + setting;
+  }
+
+  if (changed == "") return "Nothing to set! e.g. dual2 w=s,f=1k,p=50,a=4,o=90";
+  if (useDual && ddsRunning) dualSetChannels(resync);
+  return "Dual Channel " + (String)channel + ": " + changed;
+}
+
+
+// Store Dual Channel mode (enabled flag + settings, in one)..
+void saveDual() {
+  uint8_t dualData[sizeof(DualSettings) + 1];
+  dualData[0] = useDual;
+  memcpy(dualData + 1, &dual, sizeof(DualSettings));
+  prefs.putBytes("v", dualData, sizeof(dualData));
+}
+
+
+String dualReport() {
+  char dbuf[384];
+  sprintf(dbuf, "\n Dual Channel Mode: %s%s\n\n", (useDual) ? "Enabled" : "Disabled", \
+                                        (useDual && mode != 't') ? " (waiting for Triangle wave)" : "");
+  sprintf(dbuf + strlen(dbuf), "\tChannel 1 (pin 25):\t%s Wave %s, pulse %i%%, amplitude %i, offset %i\u00B0\n", \
+                      makeHumanMode(dual.waveA).c_str(), makeHumanFrequency(frequency).c_str(), pulse, \
+                      waveAmplitude, dual.offsetA);
+  sprintf(dbuf + strlen(dbuf), "\tChannel 2 (pin 26):\t%s Wave %s, pulse %i%%, amplitude %i, offset %i\u00B0\n\n", \
+                      makeHumanMode(dual.waveB).c_str(), makeHumanFrequency(dual.frequencyB).c_str(), \
+                      dual.pulseB, dual.amplitudeB, dual.offsetB);
+  return (String)dbuf;
+}
+
+
+/*
+  Modulation as text: "am:50:5" (type:depth:rate) or "off". This is how it's exported, too..
+                                                                                          */
+String modulationText(char type, uint8_t depth, float_t rate) {
+  char mbuf[32];
+  switch (type) {
+    case 'a' : sprintf(mbuf, "am:%i:%g", depth, rate); break;
+    case 'f' : sprintf(mbuf, "fm:%i:%g", depth, rate); break;
+    case 'p' : sprintf(mbuf, "pwm:%i:%g", depth, rate); break;
+    default  : return "off";
+  }
+  return (String)mbuf;
+}
+
+
+/*
+  .. and back again. Spaces work as well as colons (mod am 50 5), and you can leave off the depth
+  and rate to keep the ones you have. Returns false if it makes no sense..
+                                                                                          */
+bool parseModulation(String data, SGModulation &mod) {
+
+  data.trim();
+  data.toLowerCase();
+  data.replace(':', ' ');
+  String args[3];
+  uint8_t argCount = 0;
+  while (data != "" && argCount < 3) {
+    int16_t spacePos = data.indexOf(" ");
+    if (spacePos == -1) spacePos = data.length();
+    args[argCount++] = data.substring(0, spacePos);
+    data = data.substring(spacePos + 1);
+    data.trim();
+  }
+  if (argCount == 0) return false;
+
+  if (args[0] == "off" || args[0] == "0") {
+    mod.type = 0;
+    return true;
+  }
+  if (args[0] == "am") mod.type = 'a';
+    else if (args[0] == "fm") mod.type = 'f';
+      else if (args[0] == "pwm") mod.type = 'p';
+        else return false;
+
+  if (argCount > 1) mod.depth = constrain(args[1].toInt(), 1, 100);
+  if (mod.type == 'f' && mod.depth > fmDepthMAX) mod.depth = fmDepthMAX;
+  if (argCount > 2) mod.rate = constrain(humanFreqToFloat(args[2]), 0.01, modRateMAX);
+  return true;
+}
+
+
+// Store modulation in the main namespace (it's a preset setting, so presets have it in their blob)..
+void saveModulation() {
+  if (prefsNamespace == 0) prefs.putBytes("M", &modulation, sizeof(SGModulation));
+}
+
+
+/*
+  Start modulating the (already running) signal, if we should. startSignal() calls this last
+  thing, so any change to the signal starts the modulation again around the new settings..
+                                                                                    */
+void startModulation() {
+
+  stopModulation();
+  if (modulation.type == 0) return;
+  float_t rate = constrain(modulation.rate, 0.01, modRateMAX);
+  // (Older presets can have FM at 100%)..
+  uint8_t depth = (modulation.type == 'f' && modulation.depth > fmDepthMAX) ? fmDepthMAX : modulation.depth;
+
+  switch (mode) {
+
+    case 't' :
+      // Per-sample, in the DDS engine. Dual Channel has the stereo path to itself..
+      if (!ddsRunning || useDual) return;
+      ddsModPulse = pulse;
+      ddsModDepth = depth;
+      ddsModTuning = synthTuningWord(rate, ddsSampleRate);
+      ddsModType = modulation.type; // Last; the writer starts modulating as soon as it sees this.
+      return;
+
+    case 'r' :
+    case 's' :
+      if (modulation.type == 'a' || (mode == 's' && modulation.type == 'p')) return;
+      if (modTimer == NULL) {
+        esp_timer_create_args_t timerArgs = {};
+        timerArgs.callback = &modUpdate;
+        timerArgs.name = "modulation";
+        if (esp_timer_create(&timerArgs, &modTimer) != ESP_OK) {
+          modTimer = NULL;
+          return;
+        }
+      }
+      if (!startStepWorker()) return;
+      // Nyquist, for a 1kHz update rate, with a bit to spare..
+      if (rate > 100) rate = 100;
+      modTimerState.mode = mode;
+      modTimerState.type = modulation.type;
+      modTimerState.depth = depth;
+      modTimerState.baseFreq = frequency;
+      modTimerState.basePulse = pulse;
+      modTimerState.phase = 0;
+      modTimerState.failed = 0;
+      modTimerState.failedLogged = 0;
+      modTimerState.step = synthTuningWord(rate, 1000000 / modInterval);
+      portENTER_CRITICAL(&stepMux);
+      modRunning = true;
+      portEXIT_CRITICAL(&stepMux);
+      esp_timer_start_periodic(modTimer, modInterval);
+      return;
+  }
+}
+
+
+void stopModulation() {
+  if (modTimer != NULL) esp_timer_stop(modTimer);
+  // As stopSweep(); a callback that's still going can't leave a step behind..
+  portENTER_CRITICAL(&stepMux);
+  modRunning = false;
+  modPending = false;
+  portEXIT_CRITICAL(&stepMux);
+  ddsModType = 0;
+}
+
+
+/*
+  The modulation timer callback (rectangle and sine modes).
+
+  Same rules as the sweep timer; it works out the next frequency (or pulse width) and the step
+  worker puts it on the hardware, with the signal lock held, so it never lands in the middle of a
+  startSignal() setting the LEDC up again. Sweeps and songs own the frequency while they're running,
+  so we sit those out..
+                                                        */
+void modUpdate(void *param) {
+
+  if (mode != modTimerState.mode) {
+    esp_timer_stop(modTimer);
+    return;
+  }
+  if (sweep.running || songPlayer.playing) return;
+
+  modTimerState.phase += modTimerState.step;
+  float_t lfo = synthSine()[modTimerState.phase >> 24] / 127.0;  // -1 to 1
+
+  float_t next;
+  if (modTimerState.type == 'f') {
+    next = modTimerState.baseFreq * (1 + lfo * modTimerState.depth / 100.0);
+  } else if (modTimerState.type == 'p') {
+    next = constrain(modTimerState.basePulse + lfo * modTimerState.depth, 0, 100);
+  } else {
+    return;
+  }
+
+  portENTER_CRITICAL(&stepMux);
+  bool queued = modRunning;
+  if (queued) {
+    modNext = next;
+    modPending = true;
+  }
+  portEXIT_CRITICAL(&stepMux);
+
+  if (queued) xTaskNotifyGive(stepTask);
+}
+
+
+String modulationReport() {
+
+  char mbuf[256];
+  const char *types[] = { "AM", "FM", "PWM" };
+  uint8_t t = (modulation.type == 'a') ? 0 : (modulation.type == 'f') ? 1 : 2;
+
+  if (modulation.type == 0) return "Modulation: off";
+
+  sprintf(mbuf, "Modulation: %s, depth %i%s, rate %s", types[t], modulation.depth,                   (modulation.type == 'p') ? " points" : "%", makeHumanFrequency(modulation.rate).c_str());
+
+  // Say so if it isn't actually happening..
+  if (mode == 't' && useDual) {
+    strcat(mbuf, " (not in Dual Channel mode)");
+  } else if (mode == 't' && !useDDS) {
+    strcat(mbuf, " (needs DDS)");
+  } else if (modulation.type == 'a' && mode != 't') {
+    strcat(mbuf, " (Triangle wave only)");
+  } else if (modulation.type == 'p' && mode == 's') {
+    strcat(mbuf, " (not for Sine wave)");
+  }
+  return (String)mbuf;
+}
+
+
+/*
+  Times for pulse trains: "500us", "10ms", "2.5s", or plain microseconds. Returns 0 if it makes
+  no sense (or is over an hour, which is about all a uint32_t of microseconds can hold)..
+                                                                                    */
+uint32_t humanTimeToMicros(String time) {
+  time.trim();
+  time.toLowerCase();
+  double multiplier = 1;
+  if (time.endsWith("us")) {
+    time = time.substring(0, time.length() - 2);
+  } else if (time.endsWith("ms")) {
+    time = time.substring(0, time.length() - 2);
+    multiplier = 1000;
+  } else if (time.endsWith("s")) {
+    time = time.substring(0, time.length() - 1);
+    multiplier = 1000000;
+  }
+  double us = time.toFloat() * multiplier;
+  if (us < 0 || us > 3600000000.0) return 0;
+  return (uint32_t)(us + 0.5);
+}
+
+// .. and back again..
+String makeHumanTime(uint64_t us) {  // (64 bits; an RMT pass of 100us ticks can run past 71 minutes)
+  char tbuf[24];
+  if (us >= 1000000) sprintf(tbuf, "%gs", us / 1000000.0);
+    else if (us >= 1000) sprintf(tbuf, "%gms", us / 1000.0);
+      else sprintf(tbuf, "%uus", (uint32_t)us);
+  return (String)tbuf;
+}
+
+
+/*
+  Set up a pulse train, import-style (key=value, comma-separated)..
+
+    f = frequency (sub-Hz is fine, e.g. f=0.2), or t = period (e.g. t=5s)
+    w = width, as a time (w=10ms) or a percentage of the period (w=25%)
+    n = pulses per burst (0 == keep going)
+    g = gap after each burst (0 == just the one burst)
+    s = your own sequence, high/low/high/low.. e.g. s=10ms/5ms/20ms/5ms (n and g then count those)
+
+  Setting f or t goes back to regular pulses. Returns "" if all's well, or what's wrong..
+                                                                                    */
+String trainSettings(String data, PulseTrain &t) {
+
+  float_t widthPercent = -1;
+  data.trim();
+  data += ",";
+
+  while (data.indexOf(',') != -1) {
+    String setting = data.substring(0, data.indexOf(','));
+    data = data.substring(data.indexOf(',') + 1);
+    setting.trim();
+    if (setting.length() < 3 || setting[1] != '=') continue;
+    String value = setting.substring(2);
+
+    switch (setting[0]) {
+      case 'f' : {
+        float_t f = humanFreqToFloat(value);
+        if (f <= 0 || f > 500000) return "Frequency must be above 0 and no more than 500kHz.";
+        t.period = (uint32_t)(1000000.0 / f + 0.5);
+        t.steps = 0;
+        break;
+      }
+      case 't' :
+        t.period = humanTimeToMicros(value);
+        t.steps = 0;
+        break;
+      case 'w' :
+        if (value.endsWith("%")) widthPercent = value.toFloat();
+          else t.width = humanTimeToMicros(value);
+        break;
+      case 'n' :
+        t.count = value.toInt();
+        break;
+      case 'g' :
+        t.gap = humanTimeToMicros(value);
+        break;
+      case 's' : {
+        value += "/";
+        t.steps = 0;
+        while (value.indexOf('/') != -1 && t.steps < pulseSequenceMAX) {
+          uint32_t us = humanTimeToMicros(value.substring(0, value.indexOf('/')));
+          value = value.substring(value.indexOf('/') + 1);
+          if (us == 0) return "Sequence times must be more than 0.";
+          t.sequence[t.steps++] = us;
+        }
+        break;
+      }
+      default :
+        return "Unknown setting: " + setting;
+    }
+  }
+
+  if (widthPercent >= 0) t.width = (uint32_t)(t.period * widthPercent / 100.0 + 0.5);
+  if (t.steps == 0) {
+    if (t.period < 2) return "The period must be at least 2us.";
+    if (t.width == 0 || t.width >= t.period) return "The width must be more than 0 and less than the period.";
+  }
+  if (t.count > trainItemsMAX) return "That's too many pulses for one burst (" + (String)trainItemsMAX + " max).";
+  return "";
+}
+
+
+// Store the pulse train in the main namespace (it's a device thing, not a preset setting)..
+void saveTrain() {
+  if (prefsNamespace == 0) prefs.putBytes("T", &train, sizeof(PulseTrain));
+}
+
+
+/*
+  Start the pulse train on the RMT..
+
+  The whole thing is encoded up front (see Pulse.h). Continuous trains and bursts with gaps go round
+  in the RMT's loop mode, so they must fit in its memory; a single burst can be longer, and the driver
+  streams it from the heap. If 1us ticks won't fit, we try again with 100us ticks (from the 1MHz
+  REF_TICK, so slow trains don't care about the CPU frequency, either), but only if that doesn't
+  move any of its times more than 1% (see pulsePlan()).
+                                                                                    */
+String startTrain() {
+
+  stopSignal(); // Including any train we already had
+  trainItems = (uint32_t *)malloc(trainItemsMAX * sizeof(uint32_t));
+  if (trainItems == NULL) return "Not enough memory for a pulse train!";
+
+  uint32_t errorPPM;
+  trainItemCount = pulsePlan(train, trainItems, trainTickUs, trainLoop, errorPPM);
+  if (trainItemCount == 0) {
+    free(trainItems);
+    trainItems = NULL;
+    if (errorPPM > pulseErrorMAX) {
+      char tbuf[192];
+      sprintf(tbuf, "That train only fits with %uus ticks, which would put its times out by up to %.0f%%! "
+                  "Use times in whole %uus steps, or fewer pulses.", trainTickUs, errorPPM / 10000.0, trainTickUs);
+      return (String)tbuf;
+    }
+    return "That train is too long for the RMT! Try fewer pulses (or a shorter sequence).";
+  }
+
+  rmt_config_t config = RMT_DEFAULT_CONFIG_TX((gpio_num_t)PWMPin, trainChannel);
+  config.mem_block_num = trainBlocks;
+  config.clk_div = (trainTickUs == 1) ? getApbFrequency() / 1000000 : 100;
+  config.tx_config.loop_en = trainLoop;
+  config.tx_config.idle_level = RMT_IDLE_LEVEL_LOW;
+  config.tx_config.idle_output_en = true;
+
+  if (rmt_config(&config) != ESP_OK || \
+      (trainTickUs != 1 && rmt_set_source_clk(trainChannel, RMT_BASECLK_REF) != ESP_OK) || \
+      rmt_driver_install(trainChannel, 0, 0) != ESP_OK) {
+    free(trainItems);
+    trainItems = NULL;
+    return "Could not start the RMT!";
+  }
+  trainRunning = true;
+  rmt_write_items(trainChannel, (rmt_item32_t *)trainItems, trainItemCount, false);
+  return "";
+}
+
+
+void stopTrain() {
+  if (!trainRunning) return;
+  rmt_tx_stop(trainChannel);
+  rmt_driver_uninstall(trainChannel);
+  free(trainItems);
+  trainItems = NULL;
+  trainRunning = false;
+  reallyDetatchPWM(); // Hand the pin back (the square wave attaches it again when it starts)
+}
+
+
+String trainReport() {
+
+  char tbuf[512];
+  const PulseTrain &t = train;
+
+  sprintf(tbuf, "\n Pulse Train (pin %i): %s\n\n", PWMPin, (!trainRunning) ? "stopped" : \
+                    (!trainLoop && rmt_wait_tx_done(trainChannel, 0) == ESP_OK) ? "finished" : "running");
+  if (t.steps > 0) {
+    String seq = "";
+    for (uint8_t i = 0; i < t.steps; i++) seq += ((i) ? "/" : "") + makeHumanTime(t.sequence[i]);
+    sprintf(tbuf + strlen(tbuf), "\tSequence:\t%s (high/low..)\n", seq.c_str());
+  } else {
+    sprintf(tbuf + strlen(tbuf), "\tPeriod:\t\t%s (%s), width %s (%.4g%%)\n", makeHumanTime(t.period).c_str(), \
+          makeHumanFrequency(1000000.0 / t.period).c_str(), makeHumanTime(t.width).c_str(), 100.0 * t.width / t.period);
+  }
+  if (t.count == 0) {
+    sprintf(tbuf + strlen(tbuf), "\tBursts:\t\tnone, it just keeps going\n");
+  } else {
+    sprintf(tbuf + strlen(tbuf), "\tBursts:\t\t%u at a time, %s\n", t.count, (t.gap) ? \
+                          ("then " + makeHumanTime(t.gap) + " gap, repeating").c_str() : "just the once");
+  }
+  if (trainRunning) {
+    PulseMeasure m = pulseMeasure(trainItems, trainItemCount);
+    sprintf(tbuf + strlen(tbuf), "\tRMT:\t\t%u items, %uus ticks, %s, %u pulses per pass (%s high, %s low)\n", \
+                trainItemCount, trainTickUs, (trainLoop) ? "looping" : "one-shot", m.pulses, \
+                makeHumanTime(m.high * trainTickUs).c_str(), makeHumanTime(m.low * trainTickUs).c_str());
+    uint32_t errorPPM = pulseErrorPPM(t, trainTickUs);
+    if (errorPPM) sprintf(tbuf + strlen(tbuf), "\t\t\t(times rounded to %uus ticks; out by up to %.2f%%)\n", \
+                                                                          trainTickUs, errorPPM / 10000.0);
+  }
+  return (String)tbuf;
+}
+
+
+
+
+/*
+  Add a command to the queue (from any task). Returns false if the queue is full.
+                                                                            */
+bool queueCommand(CommandSource source, const String &text) {
+
+  uint32_t position = queueHead.load(std::memory_order_relaxed);
+  QueuedCommand *slot;
+
+  while (true) {
+    slot = &commandQueue[position & (commandQueueSize - 1)];
+    int32_t turn = (int32_t)slot->sequence.load(std::memory_order_acquire) - (int32_t)position;
+    if (turn == 0) {
+      // Our turn; claim it (if nobody else just did)..
+      if (queueHead.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) break;
+    } else if (turn < 0) {
+      queueStats.dropped[source].fetch_add(1, std::memory_order_relaxed); // Full!
+      return false;
+    } else {
+      position = queueHead.load(std::memory_order_relaxed); // Someone beat us to it; try the next.
+    }
+  }
+
+  slot->source = source;
+  slot->text = text;
+  slot->sequence.store(position + 1, std::memory_order_release); // Ready to run.
+
+  queueStats.queued[source].fetch_add(1, std::memory_order_relaxed);
+  uint8_t waiting = commandsWaiting();
+  uint8_t highWater = queueStats.highWater.load(std::memory_order_relaxed);
+  while (waiting > highWater && \
+         !queueStats.highWater.compare_exchange_weak(highWater, waiting, std::memory_order_relaxed));
+  return true;
+}
+
+
+// Take the next command from the queue (loop() only). Returns false if there isn't one.
+bool nextCommand(CommandSource &source, String &text) {
+
+  uint32_t position = queueTail.load(std::memory_order_relaxed);
+  QueuedCommand *slot = &commandQueue[position & (commandQueueSize - 1)];
+
+  if ((int32_t)slot->sequence.load(std::memory_order_acquire) - (int32_t)(position + 1) < 0) return false;
+
+  source = slot->source;
+  text = slot->text;
+  slot->text = ""; // Give the memory back.
+  queueTail.store(position + 1, std::memory_order_relaxed);
+  slot->sequence.store(position + commandQueueSize, std::memory_order_release); // Free for reuse.
+  return true;
+}
+
+
+// Is the next command in the queue an "end"? (loop() only)
+bool endWaiting() {
+  uint32_t position = queueTail.load(std::memory_order_relaxed);
+  QueuedCommand *slot = &commandQueue[position & (commandQueueSize - 1)];
+  if ((int32_t)slot->sequence.load(std::memory_order_acquire) - (int32_t)(position + 1) < 0) return false;
+  String text = slot->text;
+  text.trim();
+  return (text == "end");
+}
+
+
+uint8_t commandsWaiting() {
+  return queueHead.load(std::memory_order_relaxed) - queueTail.load(std::memory_order_relaxed);
+}
+
+
+// Number the slots (once, in setup())..
+void startCommandQueue() {
+  for (uint8_t i = 0; i < commandQueueSize; i++) commandQueue[i].sequence.store(i, std::memory_order_relaxed);
+  for (uint8_t i = 0; i < commandSources; i++) {
+    queueStats.queued[i].store(0, std::memory_order_relaxed);
+    queueStats.dropped[i].store(0, std::memory_order_relaxed);
+  }
+  queueStats.highWater.store(0, std::memory_order_relaxed);
+  queueStats.serialOverflows.store(0, std::memory_order_relaxed);
+}
+
+
+/*
+  Put serial input together into lines, without waiting.
+
+  Whatever bytes have arrived get added to the current line; a new-line sends it to the queue.
+  If the queue is full, we leave the bytes in the UART buffer until there's room, so nothing is
+  lost (unless /that/ fills up too). Lines too long to be a command are dropped, and counted.
+                                                                                    */
+void serialIngest() {
+
+  if (binaryMode) {
+    binaryIngest();
+    return;
+  }
+
+  uint16_t budget = 256; // Don't hog the void, either.
+
+  while (budget-- && Serial.available() > 0) {
+
+    // Backpressure..
+    if (commandsWaiting() >= commandQueueSize) return;
+
+    char c = Serial.read();
+
+    if (c == '\n') {
+      if (serialOverflow) {
+        queueStats.serialOverflows.fetch_add(1, std::memory_order_relaxed);
+        queueStats.dropped[FROM_SERIAL].fetch_add(1, std::memory_order_relaxed);
+      } else {
+        queueCommand(FROM_SERIAL, serialLine);
+      }
+      serialLine = "";
+      serialOverflow = false;
+    } else if (c != '\r') {
+      if (serialLine.length() < serialLineMAX) {
+        serialLine += c;
+      } else {
+        serialOverflow = true;
+      }
+    }
+  }
+}
+
+
+/*
+  Binary mode: put frames together from the serial bytes, check them and act on them.
+                                                                            */
+void binaryIngest() {
+
+  uint32_t now = millis();
+  if (binaryFill != 0 && now - binaryByteTime > binaryTimeout) {
+    portENTER_CRITICAL(&binaryMux);
+    binaryStats.timeouts++;
+    portEXIT_CRITICAL(&binaryMux);
+    binaryFill = 0;
+  }
+
+  uint16_t budget = 256;
+  while (budget-- && Serial.available() > 0) {
+
+    uint8_t b = Serial.read();
+    binaryByteTime = now;
+
+    // Waiting for the start of a frame..
+    if (binaryFill == 0 && b != binarySync) {
+      portENTER_CRITICAL(&binaryMux);
+      binaryStats.discarded++;
+      portEXIT_CRITICAL(&binaryMux);
+      continue;
+    }
+    // Length byte out of range? Not a frame, after all..
+    if (binaryFill == 1 && (b == 0 || b > binaryFrameMAX)) {
+      portENTER_CRITICAL(&binaryMux);
+      binaryStats.discarded += 2;
+      portEXIT_CRITICAL(&binaryMux);
+      binaryFill = 0;
+      continue;
+    }
+
+    binaryFrame[binaryFill++] = b;
+
+    // Sync + length + <len> bytes + two of CRC..
+    if (binaryFill >= 4 && binaryFill == binaryFrame[1] + 4) {
+      binaryFill = 0;
+      uint8_t len = binaryFrame[1];
+      uint16_t crc = binaryFrame[len + 2] | (binaryFrame[len + 3] << 8);
+      if (crc != crc16(binaryFrame + 1, len + 1)) {
+        portENTER_CRITICAL(&binaryMux);
+        binaryStats.crcErrors++;
+        portEXIT_CRITICAL(&binaryMux);
+        binaryReply(binaryFrame[2], BIN_BAD_CRC);
+        continue;
+      }
+      uint32_t start = micros();
+      binaryReply(binaryFrame[2], binaryCommand(binaryFrame[2], binaryFrame + 3, len - 1));
+      uint32_t took = micros() - start;
+      portENTER_CRITICAL(&binaryMux);
+      binaryStats.busy += took;
+      binaryStats.frames++;
+      portEXIT_CRITICAL(&binaryMux);
+      if (!binaryMode) return; // Back to text.
+    }
+  }
+}
+
+
+// Act on one (good) frame..
+BinaryStatus binaryCommand(uint8_t op, const uint8_t *data, uint8_t length) {
+
+  SignalLock hold;
+  String result;
+
+  switch (op) {
+
+    case BIN_FREQUENCY : {
+      if (length != sizeof(float_t)) return BIN_BAD_VALUE;
+      float_t newFreq;
+      memcpy(&newFreq, data, sizeof(float_t));
+      if (!isfinite(newFreq) || newFreq <= 0) return BIN_BAD_VALUE;
+      setFrequency(newFreq, false, false);
+      startSignal("Binary");
+      return (didLimit) ? BIN_LIMITED : BIN_OK;
+    }
+
+    case BIN_MODE :
+      if (length != 1 || (data[0] != 'r' && data[0] != 's' && data[0] != 't')) return BIN_BAD_VALUE;
+      if (mode != (char)data[0]) {
+        setMode(data[0]);
+        startSignal("Binary");
+      }
+      return BIN_OK;
+
+    case BIN_PULSE :
+      if (length != 1 || data[0] > 100) return BIN_BAD_VALUE;
+      setPulseWidth(data[0]);
+      startSignal("Binary");
+      return BIN_OK;
+
+    case BIN_AMPLITUDE :
+      if (length != 1 || !setAmplitude(data[0])) return BIN_BAD_VALUE;
+      if (mode != 'r') startSignal("Binary");
+      return BIN_OK;
+
+    case BIN_LOAD :
+      if (length != 1 || data[0] > presetMAX) return BIN_BAD_VALUE;
+      result = loadPreset(data[0]);
+      if (!result.startsWith("Loading")) return BIN_NO_PRESET;
+      startSignal("Binary");
+      return BIN_OK;
+
+    case BIN_SAVE :
+      if (length != 1 || data[0] > presetMAX) return BIN_BAD_VALUE;
+      result = savePreset(data[0]);
+      return (result.indexOf(": OK") != -1) ? BIN_OK : BIN_SAVE_FAILED;
+
+    case BIN_STATUS :
+      return BIN_OK;
+
+    case BIN_TEXT :
+      binaryEnd();
+      return BIN_OK;
+  }
+  return BIN_BAD_OP;
+}
+
+
+// Send the compact answer; what happened and where we are now..
+void binaryReply(uint8_t op, BinaryStatus status) {
+  uint8_t reply[16];
+  float_t freq = frequency;
+  reply[0] = binaryReplySync;
+  reply[1] = 10;
+  reply[2] = op | 0x80;
+  reply[3] = status;
+  memcpy(reply + 4, &freq, sizeof(float_t));
+  reply[8] = mode;
+  reply[9] = pulse;
+  reply[10] = PWMResBits;
+  reply[11] = waveAmplitude;
+  uint16_t crc = crc16(reply + 1, 11);
+  reply[12] = crc & 0xFF;
+  reply[13] = crc >> 8;
+  Serial.write(reply, 14);
+}
+
+
+// CRC-16/CCITT-FALSE. Bit by bit; frames are tiny, so a table would be all cost, no gain.
+uint16_t crc16(const uint8_t *data, uint8_t length) {
+  uint16_t crc = 0xFFFF;
+  while (length--) {
+    crc ^= (uint16_t)(*data++) << 8;
+    for (uint8_t i = 0; i < 8; i++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : (crc << 1);
+  }
+  return crc;
+}
+
+
+/*
+  Switch serial to binary frames. Extended info goes quiet (it would land in the middle of our
+  frames); it comes back when you send the text frame (0x7F), or after a reboot.
+                                                                              */
+void binaryStart() {
+  binaryXi = eXi;
+  eXi = false;
+  binaryFill = 0;
+  portENTER_CRITICAL(&binaryMux);
+  memset(&binaryStats, 0, sizeof(binaryStats));
+  binaryStats.started = millis();
+  portEXIT_CRITICAL(&binaryMux);
+  Serial.flush();
+  binaryMode = true;
+}
+
+void binaryEnd() {
+  binaryMode = false;
+  eXi = binaryXi;
+}
+
 
-  Don't assign anything, just print out what's stored in the NVRAM..
+/*
+  Binary mode statistics..
 
-  During very first init, we silently run through all 50* presets so that the NameSpace memory is
-  pre-allocated and the user doesn't get confused when they list their presets for the first time
-  (and 50* entries "vanish"). It also means when saving presets the change in the number of entries
-  reflects the actual settings. It only takes a moment.
+  usage: binary?
+                    */
+String binaryReport() {
+  char bbuf[320];
+  portENTER_CRITICAL(&binaryMux);
+  BinaryStats stats = binaryStats;
+  portEXIT_CRITICAL(&binaryMux);
+  uint32_t seconds = (millis() - stats.started) / 1000;
+  sprintf(bbuf, "\n Binary Mode: %s\n\n\tFrames:\t\t%u (%u per second)\n\tCRC Errors:\t%u\n" \
+                "\tTimed Out:\t%u\n\tBytes Skipped:\t%u\n\tTime per Frame:\t%.1fus (on the generator)\n", \
+                (binaryMode) ? "On" : "Off", stats.frames, (seconds) ? stats.frames / seconds : 0, \
+                stats.crcErrors, stats.timeouts, stats.discarded, \
+                (stats.frames) ? (float_t)stats.busy / stats.frames : 0);
+  return (String)bbuf;
+}
 
-  * or whatever you set in your prefs
-                                                                                   */
-String getNVRAMPresetData(uint8_t presetNumber = 0, bool listing = false, bool silent = false) {
 
-  char thisType[16];
+/*
+  Command queue statistics..
 
-  if (presetNumber != 0) {
-    prefsSwitch(presetNumber);
-    if (!silent) {
-      // Check this preset exists..
-      if (prefs.getChar("i", -1) == -1) {
-        if (!listing) LastMessage = "Preset " + (String)presetNumber + " does not exist";
-        prefsSwitch();
-        return "";
-      }
-      sprintf(thisType, " for Preset %i", presetNumber);
-    }
+  usage: queue
+                    */
+String queueReport() {
+  char qbuf[512];
+  sprintf(qbuf, "\n Command Queue: %u waiting (most ever: %u of %u)\n\n", \
+                                          commandsWaiting(), queueStats.highWater.load(), commandQueueSize);
+  for (uint8_t i = 0; i < commandSources; i++) {
+    sprintf(qbuf + strlen(qbuf), "\t%-10s%u queued, %u dropped\n", sourceNames[i], \
+                                                      queueStats.queued[i].load(), queueStats.dropped[i].load());
   }
+  uint32_t overflows = queueStats.serialOverflows.load();
+  if (overflows) sprintf(qbuf + strlen(qbuf), "\tSerial lines too long: %u (%u bytes maximum)\n", overflows, serialLineMAX);
+  return (String)qbuf;
+}
 
-  char nvbuf[1024] = {'\0'}; // Prevents re-listings of non-existent presets (with loop data inside)
-  if (!silent) {             // as the array is still there in the stack.
-    if (presetNumber != 0) {
-      if (!presetEmpty()) {
-        sprintf(nvbuf, "\n NVRAM Settings%s: ", thisType);
-        String nTmp = prefs.getString("n", "");
-        if (nTmp != "") {
-          sprintf(nvbuf + strlen(nvbuf), "\n\n\t\"%s\"\n\n", nTmp.c_str());
-        } else {
-          sprintf(nvbuf + strlen(nvbuf), "\n\n");
-        }
-      }
-    } else {
-      sprintf(nvbuf, "\n\tDefault NVRAM Settings:\n\n");
-    }
 
-    char bpl;
-    if (prefs.getUChar("b") != 1) bpl = 's';
 
-    // Only collect prefs that exist..
-    if (prefs.getChar("m", '~') != '~') {
-      sprintf(nvbuf + strlen(nvbuf), "\tGenerator Mode:\t\t%s Wave\n", makeHumanMode(prefs.getChar("m")).c_str());
-    }
-    if (prefs.getFloat("f", -1) != -1) {
-        sprintf(nvbuf + strlen(nvbuf), "\tFrequency:\t\t%s\n", makeHumanFrequency(prefs.getFloat("f")).c_str());
-    }
-    if (prefs.getUChar("a", '~') != '~') {
-      sprintf(nvbuf + strlen(nvbuf), "\tAmplitude Level:\t%i \n", prefs.getUChar("a"));
-    }
-    if (prefs.getFloat("s", -1) != -1) {
-      sprintf(nvbuf + strlen(nvbuf), "\tFrequency Step:\t\t%s \n", makeHumanFrequency(prefs.getFloat("s")).c_str());
-    }
-    if (prefs.getUChar("p", '~') != '~') {
-      sprintf(nvbuf + strlen(nvbuf), "\tPulse Width:\t\t%i%% \n", prefs.getUChar("p"));
-    }
-    if (prefs.getUChar("j", '~') != '~') {
-      sprintf(nvbuf + strlen(nvbuf), "\tPWM Step:\t\t%i%% \n", prefs.getUChar("j"));
-    }
-    if (prefs.getUChar("b", '~') != '~') {
-      sprintf(nvbuf + strlen(nvbuf), "\tPWM resolution:\t\t%i bit%c\n", prefs.getUChar("b"), bpl);
-    }
-    if (prefs.getChar("h", '~') != '~') {
-      sprintf(nvbuf + strlen(nvbuf), "\tTouch Mode:\t\t%s\n", makeHumanTouchMode(prefs.getChar("h")).c_str());
-    }
 
-    if (eXi && !listing) sprintf(nvbuf + strlen(nvbuf), getFreeEntries().c_str());
+/*
+  Push an event to every open web page (see handleEvents()).
+
+  <type> is the event name (status, message, names, preset, ...), <data> can be multi-line, and
+  <id> (if it isn't 0) numbers it. Nothing here waits on a page (see eventFlush()); pages that
+  can't keep up get dropped (they reconnect by themselves).
+                                                                        */
+void pushEvent(const char *type, const String &data) {
+  pushEvent(type, data, 0);
+}
+
+void pushEvent(const char *type, const String &data, uint32_t id) {
+#if defined REMOTE
+  if (eventClientCount() == 0) return;
+
+  String event = "event: " + (String)type + "\n";
+  if (id) event += "id: " + (String)id + "\n";
+  int16_t start = 0;
+  while (true) {
+    int16_t lineEnd = data.indexOf('\n', start);
+    event += "data: " + data.substring(start, (lineEnd == -1) ? data.length() : lineEnd) + "\n";
+    if (lineEnd == -1) break;
+    start = lineEnd + 1;
   }
+  event += "\n";
 
-  if (presetNumber != 0) prefsSwitch();
-  return (String)nvbuf;
+  for (uint8_t i = 0; i < eventClientsMAX; i++) {
+    if (!eventClients[i].connected()) continue;
+    if (eventBacklog[i].length() + event.length() > eventBacklogMAX) {
+      eventDrop(i);
+      continue;
+    }
+    eventBacklog[i] += event;
+    if (!eventFlush(i)) eventDrop(i);
+  }
+#endif
 }
 
 
-
+#if defined REMOTE
 /*
-  Return the list of presets and their settings as a String.
-
-  The first time you run this, 50* NameSpaces get created, using 50 "entries".
-  These are your 50 available presets. (*or whatever number you set in your prefs, above)
+  Hand a page as much of its backlog as its socket will take right now. WiFiClient::write() waits
+  for room (for up to ten seconds), which would stop loop() dead behind one slow phone; so we go
+  straight to the socket, without waiting. false if the connexion is broken..
+                                                                        */
+bool eventFlush(uint8_t i) {
+  while (eventBacklog[i].length()) {
+    int sent = lwip_send(eventClients[i].fd(), eventBacklog[i].c_str(), eventBacklog[i].length(), MSG_DONTWAIT);
+    if (sent < 0) return (errno == EAGAIN || errno == EWOULDBLOCK); // Full; try again next pass
+    if (sent == 0) return false;
+    eventBacklog[i].remove(0, sent);
+  }
+  return true;
+}
 
-  This function needs to be below getNVRAMPresetData() or Arduino IDE prototype generator pukes.
 
-                                     */
-String listPresets(bool init = false) {
-  String xMSG, tmpString;
-  for( uint8_t i = 1; i <= presetMAX; i++ ) xMSG += getNVRAMPresetData(i, true, init);
-  xMSG = (xMSG != "") ? "Listing Preset Memories..\n" + xMSG : "No Presets Exist!\n";
-  if (!init) return xMSG + getFreeEntries();
-  return getFreeEntries();
+void eventDrop(uint8_t i) {
+  eventClients[i].stop();
+  eventBacklog[i] = "";
 }
-
+#endif
 
 
 /*
-  Return the stored loops/macros as a String (command: ll / lll)
-
-  Output can be imported directly into Signal Generator..
+  Called every pass of the void. If anything has changed, tell the pages.
 
-    ll
-
-  for individual lines (one for each stored loop/macro)
-
-    lll
+  No more than four times a second (a sweep changes frequency a thousand times a second; nobody
+  needs to read that). Whatever the latest state is when we get around to it, gets sent; messages
+  are queued as they come (see pushMessages), so a quick run of commands doesn't lose any.
+                                                                                        */
+void pushUpdates() {
+#if defined REMOTE
+  if (eventClientCount() == 0) return;
 
-  for one long line containing all loops/macros so you can import them all-at-once.
+  // Every pass; the rest of anything they couldn't take last time, and every new message..
+  for (uint8_t i = 0; i < eventClientsMAX; i++) {
+    if (eventBacklog[i].length() && !eventFlush(i)) eventDrop(i);
+  }
+  if (LastMessage != "" && LastMessage != queuedMessage) {
+    pushMessages[pushMessageCount % pushMessagesMAX] = LastMessage;
+    queuedMessage = LastMessage;
+    pushMessageCount++;
+    if (pushMessageCount - pushMessageSent > pushMessagesMAX) pushMessageSent = pushMessageCount - pushMessagesMAX;
+  }
 
-                                 */
-String listLoops(bool oneLine) {
+  uint32_t now = millis();
+  if (now - pushTime < 250) return;
 
-  String xMSG, loopEnd = "\n", divider = "";
-  if (oneLine) {
-    loopEnd = commandDelimiter;
-    divider = "\n";
+  while (pushMessageSent < pushMessageCount) {
+    pushEvent("message", pushMessages[pushMessageSent % pushMessagesMAX], pushMessageSent + 1);
+    pushMessageSent++;
+    pushTime = now;
   }
-  String sLoops = prefs.getString("o", "");
-  if (sLoops != "") xMSG = " loop=" + sLoops + loopEnd;
 
-  for( uint8_t i = 1; i <= presetMAX; i++ ) {
-    prefsSwitch(i);
-    sLoops = prefs.getString("o", "");
-    if (sLoops != "") xMSG += " loop" + (String)i + "=" + sLoops + loopEnd;
+  PushState state = {};
+  state.mode = mode;
+  state.frequency = frequency;
+  state.pulse = pulse;
+  state.bits = PWMResBits;
+  state.amplitude = waveAmplitude;
+  state.looping = iLooping;
+
+  // (Field by field; memcmp() would compare the padding, too)..
+  if (state.mode != pushedState.mode || state.frequency != pushedState.frequency || \
+      state.pulse != pushedState.pulse || state.bits != pushedState.bits || \
+      state.amplitude != pushedState.amplitude || state.looping != pushedState.looping) {
+    // Wave, frequency, loop state, then the same settings /status gives you..
+    pushEvent("status", makeHumanMode(mode) + "\n" + makeHumanFrequency(frequency) + "\n" + \
+                        ((iLooping) ? "looping" : "") + "\n" + getCurrentSettings());
+    pushedState = state;
+    pushTime = now;
   }
 
-  prefsSwitch();
-  return (xMSG != "") ? "Listing Stored Loops/Macros..\n\n" + xMSG + divider + getFreeEntries(): "No loops found!";
+  // Keep quiet connexions alive..
+  if (now - pingTime > 15000) {
+    pushEvent("ping", "");
+    pingTime = now;
+  }
+#endif
 }
 
 
-
 /*
+  Called every pass of the void. Answers the batch command that just finished (see handleBatch())
+  and queues up the next one.
+                                */
+void batchStep() {
+#if defined REMOTE
+  if (batch.running) {
+
+    // Not finished until the whole chain (and any delays) has played..
+    if (QCommand != "" || amDelaying) return;
+
+    char result[192];
+    sprintf(result, ",\"status\":\"%s\",\"wave\":\"%s\",\"frequency\":%.3f,\"pulse\":%u,\"us\":%u}", \
+                    didLimit ? "limited" : "ok", makeHumanMode(mode).c_str(), frequency, pulse, micros() - batch.started);
+    String message = LastMessage;
+    message.trim();
+    batchClient.print(((batch.done) ? ",\n{\"command\":" : "{\"command\":") + jsonString(batch.command) + \
+                      ",\"message\":" + jsonString(message) + result);
+    batch.done++;
+    batch.running = false;
+  }
 
-  End the currently running queue/loop/macro..
+  if (!batch.open || batch.queued) return;
 
-                */
-void endLoop() {
-  iLooping = false; // Switch the looping flag
-  QCommand = "";   // Remove remaining commands from the queue
-  eXi = eXiTmp;   // Put extended info flag back to what it was before we started looping
+  // They hung up. Forget the rest..
+  if (!batchClient.connected()) {
+    if (eXi) Serial.printf(" Batch abandoned after %u commands\n", batch.done);
+    batch.lines = "";
+    batch.open = false;
+    batchClient.stop();
+    return;
+  }
+
+  // Next command. If the queue's full, we'll try again next time around..
+  while (batch.lines != "") {
+    if (commandsWaiting() >= commandQueueSize) return;
+    int16_t lineEnd = batch.lines.indexOf('\n');
+    batch.command = batch.lines.substring(0, (lineEnd == -1) ? batch.lines.length() : lineEnd);
+    batch.lines = (lineEnd == -1) ? "" : batch.lines.substring(lineEnd + 1);
+    batch.command.trim();
+    if (batch.command == "") continue;
+    batch.queued = queueCommand(FROM_BATCH, batch.command);
+    return;
+  }
+
+  // All done..
+  batchClient.print("]\n");
+  batchClient.stop();
+  batch.open = false;
+  if (eXi) Serial.printf(" Batch complete: %u commands\n", batch.done);
+#endif
 }
 
 
@@ -3010,7 +7539,7 @@ void startServer() {
   bool WebControl = true;
   bool APControl = true;
 
-  if (eXi && softAPSSID == "") Serial.println("\n Soft Access Point Disabled.");
+  if (eXi && (!haveSoftAP || softAPSSID == "")) Serial.println("\n Soft Access Point Disabled.");
 
   if (onlyAP && softAPSSID != "") {
 
@@ -3048,7 +7577,7 @@ void startServer() {
   }
 
   // Access Point..
-  if (RemControl && softAPSSID != "") {
+  if (haveSoftAP && RemControl && softAPSSID != "") {
 
     // You can customise the IP address.. (default is 192.168.4.1)
     IPAddress local_IP(192,168,4,1); // NOTE: commas.
@@ -3205,6 +7734,7 @@ void startServer() {
 
     // WebConsole holy sh*t!
     server.on("/console", sendWebConsole);
+    server.on("/consoleData", sendConsoleData);
     server.on("/LastMessage", handleLastMessage);
 
     // A simple up/down page
@@ -3241,6 +7771,34 @@ void startServer() {
     // 404 errors.. Or are they!?! What magic awaits..
     server.onNotFound(handleWebConsole);
 
+    // Live updates for every open page..
+    server.on("/events", handleEvents);
+
+    // Version and preset names for the main page (which is otherwise static)..
+    server.on("/pageData", sendPageData);
+
+    // Lots of commands in one request (POST, one per line), results in one JSON array..
+    server.on("/batch", HTTP_POST, handleBatch);
+
+    // Performance metrics, for Prometheus (or curl)..
+    server.on("/metrics", handleMetrics);
+
+    // Export everything (streamed), and put it all back (upload)..
+    server.on("/backup", handleBackup);
+    server.on("/restore", HTTP_POST, handleRestore, handleRestoreUpload);
+
+    // So we can tell a browser its copy of a page is still good..
+    // .. and whether it takes gzip..
+    const char *headerKeys[] = { "If-None-Match", "Accept-Encoding" };
+    server.collectHeaders(headerKeys, 2);
+    rootTag = pageTag(WebPage);
+    consoleTag = pageTag(WebConsole);
+    simpleTag = pageTag(SimplePage);
+    rootGz = (pageHash(WebPage) == WebPageGzSource);
+    consoleGz = (pageHash(WebConsole) == WebConsoleGzSource);
+    if (!rootGz) Serial.println(" WebPage.h has changed since WebPagesGz.h was made; sending it uncompressed.");
+    if (!consoleGz) Serial.println(" Console.h has changed since WebPagesGz.h was made; sending it uncompressed.");
+
     // Fire up the server..
     server.begin();
     Serial.println(" Web Server Started. Enjoy!");
@@ -3262,44 +7820,15 @@ void startServer() {
 // so you can just click-and-go. Same story for the "simple" pages.
 void sendRoot() {
 
-  // HTML you can edit..
-  #include "WebPage.h"
-
-  // This will be included at the preprocessor stage (if you have wifi remote enabled), but works
-  // well enough inside here and keeps things clearer for me and saves memory. Test it!
-
-  // WebPage is a but a simple String created in WebPage.h, which does nothing else.
-  // (which is why it's fine to include it /inside/ a function - same for /console)
-
-  // You can have fun right here with all sorts of web page variable tokens..
-  WebPage.replace("{Version}", version);
   /*
-    So "{Version}" (no quotes) in your HTML file is replaced with the contents of the variable
-    "version", which we set way up near the top of this sketch. So now the title of the page
-    reflects the current version, without needing to edit the HTML.
+    The page (WebPage.h) is a const char in flash, so there's nothing to build; we send it straight
+    out of flash (gzipped, if your browser takes that; a third of the size). Your browser gets an
+    ETag with it, and next time it asks "is this still the same?", we can just say "yes" (304 Not
+    Modified) and send nothing at all.
 
-    I wonder how much memory this uses? Anyway, ESP32 does have a *lot*.
-
-    It certainly doesn't affect our (in)ability to access Signal Generator when running 20MHz
-    signals. So enjoy! And feel sorry for your poor Arduino brethren, working in near-zero-k.
+    The live bits (version, preset names) are fetched by the page itself, from /pageData.
   */
-
-  WebPage.replace("{1}", getPresetName(1));
-  WebPage.replace("{2}", getPresetName(2));
-  WebPage.replace("{3}", getPresetName(3));
-  WebPage.replace("{4}", getPresetName(4));
-  WebPage.replace("{5}", getPresetName(5));
-  WebPage.replace("{6}", getPresetName(6));
-  WebPage.replace("{7}", getPresetName(7));
-  WebPage.replace("{8}", getPresetName(8));
-  WebPage.replace("{9}", getPresetName(9));
-  /*
-    Yes! The name of your presets will appear as a pop-up title/balloon/whatever over the
-    corresponding button. Pretty neat, and obviously, if you had the need, could be expanded to
-    *more* buttons. Way faster than I expected.
-*/
-  // Serving the actual page is ridiculously easy..
-  server.send(200, _HTML5_TEXT_, WebPage);
+  sendPage(WebPage, rootTag, WebPageGz, sizeof(WebPageGz), rootGz);
   // See also: sendSimplePage()
 
   if (eXi) Serial.printf(" HTTP Request: Main Page for client @ %s\n", \
@@ -3307,6 +7836,75 @@ void sendRoot() {
 }
 
 
+/*
+  Version, then the names of presets 1-9, one per line.
+
+  Yes! The name of your presets will appear as a pop-up title/balloon/whatever over the
+  corresponding button. Pretty neat, and obviously, if you had the need, could be expanded to
+  *more* buttons.
+/pageData                           */
+void sendPageData() {
+  String pageData = version;
+  for (uint8_t i = 1; i <= 9; i++) pageData += "\n" + getPresetName(i);
+  server.sendHeader("Cache-Control", "no-store");
+  server.send(200, _PLAIN_TEXT_, pageData);
+  if (eXi) Serial.println(" HTTP Request: Page Data");
+}
+
+
+/*
+  Entity tag for a page.
+
+  A quick hash (FNV-1a) of the page and our version. Upload a new version, get new tags, and
+  browsers fetch the new pages. Otherwise they use what they've got.
+                                                                  */
+String pageTag(const char *page) {
+  uint32_t hash = pageHash(page);
+  for (uint16_t i = 0; i < version.length(); i++) hash = (hash ^ (uint8_t)version[i]) * 16777619;
+  char tag[16];
+  sprintf(tag, "\"%08x\"", hash);
+  return (String)tag;
+}
+
+
+// .. and the page on its own; host/gzpages.py works out the same thing for the page it gzipped.
+uint32_t pageHash(const char *page) {
+  uint32_t hash = 2166136261;
+  for (const char *c = page; *c; c++) hash = (hash ^ (uint8_t)*c) * 16777619;
+  return hash;
+}
+
+
+// Send the caching headers and, if the browser already has this page, a 304 (and return true)..
+bool notModified(const String &tag) {
+  server.sendHeader("ETag", tag);
+  server.sendHeader("Cache-Control", "no-cache"); // i.e. keep it, but check with us first.
+  if (server.header("If-None-Match") == tag) {
+    server.send(304);
+    return true;
+  }
+  return false;
+}
+
+
+/*
+  Send a page from flash; the gzipped copy if the browser takes gzip and the copy is good (made
+  from this page), the page as it is if not. The two get different tags (a browser that has one
+  shouldn't be told it has the other).
+                                                                  */
+void sendPage(const char *page, const String &tag, const uint8_t *gz, size_t gzLength, bool gzGood) {
+  bool gzip = gzGood && server.header("Accept-Encoding").indexOf("gzip") != -1;
+  server.sendHeader("Vary", "Accept-Encoding");
+  if (notModified((gzip) ? tag.substring(0, tag.length() - 1) + "-gz\"" : tag)) return;
+  if (gzip) {
+    server.sendHeader("Content-Encoding", "gzip");
+    server.send_P(200, _HTML5_TEXT_.c_str(), (const char *)gz, gzLength);
+  } else {
+    server.send_P(200, _HTML5_TEXT_.c_str(), page);
+  }
+}
+
+
 /*
     Web Commands.
 
@@ -3332,42 +7930,48 @@ void handleUpdateFrequency() {
 /*
 /setFreqency                */
 void handleFreqencyChange() {
+  String command = "";
   for (uint8_t i = 0; i < server.args(); i++) {
     if (server.argName(i) == "frequency") {
-      WebCommand = server.arg(i);
+      command = server.arg(i);
       break;
     }
   }
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Changing Frequency..");
-  if (eXi) Serial.println(" HTTP Request (Frequency Change): " + WebCommand);
+  if (eXi) Serial.println(" HTTP Request (Frequency Change): " + command);
 }
 
 /*
 /setStep                */
 void handleStepChange() {
+  String command = "";
   for (uint8_t i = 0; i < server.args(); i++) {
     if (server.argName(i) == "step") {
-      WebCommand = "f" + server.arg(i);
+      command = "f" + server.arg(i);
       break;
     }
   }
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Changing Frequency Step..");
-  if (eXi) Serial.println(" HTTP Request (Step Size Change): " + WebCommand);
+  if (eXi) Serial.println(" HTTP Request (Step Size Change): " + command);
 }
 
 /*
 /setBitDepth                */
 void handleBitDepthChange() {
+  String command = "";
   String iData;
   for (uint8_t i = 0; i < server.args(); i++) {
     if (server.argName(i) == "bits") {
       iData = server.arg(i);
-      WebCommand = "b" + iData;
+      command = "b" + iData;
       break;
     }
   }
   char bpl;
   if (iData.toInt() != 1) bpl = 's';
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Changing Resolution..");
   if (eXi) Serial.printf(" HTTP Request: Bit Depth. %s bit%c\n", iData.c_str(), bpl);
 }
@@ -3375,14 +7979,16 @@ void handleBitDepthChange() {
 /*
 /setPulseWidth                */
 void handlePulseWidthChange() {
+  String command = "";
   for (uint8_t i = 0; i < server.args(); i++) {
     if (server.argName(i) == "pulse") {
-      WebCommand = "p" + server.arg(i);
+      command = "p" + server.arg(i);
       break;
     }
   }
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Changing Pulse Width..");
-  if (eXi) Serial.println(" HTTP Request:" + WebCommand);
+  if (eXi) Serial.println(" HTTP Request:" + command);
 }
 
 /*
@@ -3448,25 +8054,28 @@ void handleResDOWN() {
 /*
 /setSquare             */
 void handleSetSquareWave() {
-  WebCommand = "r";
+  String command = "r";
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Setting Square Wave..");
-  if (eXi) Serial.println(" HTTP Request: " + WebCommand);
+  if (eXi) Serial.println(" HTTP Request: " + command);
 }
 
 /*
 /setSine             */
 void handleSetSineWave() {
-  WebCommand = "s";
+  String command = "s";
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Setting Sine Wave..");
-  if (eXi) Serial.println(" HTTP Request: " + WebCommand);
+  if (eXi) Serial.println(" HTTP Request: " + command);
 }
 
 /*
 /setTriangle             */
 void handleSetTriangleWave() {
-  WebCommand = "t";
+  String command = "t";
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Setting Triangle Wave..");
-  if (eXi) Serial.println(" HTTP Request: " + WebCommand);
+  if (eXi) Serial.println(" HTTP Request: " + command);
 }
 
 
@@ -3485,10 +8094,11 @@ void handleStatus() {
 /*
 /reboot             */
 void handleReboot() {
-  Serial.println(" HTTP Request: Reboot.");
-  WebCommand = "reboot";
+  String command = "reboot";
+  if (!binaryMode) Serial.println(" HTTP Request: Reboot.");
+  if (!webCommand(command, FROM_WEB)) return;
   server.send(200, _PLAIN_TEXT_, "Rebooting..");
-  if (eXi) Serial.println(" HTTP Request: " + WebCommand);
+  if (eXi) Serial.println(" HTTP Request: " + command);
 }
 
 
@@ -3506,12 +8116,13 @@ void handleEndLoop() {
 /*
 /loadPreset             */
 void handleLoadPreset() {
+  SignalLock hold;
   String val, state;
   for (uint8_t i = 0; i < server.args(); i++) {
     if (server.argName(i) == "preset") {
       val = server.arg(i);
       state = loadPreset(val.toInt());
-      startSignal("WebLoad");
+      if (state.startsWith("Loading")) startSignal("WebLoad");
       break;
     }
   }
@@ -3545,10 +8156,20 @@ void handleSavePreset() {
 
                           */
 void handleWebConsole() {
-  fromWebConsole = true;
-  WebCommand = server.uri().substring(1); // lop off preceding forward slash. Boom! Instant console command.
-  server.send(200, _PLAIN_TEXT_, WebCommand + ": OK\nSee /LastMessage for any output from your command.");
-  if (eXi) Serial.printf(" HTTP Request: WebCommand: %s\n", WebCommand.c_str());
+  String command = server.uri().substring(1); // lop off preceding forward slash. Boom! Instant console command.
+  if (!webCommand(command, FROM_CONSOLE)) return;
+  server.send(200, _PLAIN_TEXT_, command + ": OK\nSee /LastMessage for any output from your command.");
+  if (eXi) Serial.printf(" HTTP Request: WebCommand: %s\n", command.c_str());
+}
+
+
+// Queue a command from the web. If the queue is full, the browser is told to try again shortly (503)..
+bool webCommand(const String &command, CommandSource source) {
+  if (command == "" || queueCommand(source, command)) return true;
+  server.sendHeader("Retry-After", "1");
+  server.send(503, _PLAIN_TEXT_, "Busy! Command queue is full, try again. (" + command + ")");
+  if (eXi) Serial.printf(" HTTP Request: Dropped (queue full): %s\n", command.c_str());
+  return false;
 }
 
 // If you have ESP32 debug enabled, you will see an error here. Or else hack your WebServer.cpp.
@@ -3570,25 +8191,285 @@ void handleLastMessage() {
 }
 
 
+/*
+  Server-Sent Events.
+
+  The browser opens /events and keeps it open. Instead of answering and hanging up, we send the
+  event-stream headers and keep a copy of the client; the connexion stays open for as long as we
+  hold onto it. From then on, pushEvent() writes straight down the pipe, to every open page.
+/events                                                             */
+void handleEvents() {
+
+  int8_t slot = -1;
+  for (uint8_t i = 0; i < eventClientsMAX; i++) {
+    if (!eventClients[i].connected()) {
+      eventClients[i].stop();
+      slot = i;
+      break;
+    }
+  }
+  if (slot == -1) {
+    server.send(503, _PLAIN_TEXT_, "Too many live pages! (" + (String)eventClientsMAX + " maximum)");
+    return;
+  }
+
+  WiFiClient client = server.client();
+  client.print("HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-store\r\n" \
+                                                          "Connection: keep-alive\r\n\r\nretry: 3000\n\n");
+  eventClients[slot] = client;
+  eventBacklog[slot] = "";
+
+  pushedState.mode = 0; // So everyone gets the current state, right away.
+  pushTime = 0;
+
+  if (eXi) Serial.printf(" HTTP Request: Live Events for client @ %s\n", client.remoteIP().toString().c_str());
+}
+
+
+uint8_t eventClientCount() {
+  uint8_t count = 0;
+  for (uint8_t i = 0; i < eventClientsMAX; i++) if (eventClients[i].connected()) count++;
+  return count;
+}
+
+
+/*
+  Batch commands..
+
+  POST a list of commands, one per line (each line can be a chain, a loop load; anything you could
+  type at the console) and they run in order, through the regular command queue. The answer is a
+  JSON array, one object per command, with its output and where that left the generator, e.g..
+
+    curl --data-binary @tests.txt http://signalgenerator.local/batch
+
+    [{"command":"f1k","message":"Frequency set to: 1kHz","status":"ok","wave":"Rectangle",
+      "frequency":1000.000,"pulse":50,"us":412}, ...]
+
+  status is "limited" if the frequency ended up clamped by the limits. The array is sent as the
+  commands finish, so a long batch shows progress, and if you hang up, we stop.
+/batch                                                                          */
+void handleBatch() {
+
+  if (batch.open) {
+    server.sendHeader("Retry-After", "1");
+    server.send(503, _PLAIN_TEXT_, "Busy! A batch is already running.");
+    return;
+  }
+
+  String body = server.arg("plain");
+  if (body.length() > batchMAX) {
+    server.send(413, _PLAIN_TEXT_, "Batch Too Large! (" + (String)batchMAX + " bytes maximum)");
+    return;
+  }
+  body.replace("\r", "");
+  body.trim();
+  if (body == "") {
+    server.send(400, _PLAIN_TEXT_, "No Commands! (POST them, one per line)");
+    return;
+  }
+
+  batchClient = server.client();
+  batchClient.print("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\nCache-Control: no-store\r\n" \
+                                                                      "Connection: close\r\n\r\n[");
+  batch.lines = body;
+  batch.done = 0;
+  batch.open = true;
+  if (eXi) Serial.printf(" HTTP Request: Batch (%u bytes) from %s\n", body.length(), batchClient.remoteIP().toString().c_str());
+}
+
+
+/*
+  Backup: Export ALL settings, presets and loops, as a text file you can save (or /backup?compact
+  for the base64 version). It's written straight down the wire, a preset at a time; see
+  streamExport(). Restore it again with /restore..
+
+    curl -o backup.txt http://signalgenerator.local/backup
+/backup                                                                          */
+void handleBackup() {
+
+  server.sendHeader("Content-Disposition", "attachment; filename=\"SignalGenerator.txt\"");
+  server.sendHeader("Cache-Control", "no-store");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, _PLAIN_TEXT_, "");
+
+  ChunkedPrint chunked;
+  uint16_t count = streamExport(chunked, server.hasArg("compact"));
+  chunked.sendChunk();
+  server.sendContent(""); // The last (empty) chunk
+
+  LastMessage = "Exported " + (String)count + " presets to " + server.client().remoteIP().toString();
+  if (eXi) Serial.printf(" HTTP Request: Backup (%u presets)\n", count);
+}
+
+
+/*
+  Metrics: The same numbers as "stats", in Prometheus' text format, so something can scrape them
+  and graph a long uptime. Phase histograms are in seconds (cumulative buckets, as Prometheus likes
+  them), memory in bytes..
+
+    curl http://signalgenerator.local/metrics
+/metrics                                                                        */
+void handleMetrics() {
+
+  server.sendHeader("Cache-Control", "no-store");
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "text/plain; version=0.0.4", "");
+
+  ChunkedPrint out;
+  out.print("# HELP signalgenerator_phase_seconds Time spent in each phase of the main loop.\n"
+            "# TYPE signalgenerator_phase_seconds histogram\n");
+  for (uint8_t i = 0; i < metricPhases; i++) {
+    PhaseMetrics m = phaseMetrics(i);
+    uint32_t seen = 0;
+    for (uint8_t b = 0; b < metricBuckets - 1; b++) {
+      seen += m.buckets[b];
+      out.printf("signalgenerator_phase_seconds_bucket{phase=\"%s\",le=\"%g\"} %u\n", phaseNames[i], \
+                                                                          (1UL << b) / 1000000.0, seen);
+    }
+    out.printf("signalgenerator_phase_seconds_bucket{phase=\"%s\",le=\"+Inf\"} %u\n", phaseNames[i], m.count);
+    out.printf("signalgenerator_phase_seconds_sum{phase=\"%s\"} %.6f\n", phaseNames[i], \
+                                                                m.cycles / (cyclesPerMicro * 1000000.0));
+    out.printf("signalgenerator_phase_seconds_count{phase=\"%s\"} %u\n", phaseNames[i], m.count);
+  }
+
+  out.print("# HELP signalgenerator_phase_max_seconds Slowest single pass of each phase.\n"
+            "# TYPE signalgenerator_phase_max_seconds gauge\n");
+  for (uint8_t i = 0; i < metricPhases; i++) out.printf("signalgenerator_phase_max_seconds{phase=\"%s\"} %.6f\n", \
+                                          phaseNames[i], phaseMetrics(i).maxCycles / (cyclesPerMicro * 1000000.0));
+
+  out.print("# HELP signalgenerator_commands_total Commands queued, by where they came from.\n"
+            "# TYPE signalgenerator_commands_total counter\n");
+  for (uint8_t i = 0; i < commandSources; i++) out.printf("signalgenerator_commands_total{source=\"%s\"} %u\n", \
+                                                                        sourceNames[i], queueStats.queued[i].load());
+  out.print("# TYPE signalgenerator_commands_dropped_total counter\n");
+  for (uint8_t i = 0; i < commandSources; i++) out.printf("signalgenerator_commands_dropped_total{source=\"%s\"} %u\n", \
+                                                                        sourceNames[i], queueStats.dropped[i].load());
+
+  out.printf("# TYPE signalgenerator_heap_free_bytes gauge\nsignalgenerator_heap_free_bytes %u\n", ESP.getFreeHeap());
+  out.printf("# TYPE signalgenerator_heap_free_min_bytes gauge\nsignalgenerator_heap_free_min_bytes %u\n", ESP.getMinFreeHeap());
+  out.printf("# TYPE signalgenerator_heap_largest_block_bytes gauge\nsignalgenerator_heap_largest_block_bytes %u\n", \
+                                                                                        ESP.getMaxAllocHeap());
+  out.printf("# TYPE signalgenerator_heap_largest_block_min_bytes gauge\nsignalgenerator_heap_largest_block_min_bytes %u\n", \
+                                                      (blockLow == UINT32_MAX) ? ESP.getMaxAllocHeap() : blockLow);
+  out.printf("# TYPE signalgenerator_uptime_seconds counter\nsignalgenerator_uptime_seconds %u\n", millis() / 1000);
+
+  out.sendChunk();
+  server.sendContent("");
+}
+
+
+/*
+  Restore: Upload a backup (as a file, multipart/form-data) and we import it line by line as it
+  arrives (handleRestoreUpload()), so it can be as big as you like..
+
+    curl -F "file=@backup.txt" http://signalgenerator.local/restore
+
+  Lines we don't understand are skipped (and counted).
+/restore                                                                        */
+void handleRestoreUpload() {
+
+  HTTPUpload& upload = server.upload();
+
+  if (upload.status == UPLOAD_FILE_START) {
+    restoreLine = "";
+    restoreLines = 0;
+    restoreFailed = 0;
+    restoreTooLong = 0;
+    restoreOverflow = false;
+    if (eXi) Serial.printf(" HTTP Request: Restore (%s)\n", upload.filename.c_str());
+
+  } else if (upload.status == UPLOAD_FILE_WRITE) {
+    for (size_t i = 0; i < upload.currentSize; i++) {
+      char c = upload.buf[i];
+      if (c == '\n') {
+        restoreImport();
+      } else if (c != '\r') {
+        // Half a line could import as something else entirely; too long, and it's not imported at all..
+        if (restoreLine.length() < serialLineMAX) restoreLine += c;
+        else restoreOverflow = true;
+      }
+    }
+
+  } else if (upload.status == UPLOAD_FILE_END) {
+    // No newline at the end..
+    if (restoreLine != "" || restoreOverflow) restoreImport();
+  }
+}
+
+
+// One (whole) line of a restore..
+void restoreImport() {
+  if (restoreOverflow) {
+    restoreTooLong++;
+    restoreFailed++;
+  } else if (!importLine(restoreLine)) {
+    restoreFailed++;
+  }
+  restoreLines++;
+  restoreLine = "";
+  restoreOverflow = false;
+}
+
+
+// And when it's all in..
+void handleRestore() {
+  LastMessage = "Restored " + (String)restoreLines + " lines";
+  if (restoreFailed) LastMessage += " (" + (String)restoreFailed + " skipped)";
+  if (restoreTooLong) LastMessage += ". ERROR: " + (String)restoreTooLong + " line(s) over " + \
+                                      (String)serialLineMAX + " characters; not imported!";
+  server.send((restoreTooLong) ? 413 : 200, _PLAIN_TEXT_, LastMessage + "\n");
+  if (eXi) Serial.printf(" %s%s\n", LastMessage.c_str(), getFreeEntries().c_str());
+}
+
+
+// Quotes, backslashes and control characters, made safe for JSON strings..
+String jsonString(const String &text) {
+  String json = "\"";
+  for (uint16_t i = 0; i < text.length(); i++) {
+    char c = text[i];
+    if (c == '"' || c == '\\') {
+      json += '\\';
+      json += c;
+    } else if (c == '\n') {
+      json += "\\n";
+    } else if (c == '\t') {
+      json += "\\t";
+    } else if ((uint8_t)c >= 0x20) {
+      json += c;
+    }
+  }
+  return json + "\"";
+}
+
+
 // So let's create a web console..
 
 /*
 /console             */
 void sendWebConsole() {
 
-  // HTML you can edit..
-  #include "Console.h"
+  // WebConsole is the const char (in flash) created in Console.h; the same for everyone, so it
+  // can go gzipped and cached, like the main page. The list of commands comes from /consoleData.
+  sendPage(WebConsole, consoleTag, WebConsoleGz, sizeof(WebConsoleGz), consoleGz);
+  if (eXi) Serial.printf(" HTTP Request: WebConsole for client @ %s\n", \
+                          server.client().remoteIP().toString().c_str());
+}
 
-  // WebConsole is the String created in Console.h
 
-  // New clients get a list of commands..
+/*
+  New clients get a list of commands (the console asks for this when it loads); known clients
+  get nothing, and the console stays blank.
+/consoleData         */
+void sendConsoleData() {
   String myClient = server.client().remoteIP().toString();
+  server.sendHeader("Cache-Control", "no-store");
   if (knownClients.indexOf(myClient) == -1) { // is this client known yet?
-    WebConsole.replace("<!--{insert}-->", getCommands()); // Please, never forget the usefulness of the HTML comment.
     knownClients += myClient; // Add this client to the list of "known" clients
+    server.send(200, _PLAIN_TEXT_, getCommands());
+  } else {
+    server.send(200, _PLAIN_TEXT_, "");
   }
-  server.send(200, _HTML5_TEXT_, WebConsole);
-  if (eXi) Serial.printf(" HTTP Request: WebConsole for client @ %s\n", myClient.c_str());
+  if (eXi) Serial.printf(" HTTP Request: Console Data for client @ %s\n", myClient.c_str());
 }
 
 /*
@@ -3615,7 +8496,7 @@ void sendSimplePage() {
 
     We use HEREDOC so we don't need to escape all the quotes and what-not.
 */
-  String SimplePage = R"SimplePage(<!DOCTYPE html><html><head><title>ESP32 Signal Generator</title><meta name="viewport" content="width=device-width, initial-scale=1"><link rel="shortcut icon" type="image/png" sizes="16x16" href="data:image/png;base64,iVBORw0KGgoAAAANSUhEUgAAABAAAAAQCAQAAAC1+jfqAAAABGdBTUEAALGPC/xhBQAAAAlwSFlzAAAuIwAALiMBeKU/dgAAAAd0SU1FB+cBFRcAJyFRDxkAAAAZdEVYdENvbW1lbnQAQ3JlYXRlZCB3aXRoIEdJTVBXgQ4XAAAA3ElEQVQoz4WRP0tCcRSGH34u0ReIxoKQwBovTQ1iGPgxwqFdcg/nvoHQ3DdoqqFJh8ylMXFsMCSoIa+Pg97rn3vDZznDeTnnvOfFsgP/Y2CZpB07yZUwr13PLfmYowgAQy7Y55QqPTKo3nrsyJFFr5xuTEA/DbZVbUvm4gB9pkQAnAHvGxsCdNnhAIBD9nhLW01uAGJrXqcDG0YLu2Pxbn7DKg/ih6o98TmxueQEeAWgQ6CU2Fzy56UVf/yyaCuxuc6T2LDu7sJwRhB7b8EjX9JH5WT57e9KWFvingFTFG1S956a3gAAAABJRU5ErkJggg=="/></head><style>html{width:100% !important;height:100vh !important;color:#4CAF50;margin:0;}div,pre,p,form{margin:0;}.controller{margin:auto;width:96%;}label{display:none;}.step-button{width:95%;border-radius:0.15em;background-color:#4CAF50;border:none;color:white;text-align:center; padding:0.1em 0.2em;font-size:8em;font-weight:bold;margin:0.175em auto;}.step-button:hover{background-color:#00778f;}.step-button:active{background-color:#fff;color:#8cacb3;}#fup, #fdown {width:100%;height:40vh;}</style><body><div class="controller"><button id="fup" onclick="clickUP()" class="step-button" title="UP">&#8963;</button><button id="fdown" onclick="clickDOWN()" class="step-button" title="DOWN">&#8964;</button></div><script>function clickUP(){var AJAX=new XMLHttpRequest();AJAX.open("GET","setUP",true);AJAX.send();}function clickDOWN(){var AJAX=new XMLHttpRequest();AJAX.open("GET","setDOWN",true);AJAX.send();}document.onkeydown=ArrowKeys;function ArrowKeys(e){if(e.keyCode=='38'){clickUP();}else if(e.keyCode=='40'){clickDOWN();}else if(e.keyCode=='37'){clickDOWN();}else if(e.keyCode=='39'){clickUP();}}</script></body></html>)SimplePage";
+  // SimplePage (up there with the other pages, in flash)..
 /*
   If you edit this, have fun putting back the spaces! (hint: regex)
 
@@ -3628,28 +8509,21 @@ void sendSimplePage() {
   control, favicon and cool phone-screen-filling goodness you can tap up-down-left-right-without-
   thinking..
                                */
-  if (server.uri() == "/pwm") {
-    SimplePage.replace("setUP", "pulseUP");
-    SimplePage.replace("setDOWN", "pulseDOWN");
-  }
   /*
+    At the start of the page's <script>..
+
+      if(location.pathname=="/pwm"){up="pulseUP";down="pulseDOWN";}
+
     Boom!
 
-    Let's just do them all while we're here.
+    Resolution @ /bits is the same again. The page works out which URLs to use by itself, so it's
+    the same page for everyone, and your browser can keep it.
 
-    Resolution @ /bits..
-                                */
-  if (server.uri() == "/bits") {
-    SimplePage.replace("setUP", "resUP");
-    SimplePage.replace("setDOWN", "resDOWN");
-  }
-  /*
     There are two methods you can use to get a simple page like this adjusting what /you/ need.
 
     You can simply use the WebCommand mechanism, which translates raw /URLs into commands..
 
-      SimplePage.replace("setUP", "a");
-      SimplePage.replace("setDOWN", "z");
+      if(location.pathname=="/customSimpleURL"){up="a";down="z";}
 
     Which the WebCommand mechanism would pick up as the "a" and "z" commands, meaning, shift bit
     rate UP or DOWN; these commands being handled inside loop() (aka. the void).
@@ -3658,8 +8532,7 @@ void sendSimplePage() {
 
     You could use the page to switch between two defined presets, e.g..
 
-      SimplePage.replace("setUP", "l1");
-      SimplePage.replace("setDOWN", "l2");
+      if(location.pathname=="/customSimpleURL"){up="l1";down="l2";}
 
     or ABSOLUTELY ANY COMMAND YOU WANT. Or you could make a page with 50 buttons.
 
@@ -3671,12 +8544,9 @@ void sendSimplePage() {
 
       server.on("/customSimpleURL", sendSimplePage);
 
-    Pop some code inside here (sendSimplePage()) to do the replacements..
+    Pop some code inside the page's <script> to pick your URLs..
 
-        if (server.uri() == "/customSimpleURL") {
-          SimplePage.replace("setUP", "customUP");
-          SimplePage.replace("setDOWN", "customDOWN");
-        }
+        if(location.pathname=="/customSimpleURL"){up="customUP";down="customDOWN";}
 
     Finally, handle the requests and provide responses inside your two custom up/down functions..
 
@@ -3693,7 +8563,7 @@ void sendSimplePage() {
 
   */
 
-  server.send(200, _HTML5_TEXT_, SimplePage); // Spit it out.
+  if (!notModified(simpleTag)) server.send_P(200, _HTML5_TEXT_.c_str(), SimplePage); // Spit it out.
   if (eXi) Serial.printf(" HTTP Request: Simple Page for client @ %s\n", \
                             server.client().remoteIP().toString().c_str());
 }
@@ -3724,6 +8594,7 @@ void sendSimplePage() {
 /favicon.ico         */
 void handleFavicon() {
   String favicon = R"SVGfavicon(<?xml version="1.0" standalone="no"?><!DOCTYPE svg PUBLIC "-//W3C//DTD SVG 20010904//EN" "http://www.w3.org/TR/2001/REC-SVG-20010904/DTD/svg10.dtd"><svg version="1.0" xmlns="http://www.w3.org/2000/svg" width="16.000000pt" height="16.000000pt" viewBox="0 0 16.000000 16.000000" preserveAspectRatio="xMidYMid meet"><g transform="translate(0.000000,16.000000) scale(0.100000,-0.100000)" fill="#777"><path d="M32 128 c-15 -20 -24 -58 -14 -58 6 0 13 11 16 25 8 31 23 32 31 3 21 -75 40 -94 63 -65 15 19 24 57 14 57 -6 0 -13 -12 -16 -26 -9 -34 -28 -26 -39 17 -9 35 -24 59 -37 59 -4 0 -12 -6 -18 -12z"/></g></svg>)SVGfavicon";
+  server.sendHeader("Cache-Control", "max-age=604800"); // It's not going anywhere.
   server.send(200, "image/svg+xml", favicon);
 }
 /*
@@ -3814,17 +8685,17 @@ void sendHelpPageHTML() {
                                     */
 String importSettings(char *imported, uint8_t presetNumber = 0) {
 
+  if (presetNumber > presetMAX) return "\n " + _OUT_OF_RANGE_ + "\n";
+
   String thisPref;
   char iBuff[1064];
   sprintf(iBuff, "\n Importing Settings..\n\n");
   char bpl;
   char localMode = mode;
 
-  // Importing settings directly into a preset..
-  if (presetNumber != 0) {
-    prefsSwitch(presetNumber);
-    prefs.putChar("i", 1);
-  }
+  // Importing settings directly into a preset (on top of whatever's there)..
+  PresetBlob blob;
+  if (presetNumber != 0) readSettings(presetNumber, blob);
 
   while ((thisPref = strsep(&imported, ","))) {
 
@@ -3835,53 +8706,73 @@ String importSettings(char *imported, uint8_t presetNumber = 0) {
     String thisVal = thisPref.substring(2); // and this is "100"
     int8_t thisINT = thisVal.toInt();       // 100
 
-    // Save prefs directly to the preset memory's namespace..
+    // Save settings into the preset (written in one go, below)..
     if (presetNumber != 0) {
 
       switch (prefType) {
         case 'm' :
-          prefs.putChar("m", cVal);
+          blob.mode = cVal;
+          blob.has |= HAS_MODE;
           localMode = cVal;
           sprintf(iBuff + strlen(iBuff), "\tSaving Mode: %s\n", makeHumanMode(cVal).c_str());
           break;
         case 'f' :
-          prefs.putFloat("f", humanFreqToFloat(thisVal));
-          sprintf(iBuff + strlen(iBuff), "\tSaving Frequency: %s\n", makeHumanFrequency(prefs.getFloat("f")).c_str());
+          blob.frequency = humanFreqToFloat(thisVal);
+          blob.has |= HAS_FREQ;
+          sprintf(iBuff + strlen(iBuff), "\tSaving Frequency: %s\n", makeHumanFrequency(blob.frequency).c_str());
           break;
         case 'p' :
           if (localMode != 's' || saveALL) {
-            prefs.putUChar("p", thisINT);
+            blob.pulse = thisINT;
+            blob.has |= HAS_PULSE;
             sprintf(iBuff + strlen(iBuff), "\tSaving Pulse Width: %i%%\n", thisINT);
           }
           break;
         case 'a' :
           if (localMode != 'r' || saveALL) {
-            prefs.putUChar("a", thisINT);
+            blob.amplitude = thisINT;
+            blob.has |= HAS_AMP;
             sprintf(iBuff + strlen(iBuff), "\tSaving Amplitude Level: %i\n", thisINT);
           }
           break;
         case 'j' :
           if (localMode != 's' || saveALL) {
-            prefs.putUChar("j", thisINT);
+            blob.pStep = thisINT;
+            blob.has |= HAS_PSTEP;
             sprintf(iBuff + strlen(iBuff), "\tSaving Pulse Width Step: %i%%\n", thisINT);
           }
           break;
         case 'b' :
           if (localMode == 'r' || saveALL) {
-            prefs.putUChar("b", thisINT);
+            blob.bits = thisINT;
+            blob.has |= HAS_BITS;
             if (thisINT != 1) bpl = 's';
             sprintf(iBuff + strlen(iBuff), "\tSaving Resolution Bit Depth: %i bit%c\n", thisINT, bpl);
           }
           break;
         case 's' :
-          prefs.putFloat("s", humanFreqToFloat(thisVal));
+          blob.fStep = humanFreqToFloat(thisVal);
+          blob.has |= HAS_STEP;
           sprintf(iBuff + strlen(iBuff), \
-            "\tSaving Frequency Step: %s\n", makeHumanFrequency(prefs.getFloat("s")).c_str());
+            "\tSaving Frequency Step: %s\n", makeHumanFrequency(blob.fStep).c_str());
           break;
         case 'h' :
-          prefs.putChar("h", cVal);
+          blob.touchMode = cVal;
+          blob.has |= HAS_TOUCH;
           sprintf(iBuff + strlen(iBuff), "\tSaving Touch Mode: %s\n", makeHumanTouchMode(cVal).c_str());
           break;
+        case 'o' : {
+          SGModulation mod = { blob.modType, blob.modDepth, blob.modRate };
+          if (!(blob.has & HAS_MOD)) mod = modulation;
+          if (!parseModulation(thisVal, mod)) break;
+          blob.modType = mod.type;
+          blob.modDepth = mod.depth;
+          blob.modRate = mod.rate;
+          blob.has |= HAS_MOD;
+          sprintf(iBuff + strlen(iBuff), "\tSaving Modulation: %s\n", \
+                                            modulationText(mod.type, mod.depth, mod.rate).c_str());
+          break;
+        }
       }
 
     } else { // Default settings..
@@ -3921,10 +8812,16 @@ String importSettings(char *imported, uint8_t presetNumber = 0) {
           setTouchMode(cVal);
           sprintf(iBuff + strlen(iBuff), "\tSetting Touch Mode to: %s\n", makeHumanTouchMode(touchMode).c_str());
           break;
+        case 'o' :
+          if (!parseModulation(thisVal, modulation)) break;
+          saveModulation();
+          sprintf(iBuff + strlen(iBuff), "\tSetting Modulation to: %s\n", \
+                              modulationText(modulation.type, modulation.depth, modulation.rate).c_str());
+          break;
       }
     }
   }
-  if (presetNumber != 0) prefsSwitch();
+  if (presetNumber != 0 && !putPreset(presetNumber, blob)) sprintf(iBuff + strlen(iBuff), "\tSave FAILED!\n");
   return (String)iBuff;
 }
 
@@ -3951,15 +8848,14 @@ String importSettings(char *imported, uint8_t presetNumber = 0) {
                                                              */
 String exportSettings(String exData = "0", bool all = false) { // "all" is true during an "export all" command
 
-  if (exData.indexOf("all") != -1 ) return exportALLSettings(); // We'll be back!
+  commitSettings();
 
   int8_t presetNUM = 0;
   int8_t success = 0;
   char prebuff[256];
-  char eBuff[256];
+  char eBuff[256] = {'\0'};
   String loopData, thisPreset, eName;
   String first = exData.substring(0,1);
-  loopData.reserve(20480);
 
   // Enable all three (export3 || export 3 || export=3) formats (for exporting presets).
   // As well as just plain "export" (to export defaults).
@@ -3974,12 +8870,11 @@ String exportSettings(String exData = "0", bool all = false) { // "all" is true
   if (success == 0) {
 
     // We are working with a preset
-    if (presetNUM != 0) {
-      thisPreset = (String)presetNUM;
-      // Which may or may not exist..
-      if (!prefsSwitch(presetNUM)) success = -2;
-      // Even if the preset here is empty, we are now in its namespace.
-    }
+    if (presetNUM != 0) thisPreset = (String)presetNUM;
+
+    // Which may or may not exist..
+    PresetBlob blob;
+    if (!readSettings(presetNUM, blob)) success = -2;
 
     // The preset exists. Grab its settings..
     if (success == 0) {
@@ -3990,7 +8885,7 @@ String exportSettings(String exData = "0", bool all = false) { // "all" is true
       if (!all) {
         eType = "Exporting ";
         eType += (presetNUM == 0) ? "Default settings: \n\n " : \
-                            "Preset " + thisPreset + ": \"" + prefs.getString("n") + "\"\n\n ";
+                            "Preset " + thisPreset + ": \"" + (String)blob.name + "\"\n\n ";
         // Wipe default / preset settings before import..
         eType += "w" + ((presetNUM == 0) ? "" : thisPreset) + commandDelimiter;
       }
@@ -3998,27 +8893,33 @@ String exportSettings(String exData = "0", bool all = false) { // "all" is true
       // Finished with prebuff
 
       // IF a setting exists, add it to the export string..
-      if (prefs.getChar("m", '~') != '~') sprintf(eBuff, "m=%c,",  prefs.getChar("m"));
-      if (prefs.getFloat("f", -1) != -1) sprintf(eBuff + strlen(eBuff), \
-                                              "f=%s,", makeHumanFrequency(prefs.getFloat("f"), true).c_str());
-      if (prefs.getUChar("p", '~') != '~') sprintf(eBuff + strlen(eBuff), "p=%i,", prefs.getUChar("p"));
-      if (prefs.getUChar("b", '~') != '~') sprintf(eBuff + strlen(eBuff), "b=%i,", prefs.getUChar("b"));
-      if (prefs.getFloat("s", -1) != -1) sprintf(eBuff + strlen(eBuff), "s=%s,", \
-                                                makeHumanFrequency(prefs.getFloat("s"), true).c_str());
-      if (prefs.getUChar("j", '~') != '~') sprintf(eBuff + strlen(eBuff), "j=%i,", prefs.getUChar("j"));
-      if (prefs.getUChar("a", '~') != '~') sprintf(eBuff + strlen(eBuff), "a=%i,", prefs.getUChar("a"));
-      if (prefs.getChar("h", '~') != '~') sprintf(eBuff + strlen(eBuff), "h=%c,", prefs.getChar("h"));
-
-      if (prefs.getString("n", "") != "" && thisPreset != "") \
-                      eName = commandDelimiter + "n" + thisPreset + "=" + prefs.getString("n");
-
-      if (!all && prefs.getString("o", "") != "" && exportALL) {
-        loopData += commandDelimiter + " loop" + ((presetNUM == 0) ? "" : thisPreset) + "=" + prefs.getString("o");
-        success = 0;
+      if (blob.has & HAS_MODE) sprintf(eBuff, "m=%c,",  blob.mode);
+      if (blob.has & HAS_FREQ) sprintf(eBuff + strlen(eBuff), \
+                                              "f=%s,", makeHumanFrequency(blob.frequency, true).c_str());
+      if (blob.has & HAS_PULSE) sprintf(eBuff + strlen(eBuff), "p=%i,", blob.pulse);
+      if (blob.has & HAS_BITS) sprintf(eBuff + strlen(eBuff), "b=%i,", blob.bits);
+      if (blob.has & HAS_STEP) sprintf(eBuff + strlen(eBuff), "s=%s,", \
+                                                makeHumanFrequency(blob.fStep, true).c_str());
+      if (blob.has & HAS_PSTEP) sprintf(eBuff + strlen(eBuff), "j=%i,", blob.pStep);
+      if (blob.has & HAS_AMP) sprintf(eBuff + strlen(eBuff), "a=%i,", blob.amplitude);
+      if (blob.has & HAS_TOUCH) sprintf(eBuff + strlen(eBuff), "h=%c,", blob.touchMode);
+      if (blob.has & HAS_MOD) sprintf(eBuff + strlen(eBuff), "o=%s,", \
+                                    modulationText(blob.modType, blob.modDepth, blob.modRate).c_str());
+
+      if (blob.name[0] != '\0' && thisPreset != "") \
+                      eName = commandDelimiter + "n" + thisPreset + "=" + (String)blob.name;
+
+      if (!all && exportALL) {
+        // Loops are in the preset's namespace..
+        if (presetNUM != 0) prefsSwitch(presetNUM);
+        String loops = prefs.getString("o", "");
+        if (presetNUM != 0) prefsSwitch();
+        if (loops != "") {
+          loopData += commandDelimiter + " loop" + ((presetNUM == 0) ? "" : thisPreset) + "=" + loops;
+          success = 0;
+        }
       }
     }
-    // If this was a preset, switch back to main prefs..
-    if (presetNUM != 0) prefsSwitch();
   }
 
   String ret;
@@ -4055,74 +8956,207 @@ String exportSettings(String exData = "0", bool all = false) { // "all" is true
 
   Export ALL Settings..
 
-  Output a big string of text that you can use to duplicate one Signal Generator to a fresh Signal
-  Generator, with all preset memories stored, named and ready-to-go. It will be something like..
+  Output text that you can use to duplicate one Signal Generator to a fresh Signal Generator, with
+  all preset memories stored, named and ready-to-go. It will be something like..
 
-    w1;import1 m=r,f=500,p=25,b=10,h=p;n1=Laser Control;w2;import2 m=t,f=1k,p=0,h=f;n2=Saw Left;w3;import3 p=100;n3=Switch Saw Right;w4;import4 m=s,f=440,s=153,a=4,h=f;n4=Music Maker;w5;import5 m=r,f=40m,p=50,b=1,s=1m,h=f;n5=40MHz Sine Wave Baby!;w6;import6 m=s,f=500,p=50,b=10,s=50,j=5,a=2,h=p;n6=Small Sine;w7;import7 m=r,f=1.5k,p=50,b=10,s=50,j=10,h=p;n7=1.5kHz ~ 50% PWM Laser Control;w;import m=r,f=1k,p=25,b=6,s=100,j=10,h=f
+    w1;import1 m=r,f=500,p=25,b=10,h=p;n1=Laser Control
+    w2;import2 m=t,f=1k,p=0,h=f;n2=Saw Left
+    w3;import3 p=100;n3=Switch Saw Right
+    w4;import4 m=s,f=440,s=153,a=4,h=f;n4=Music Maker
+    w;import m=r,f=1k,p=25,b=6,s=100,j=10,h=f
 
-  (If you are new to Signal Generator, throw the above command into your command-line to get an
+  (If you are new to Signal Generator, throw the above commands into your command-line to get an
   instant example setup. "list" to have a look-see. "l1", "l2", etc.. to load them up.)
 
-  It's basically just a string of commands separated by the ";" (semicolon - or whatever you set in
+  Each line is just a string of commands separated by the ";" (semicolon - or whatever you set in
   your prefs) character:
 
-      :repeat:
       wipe specified preset
       load settings into preset
       name the preset
-      :repeat:
 
-  The /final/ batch of settings is/becomes your *current* settings.
+  The /final/ batch of settings is/becomes your *current* settings. Any stored loops/macros
+  follow, one per line.
 
-  And yes, it's fine to send that as a URL.
+  It's written out as it goes, one preset at a time, to wherever you like (Serial, or the web, see
+  sendBackup()), so it doesn't matter how many presets and loops you have; we never need more
+  memory than one of them takes. One line per preset means you can paste it straight back in.
 
-  Any stored loops/macros encountered along the way will be tagged onto the end.
+  Compact (export all compact) is the same thing, but each preset is one line of base64 (the
+  preset number, its blob (see PresetBlob) and a CRC), like..
 
-                           */
-String exportALLSettings() {
+    ~AQEBcnAEClAKAAB6RAAAyEJMYXNlciBDb250cm9s..(about 90 characters)
+
+  Returns the number of presets exported.
+                                                                                    */
+uint16_t streamExport(Print &out, bool compact) {
 
-  String data = "", seperator, lD, loopData = "";
+  uint16_t count = 0;
+  String pData;
 
-  data.reserve(20480);
-  loopData.reserve(20480);
+  for (uint8_t i = 0; i <= presetMAX; i++) {
 
-  for( uint8_t i = 1; i <= presetMAX; i++ ) {
+    // Presets first, defaults (0) last..
+    uint8_t presetNumber = (i == presetMAX) ? 0 : i + 1;
+    if (presetNumber != 0 && !presetCatalog[presetNumber].exists) continue;
 
-    // Do this first (as it will switch us back to default prefs when done)
-    String pData = exportSettings((String)i, true);
+    if (compact) {
+      if (exportCompact(out, presetNumber)) count++;
+      continue;
+    }
+
+    // Wipe the preset, then import these settings into it (or the defaults)..
+    pData = exportSettings((String)presetNumber, true);
+    if (pData == "") continue;
+    out.print("w" + ((presetNumber == 0) ? "" : (String)presetNumber) + commandDelimiter + pData + "\n");
+    count++;
+  }
+
+  // Then any stored loops/macros (defaults first)..
+  for (uint8_t i = 0; i <= presetMAX; i++) {
+    if (i != 0) {
+      if (!presetCatalog[i].exists) continue;
+      prefsSwitch(i);
+    }
+    pData = prefs.getString("o", "");
+    if (i != 0) prefsSwitch();
+    if (pData != "") out.print(" loop" + ((i == 0) ? "" : (String)i) + "=" + pData + "\n");
+  }
+
+  return count;
+}
+
+
+// One preset, as one line of base64..
+bool exportCompact(Print &out, uint8_t presetNumber) {
+
+  uint8_t data[sizeof(PresetBlob) + 3];
+  PresetBlob blob;
+  if (!readSettings(presetNumber, blob)) return false;
+  if (blob.has == 0 && blob.name[0] == '\0') return false;
+  blob.version = presetVersion;
+  blob.checksum = presetChecksum(blob);
+
+  data[0] = presetNumber;
+  memcpy(data + 1, &blob, sizeof(PresetBlob));
+  uint16_t crc = crc16(data, sizeof(PresetBlob) + 1);
+  data[sizeof(PresetBlob) + 1] = crc & 0xFF;
+  data[sizeof(PresetBlob) + 2] = crc >> 8;
+
+  unsigned char line[128];
+  size_t length;
+  if (mbedtls_base64_encode(line, sizeof(line), &length, data, sizeof(data)) != 0) return false;
+  out.print(compactMark);
+  out.write(line, length);
+  out.print('\n');
+  return true;
+}
+
+
+/*
+  Import one line of an export (see streamExport()).
 
-    // Switch to the preset namespace..
-    if (prefsSwitch(i)) {
+  Understands exactly what the exporter writes; w*, import*, n* and loop*= commands (text), or one
+  $base64 preset (compact). Used by /restore, which can't wait for loop() to run commands, and for
+  compact lines typed (pasted) at the console. Returns false if the line wasn't understood.
+                                                                                    */
+bool importLine(String line) {
+
+  line.trim();
+  if (line == "") return true;
+
+  // Compact..
+  if (line[0] == compactMark) return importCompact(line.substring(1));
+
+  // Text. A loop takes the rest of the line (it has delimiters of its own)..
+  bool understood = true;
+  while (line != "") {
 
-      // There was data in this preset..
-      if (pData != "") {
+    String part;
+    int16_t delimPos = line.indexOf(commandDelimiter);
+    if (line.startsWith("loop") || delimPos == -1) {
+      part = line;
+      line = "";
+    } else {
+      part = line.substring(0, delimPos);
+      line = line.substring(delimPos + commandDelimiter.length());
+    }
+    part.trim();
 
-        // Preset wipe (w*) commands..
-        data += "w" + (String)i + commandDelimiter;
+    if (part.startsWith("loop")) {
+      int16_t eqPos = part.indexOf('=');
+      if (eqPos == -1) return false;
+      long presetNumber = part.substring(4, eqPos).toInt();
+      understood &= (presetNumber >= 0 && presetNumber <= presetMAX) && storeLoop(presetNumber, part.substring(eqPos + 1));
 
-        // After the wipe, import these settings to defaults or a specified preset..
-        data += pData + commandDelimiter;
+    } else if (part.startsWith("import")) {
+      String settings = part.substring(6);
+      long presetNumber = settings.toInt();
+      if (presetNumber < 0 || presetNumber > presetMAX) {
+        understood = false;
+        continue;
       }
+      while (isDigit(settings.charAt(0))) settings = settings.substring(1);
+      settings.trim();
+      char importDATA[128];
+      settings.substring(0, sizeof(importDATA) - 2).toCharArray(importDATA, sizeof(importDATA) - 1);
+      strcat(importDATA, ",");
+      importSettings(importDATA, presetNumber);
+
+    } else if (part[0] == 'w' && (part.length() == 1 || isDigit(part[1]))) {
+      wipePreset(part.substring(1).toInt());
 
-      // Grab any stored loop commands (for tagging onto the end of the export command)..
-      lD = prefs.getString("o", "");
-      if (lD != "") loopData += commandDelimiter + " loop" + (String)i + "=" + lD;
+    } else if (part[0] == 'n' && isDigit(part[1])) {
+      namePreset(part.substring(1));
+
+    } else if (part != "") {
+      understood = false;
     }
+  }
+  return understood;
+}
+
+
+// One compact preset (from this version, or a version 1 export, which is a bit shorter)..
+bool importCompact(const String &line) {
+
+  SignalLock hold;  // /restore calls this from the web server
+  uint8_t data[sizeof(PresetBlob) + 3];
+  size_t length;
+  if (mbedtls_base64_decode(data, sizeof(data), &length, (const unsigned char *)line.c_str(), line.length()) != 0 || \
+                                                                                      length < 4) return false;
+  size_t blobSize = length - 3;
+  uint16_t crc = data[blobSize + 1] | (data[blobSize + 2] << 8);
+  if (crc != crc16(data, blobSize + 1)) return false;
+
+  uint8_t presetNumber = data[0];
+  PresetBlob blob;
+  if (presetNumber > presetMAX || !presetFromBytes(data + 1, blobSize, blob)) return false;
+
+  if (presetNumber != 0) return putPreset(presetNumber, blob);
 
-    // And switch back..
-    prefsSwitch();
-  }
-  // All presets have been interrogated
+  // The defaults; these become your current settings..
+  commitSettings();
+  removePresetKeys();
+  putPresetKeys(blob);
+  applyPreset(blob);
+  startSignal("import");
+  return true;
+}
 
-  // Finally, wipe the /current/ settings and import our *new* (current!) current settings..
-  String curSettings = exportSettings("", true);
-  if (curSettings != "") data += "w" + commandDelimiter + curSettings;
-  lD = prefs.getString("o", "");
-  if (lD != "") loopData = commandDelimiter + " loop=" + lD + loopData;
 
-  // We're done! *phew*
-  if (data != "" || loopData != "") return data + loopData;
-  return "No settings to export!";
+// Store a loop/macro (for defaults, or a preset)..
+bool storeLoop(uint8_t presetNumber, const String &commands) {
+  if (presetNumber > presetMAX || commands.length() > 3999) return false;
+  if (presetNumber != 0) {
+    prefsSwitch(presetNumber);
+    // In case it doesn't exist - so it shows up in the loops list/export/etc..
+    prefs.putChar("i", 1);
+    presetCatalog[presetNumber].exists = true;
+  }
+  bool stored = prefs.putString("o", commands);
+  if (presetNumber != 0) prefsSwitch();
+  return stored;
 }
 
 // Okay, technically, we don't export *all* the settable settings. The global flags will be whatever
@@ -4198,7 +9232,7 @@ String setupPhysicalButtons(bool reportOnly = true) {
           buttons.my_butt[i].pin = buttonPins[i];
           buttons.my_butt[i].command = buttonCommands[i];
           buttons.my_butt[i].state = 0;
-          buttons.my_butt[i].oldState = 0;
+          buttons.my_butt[i].changing = 0;
           pinMode(buttonPins[i], INPUT_PULLDOWN);
         }
         sprintf(demButts, " Button %i:  Pin: %i  Command: %s\n", i+1, buttonPins[i], buttonCommands[i].c_str());
@@ -4210,12 +9244,117 @@ String setupPhysicalButtons(bool reportOnly = true) {
 
 
 
+/*
+  Input Sampling (see InputState)..
+
+  Runs forever, every inputScanMS, on core 0 (loop() is on core 1). Button commands go straight
+  into the command queue (it takes commands from anywhere). Everything else is left in "inputs"
+  for loop() to act on, as touch and pot changes alter the signal, which is loop()'s job.
+                                                                                  */
+void inputScan(void *parameters) {
+
+  uint8_t touchCount[2] = { 0, 0 };
+  uint32_t potEMA = 0;           // Smoothed pot reading, << 8 for precision
+  uint16_t potReported = 0;      // What we last told loop()
+  bool potStarted = false;
+  TickType_t wake = xTaskGetTickCount();
+
+  for (;;) {
+
+    vTaskDelayUntil(&wake, pdMS_TO_TICKS(inputScanMS));
+
+    // Buttons. A press must hold for inputDebounce scans, as must the release..
+    if (useButtons) {
+      uint32_t start = ESP.getCycleCount();
+      for (uint8_t i = 0; i < buttonCount; i++) {
+        button &b = buttons.my_butt[i];
+        if (b.pin == 0) continue;
+        if (digitalRead(b.pin) == b.state) {
+          b.changing = 0;
+        } else if (++b.changing >= inputDebounce) {
+          b.state = !b.state;
+          b.changing = 0;
+          if (b.state == 1) {
+            queueCommand(FROM_BUTTON, b.command);
+            inputs.pressed = true;
+          }
+        }
+      }
+      recordPhase(PHASE_BUTTONS, ESP.getCycleCount() - start);
+    }
+
+    // Touch pads, the same..
+    if (haveTouch) {
+      uint32_t start = ESP.getCycleCount();
+      bool touchedUP = (touchRead(touchUPPin) < touchThreshold);
+      bool touchedDOWN = (touchRead(touchDOWNPin) < touchThreshold);
+      if (touchedUP == inputs.touchUP) touchCount[0] = 0;
+      else if (++touchCount[0] >= inputDebounce) { inputs.touchUP = touchedUP; touchCount[0] = 0; }
+      if (touchedDOWN == inputs.touchDOWN) touchCount[1] = 0;
+      else if (++touchCount[1] >= inputDebounce) { inputs.touchDOWN = touchedDOWN; touchCount[1] = 0; }
+      recordPhase(PHASE_TOUCH, ESP.getCycleCount() - start);
+    }
+
+    // The pot. Oversample, smooth, and only report real movement..
+    if (usePOT) {
+      uint32_t start = ESP.getCycleCount();
+      uint32_t sum = 0;
+      for (uint8_t i = 0; i < potOversample; i++) sum += analogRead(potPIN);
+      uint32_t sample = (sum / potOversample) << 8;
+      if (!potStarted) {
+        potEMA = sample;
+        potStarted = true;
+      }
+      potEMA += ((int32_t)sample - (int32_t)potEMA) >> potSmoothing;
+      uint16_t smoothed = potEMA >> 8;
+
+      // Smaller steps with higher accuracy settings (see stepAccuracy), but never every last bit..
+      uint16_t hysteresis = max(101 - stepAccuracy, 4);
+      if (abs((int32_t)smoothed - (int32_t)potReported) >= hysteresis) {
+        potReported = smoothed;
+        inputs.pot = smoothed;
+        inputs.potMoved = true;
+      }
+      recordPhase(PHASE_POT, ESP.getCycleCount() - start);
+    } else {
+      potStarted = false;
+    }
+  }
+}
+
+
+// Start sampling (after the buttons are setup)..
+void startInputs() {
+  if (inputTask != NULL) return;
+  if (!haveButtons && !haveTouch && !havePot) return; // Nothing to sample!
+  if (xTaskCreatePinnedToCore(inputScan, "inputs", 3072, NULL, 1, &inputTask, 0) != pdPASS) {
+    inputTask = NULL;
+    Serial.println(" ERROR: Could not start the input sampling task!");
+  }
+}
+
+
+
+// Commands that only report (they don't change the signal, so they don't need the lock)..
+bool reportCommand(const String &input) {
+  return (input.startsWith("f?") || input == "ll" || input == "lll" || input == "binary?" || \
+          input.startsWith("stats") || input == "build" || input.startsWith("kernels") || \
+          input == "queue" || input == "version" || input == "wtf" || input == "c" || \
+          input == "help" || input == "?" || input == "list" || input.startsWith("export") || \
+          input.startsWith("mem") || input[0] == 'k' || input == ",");
+}
+
+
+
 /*
   Main Loop (aka. the void)
                             */
 
 void loop() {
 
+  // Time this pass (whichever way we leave)..
+  PhaseTimer passTimer(PHASE_LOOP);
+
   /*
     Start with Time and Tactile stuff..
                                       */
@@ -4223,39 +9362,42 @@ void loop() {
   uint32_t currentTime = millis();
   bool tmpE = eXi;
 
+  // Keep an eye on heap fragmentation..
+  if (currentTime - heapSampled >= 1000) {
+    heapSampled = currentTime;
+    uint32_t largest = ESP.getMaxAllocHeap();
+    if (largest < blockLow) blockLow = largest;
+  }
 
-  /*
-    Buttons..
-                  */
-
-  // Only run checks if buttons are enabled.
-  if (useButtons) {
+  // Tell any open web pages what's changed..
+  pushUpdates();
 
-    // Once button controls are created, this automatically loops through and checks them all..
-    for (uint8_t i = 0; i < buttonCount; i++) {
+  // Answer/feed any batch of commands..
+  batchStep();
 
-      // If /this/ button control is enabled..
-      if (buttons.my_butt[i].pin != 0) {
+  // Write settings to flash, once things have gone quiet..
+  settingsIdle();
 
-        // Read that button pin's current value..
-        buttons.my_butt[i].state = digitalRead(buttons.my_butt[i].pin);
+  // Benchmarking? Time this pass of the void and report when we've done enough commands..
+  if (bench.running) {
+    benchPass();
+    if (bench.commands >= bench.target) {
+      LastMessage = benchReport();
+      if (!binaryMode) Serial.print(LastMessage);
+    }
+  }
 
-        // If the button's state has changed..
-        if (buttons.my_butt[i].state != buttons.my_butt[i].oldState) {
 
-          // And is now /pressed/..
-          if (buttons.my_butt[i].state == 1) {
+  /*
+    Buttons..
 
-            // Perform the command..
-            QCommand = buttons.my_butt[i].command;
-            buttonPressed = true;
-          }
-          // This line will run twice; once when you press and again when you release the button.
-          // But thanks to its statefulness, the command code (above) runs only /once/.
-          buttons.my_butt[i].oldState = buttons.my_butt[i].state;
-        }
-      }
-    }
+    Scanned (and their commands queued) by inputScan().
+                  */
+  if (inputs.pressed.exchange(false)) {
+    buttonPressed = true;
+    // Once the button's command is done, a playing loop/macro restarts from its beginning.
+    loopPC = 0;
+    loopDepth = 0;
   }
 
 
@@ -4263,9 +9405,10 @@ void loop() {
 
   if (!buttonPressed) {
 
-    // Handle touches..
-    if (touchRead(touchUPPin) < touchThreshold) {
+    // Handle touches (already debounced by inputScan())..
+    if (haveTouch && inputs.touchUP) {
       if (mode == 'f' || currentTime > (touchTimer + deBounce)) {
+        SignalLock hold; // Touches and the pot change the signal (see SignalLock)
         touchTimer = currentTime;
         if (!reportTouches) eXi = false;
         touchUPStep();
@@ -4274,8 +9417,9 @@ void loop() {
       }
     }
     // Using interrupts here would spoil my fun!
-    if (touchRead(touchDOWNPin) < touchThreshold) {
+    if (haveTouch && inputs.touchDOWN) {
       if (mode == 'f' || currentTime > (touchTimer + deBounce)) {
+        SignalLock hold;
         touchTimer = currentTime;
         if (!reportTouches) eXi = false;
         touchDOWNStep();
@@ -4296,6 +9440,7 @@ void loop() {
     if (amDelaying) {
       if(currentTime < delayStart + delayTime) return;
       amDelaying = false; // Not actually required, if you think about it!
+      delayEnd = delayStart + delayTime;
     }
 
 
@@ -4315,48 +9460,45 @@ void loop() {
       // And this will be the actual value mapped from your potentiometer reading.
       uint16_t pValue;
 
-      // Check for potentiometer changes..
-      if (currentTime > (touchTimer + deBounce/stepAccuracy)) {
+      // Check for potentiometer changes (inputScan() has already smoothed out the noise)..
+      if (inputs.potMoved && currentTime > (touchTimer + deBounce/stepAccuracy)) {
 
+        SignalLock hold;
         touchTimer = currentTime;
-        analogValue = analogRead(potPIN);
-        // analogValue = constrain(analogValue, 4, 4092); // If you feel the need.
-
-        // We have movement!
-        if (analogValue > analogValueOLD + (101-stepAccuracy) || analogValue < analogValueOLD - (101-stepAccuracy) ) {
-
-          // Switch pot mode
-          switch (potMode) {
-            case 'p' :
-              lowVAL = 0;
-              highVAL = 100;
-              break;
-            case 'f' :
-              lowVAL = FreqLowerPotLimit;
-              highVAL = FreqUpperPotLimit;
-              break;
-            case 'b' :
-              lowVAL = 1;
-              highVAL = 10;
-          }
-
-          pValue = map(analogValue, 0, 4096, lowVAL, highVAL);
-          // if (eXi) Serial.printf("Setting %s to mapped POT Value: %i\n", makeHumanTouchMode(potMode), pValue); //debug
+        inputs.potMoved = false;
+        analogValue = inputs.pot;
+
+        // Switch pot mode
+        switch (potMode) {
+          case 'p' :
+            lowVAL = 0;
+            highVAL = 100;
+            break;
+          case 'f' :
+            lowVAL = FreqLowerPotLimit;
+            highVAL = FreqUpperPotLimit;
+            break;
+          case 'b' :
+            lowVAL = 1;
+            highVAL = 10;
+        }
 
-          switch (potMode) {
-            case 'p' :
-              setPulseWidth(pValue);
-              break;
-            case 'f' :
-              frequencySet((String)pValue);
-              break;
-            case 'b' :
-              switchResolution(pValue);
-          }
+        pValue = map(analogValue, 0, 4096, lowVAL, highVAL);
+        // if (eXi) Serial.printf("Setting %s to mapped POT Value: %i\n", makeHumanTouchMode(potMode), pValue); //debug
 
-          startSignal("Potentiometer Change");
-          analogValueOLD = analogValue;
+        switch (potMode) {
+          case 'p' :
+            setPulseWidth(pValue);
+            break;
+          case 'f' :
+            frequencySet((String)pValue);
+            break;
+          case 'b' :
+            switchResolution(pValue);
         }
+
+        startSignal("Potentiometer Change");
+        analogValueOLD = analogValue;
       }
     }
   }
@@ -4365,25 +9507,31 @@ void loop() {
   /*
     A Command is available.
 
-    Either from over the serial interface, or else the WebCommand string has been filled from the
-    web console or *somewhere* (maybe plain /URL command). Or maybe there are commands in the queue.
+    Either from over the serial interface, or the web console or *somewhere* (maybe plain /URL
+    command, or a button), via the command queue. Or maybe there's more of a chain to get through.
 
     Well, we have a command from /somewhere/.
 
     First, we populate "raw" with that String, whatever it is..
                                                                        */
-  if ((Serial.available() > 0) || (WebCommand != "") || QCommand !="") {
+  // Collect any serial input (never waits for the rest of a line)..
+  serialIngest();
+
+  if (QCommand != "" || commandsWaiting() != 0) {
 
+    PhaseTimer commandTimer(PHASE_COMMAND);
     bool isSerial = false;
     String raw, input, xMSG; // Raw user input, current command, re-usable temp String variable
 
-    // The queue is handled first.
+    // The rest of the current chain is handled first.
     if (QCommand != "") {
 
       // One single command is allowed to break into a macro/loop/queue..
-      if (Serial.peek() > 0 && Serial.readStringUntil('\n') == "end") {
+      if (endWaiting()) {
+          CommandSource source;
+          nextCommand(source, raw);
           endLoop(); // This also empties the queue.
-          if (eXi) Serial.println(" Command: 'end'");
+          if (eXi) Serial.printf(" Command: 'end' (from %s)\n", sourceNames[source]);
           return;
       }
 
@@ -4391,23 +9539,28 @@ void loop() {
 
     } else {
 
-      // Serial input comes next. In the extremely unlike event that there is *also* a web command
-      // available, it will be processed on the /next/ loop of the void (after any queue).
+      // Then the queue, in the order things arrived, from wherever they came from..
+      CommandSource source;
+      nextCommand(source, raw);
 
-      if (Serial.peek() > 0) {
-
-        // So we know where to send the main responses..
-        isSerial = true;
-
-        // Read command from the serial interface..
-        raw = Serial.readStringUntil('\n');
-
-      } else {
+      // So we know where to send the main responses..
+      isSerial = (source == FROM_SERIAL && !binaryMode); // Lines that beat "binary" to the queue; no answers now
+      fromWebConsole = (source == FROM_CONSOLE);
+      if (source == FROM_WEB || source == FROM_CONSOLE) raw = urlDecode(raw);
 
-        // Or web..
-        raw = urlDecode(WebCommand);
-        WebCommand = ""; // Got it now. So delete it.
+#if defined REMOTE
+      // A fresh command. Whatever it has to say gets pushed to the web pages (see pushUpdates())..
+      LastMessage = "";
+      queuedMessage = "";
+
+      // Time it, for the batch answer..
+      if (source == FROM_BATCH) {
+        batch.queued = false;
+        batch.running = true;
+        batch.started = micros();
+        didLimit = false;
       }
+#endif
     }
 
     // Now we have the raw command String.
@@ -4556,15 +9709,19 @@ void loop() {
       if (presetNumber != 0) {
         prefsSwitch(presetNumber);
         // In case it doesn't exist - so it shows up in the loops list/export/etc..
-        if (loopCommands != "-") prefs.putChar("i", 1);
+        if (loopCommands != "-") {
+          prefs.putChar("i", 1);
+          presetCatalog[presetNumber].exists = true;
+        }
       }
 
       // Wipe a loop..
       if (loopCommands == "-") {
+        setLoop(""); // Nothing loaded now (or compiled), either
         if (prefs.getString("o", "") != "") {
           prefs.putString("o", "");
           LastMessage = "Wiping loop commands";
-          if (presetEmpty()) {
+          if (presetEmpty(presetNumber)) {
             LastMessage += " and empty preset";
             wipePreset(presetNumber);
           }
@@ -4574,11 +9731,18 @@ void loop() {
       } else if (loopCommands) {
 
         if (loopCommands.length() > 3999) { // Including null terminator..
-          Serial.println(" Loop Commands Too Large To Store! (4000 bytes maximum)");
-          Serial.println(" NOTE: You can split your commands into multiple loops and chain them together.");
+          LastMessage = "Loop Commands Too Large To Store! (4000 bytes maximum)";
+          if (!binaryMode) {
+            Serial.printf(" %s\n", LastMessage.c_str());
+            Serial.println(" NOTE: You can split your commands into multiple loops and chain them together.");
+          }
         } else {
           LastMessage = (prefs.putString("o", loopCommands)) ? \
                                       "Saved loop commands" : "Failed to save loop commands";
+          // Compiled now, so it's ready to play. (Loaded during a loop: the new commands take over
+          // from here.)
+          if (!setLoop(loopCommands)) LastMessage += ", but they're too big to compile! They won't play (" + \
+                    (String)loopProgramMAX + " instructions / " + (String)sizeof(loopText) + " bytes of text maximum)";
         }
       }
 
@@ -4628,14 +9792,17 @@ void loop() {
         input = raw;
 
         // Delete last command in the queue, if it exists.
-        // If looping, instead re-populate QCommand with the loop commands..  Tada!
 
-        QCommand = (iLooping) ? loopCommands : "";
+        // When looping, the compiled loop takes over again once the queue is empty..
+
+        QCommand = "";
       }
     }
 
     input.trim();
 
+    if (bench.running) bench.commands++;
+
     // Now you can turn a brand new ESP32 device into a wifi-enabled Signal Generator with 50
     // named presets, macros and loops, in seconds.
 
@@ -4659,9 +9826,21 @@ void loop() {
       return;
     }
 
+    /*
+      A compact ($base64) preset, from "export all compact". Before lower case (base64 cares)..
+                                                           */
+    if (input[0] == compactMark) {
+      LastMessage = (importLine(input)) ? "Imported compact preset" : "Invalid compact preset (bad data or CRC)";
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
     // Normalise to lowercase, in case someone left their CAPSLOCK on by mistake..
     input.toLowerCase();
 
+    // From here on, commands change the signal; they hold the lock (reports don't need it)..
+    SignalLock hold(!reportCommand(input));
+
     if (isSerial && eXi && QCommand == "") Serial.printf("\n Command: \'%s\'\n", input.c_str());
 
 
@@ -4704,9 +9883,10 @@ void loop() {
 
                                                       */
     if (cmd == '~') {
+      if (bench.running) return; // We're measuring commands, not waiting.
       amDelaying = true;
       if (iData != 0) delayTime = iData;
-      delayStart = millis();
+      delayStart = loopDelayStart();
       return;
     }
 
@@ -4729,8 +9909,8 @@ void loop() {
     if (cmd == '*' && cmdData != "") {
       xMSG = cmdData;
       xMSG.trim();
-      uint32_t newFrequency = playMusicalNote(cmdData);
-      LastMessage = " Set Musical Note (" + xMSG + ") Frequency: " + (String)newFrequency + "Hz\n";
+      float_t newFrequency = playMusicalNote(cmdData);
+      LastMessage = " Set Musical Note (" + xMSG + ") Frequency: " + String(newFrequency, 3) + "Hz\n";
       startSignal("Music");
       if (isSerial && eXi && QCommand == "") Serial.printf(LastMessage.c_str());
       return;
@@ -4760,6 +9940,37 @@ void loop() {
     // On their own, "-" and "+" control PWM.
 
 
+    /*
+      Nearest achievable frequency (for the current wave)..
+
+        f?2.5k
+
+      Asks the frequency planner what you would /actually/ get, without touching the signal.
+      "f?" on its own asks about the current frequency.
+                                                          */
+    if (input.substring(0,2) == "f?") {
+      xMSG = input.substring(2);
+      xMSG.trim();
+      float_t askFreq = (xMSG != "") ? humanFreqToFloat(xMSG) : frequency;
+      FreqPlan plan = nearestFrequency(mode, askFreq);
+      char pbuf[256];
+      sprintf(pbuf, "Nearest achievable %s frequency to %s: ", makeHumanMode(mode).c_str(), makeHumanFrequency(askFreq).c_str());
+      if (plan.achieved == 0) {
+        sprintf(pbuf + strlen(pbuf), "None! (try a lower resolution)\n");
+      } else {
+        sprintf(pbuf + strlen(pbuf), "%s (error: %.0fppm)\n", makeHumanFrequency(plan.achieved).c_str(), plan.errorPPM);
+      }
+      if (plan.target != askFreq) sprintf(pbuf + strlen(pbuf), " (limited to %s)\n", makeHumanFrequency(plan.target).c_str());
+      if (mode == 'r') sprintf(pbuf + strlen(pbuf), " Best resolution at this frequency: %i bits\n", plan.bestBits);
+      if (mode != 's') sprintf(pbuf + strlen(pbuf), " Duty cycle steps: %u (%i%% -> %.2f%%)\n", \
+                                                                  plan.dutySteps, pulse, plan.dutyAchieved);
+      sprintf(pbuf + strlen(pbuf), " Planner cache: %u hits, %u misses\n", planHits, planMisses);
+      LastMessage = (String)pbuf;
+      if (isSerial || eXi) Serial.printf(" %s", LastMessage.c_str());
+      return;
+    }
+
+
 
     /*
         NOTE: We test against a single char OR a String.
@@ -4782,10 +9993,11 @@ void loop() {
     if (input == "wipe") {
         if (!isSerial && wipeIsSerialOnly) {
           LastMessage = "NVRAM Wipe can only be performed from Serial Connexion";
-          Serial.printf(" %s\n", LastMessage.c_str());
+          if (!binaryMode) Serial.printf(" %s\n", LastMessage.c_str());
           return;
         } else {
-          Serial.println(" Wiping NVRAM..");
+          if (!binaryMode) Serial.println(" Wiping NVRAM..");
+          discardSettings();
           WipeNVRAM();
           input = "x";
         }
@@ -4794,22 +10006,31 @@ void loop() {
     /*
       Reset settings to defaults (hard-written above, in the prefs) and reboot..
 
-      Letters used so far: a b c e f h i j l m n o p q r s t u w x z
+      Letters used so far: a b c d e f g h i j k l m n o p q r s t u w x z
 
       "i", "n", "o" and "q" are used internally, for preset index, preset name, stored loop/macro
-      data, and stored queued commands, respectively.
+      data, and stored queued commands, respectively. Presets keep their settings and name in "y"
+      (see PresetBlob), in their own namespace. "g" is the stored song (which, like your
+      loops, survives a reset).
 
                       */
     if (input == "reset") {
+      discardSettings();
       prefs.remove("a"); // waveAmplitude
       prefs.remove("b"); // PWMResBits
       prefs.remove("c"); // saveALL
+      prefs.remove("d"); // useDDS
+      prefs.remove("v"); // useDual + dual
       prefs.remove("e"); // eXi
       prefs.remove("f"); // frequency
       prefs.remove("h"); // touchMode
       prefs.remove("j"); // pStep
       prefs.remove("l"); // layerPresets
       prefs.remove("m"); // mode
+      prefs.remove("M"); // modulation
+      prefs.remove("S"); // syncRole
+      prefs.remove("B"); // autoBits
+      prefs.remove("T"); // train
       prefs.remove("p"); // pulse
       prefs.remove("r"); // RemControl
       prefs.remove("s"); // fStep
@@ -4818,17 +10039,23 @@ void loop() {
       prefs.remove("w"); // onlyAP
       prefs.remove("x"); // exportALL
       prefs.remove("z"); // cpuSpeed
-      Serial.println(" Wiping Stored Default Settings.");
+      prefs.remove("k"); // commitInterval
+      if (!binaryMode) Serial.println(" Wiping Stored Default Settings.");
       input = "x";
     }
 
 
     /*
     Set WiFi Access Point Only mode..   */
+    if ((input == "wap" || input == "waa") && !haveSoftAP) {
+      LastMessage = "The Soft Access Point isn't built in (#define SOFT_AP)";
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
     if (input == "wap") {
       onlyAP = true;
       prefs.putBool("w", onlyAP);
-      Serial.println(" Setting WiFi Access Point Only Mode..");
+      if (!binaryMode) Serial.println(" Setting WiFi Access Point Only Mode..");
       input = "x";
     }
 
@@ -4837,7 +10064,7 @@ void loop() {
     if (input == "waa") {
       onlyAP = false;
       prefs.putBool("w", onlyAP);
-      Serial.println(" Setting WiFi Station + AP (All Access) Mode..");
+      if (!binaryMode) Serial.println(" Setting WiFi Station + AP (All Access) Mode..");
       input = "x";
     }
 
@@ -4855,6 +10082,11 @@ void loop() {
     /*
     Toggle/Enable/Disable Remote Control.. */
     if (input.substring(0,6) == "remote") {
+      if (!haveRemote) {
+        LastMessage = "Remote Control isn't built in (#define REMOTE)";
+        if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
       switch (input[6]) {
         case 'e' :
           RemControl = true;
@@ -4880,15 +10112,16 @@ void loop() {
       if (QCommand != "") {
         if (QCommand.length() > 3999) {
           // There is a limit to how much you can store in one go:, 4000 bytes (including terminator).
-          Serial.println(" Queued Commands Too Large To Store! (4000 bytes maximum)");
-          Serial.println("Do your 'wipe' command on its own, THEN your commands.");
+          if (!binaryMode) Serial.println(" Queued Commands Too Large To Store! (4000 bytes maximum)");
+          if (!binaryMode) Serial.println("Do your 'wipe' command on its own, THEN your commands.");
         } else {
           prefsSwitch(); // Initialise prefs namespace so we can use prefs storage
-          if (prefs.putString("q", QCommand)) Serial.println(" Queued Commands Stored: OK");
+          if (prefs.putString("q", QCommand) && !binaryMode) Serial.println(" Queued Commands Stored: OK");
         }
       }
-      Serial.println(" Rebooting..");
+      if (!binaryMode) Serial.println(" Rebooting..");
       Serial.flush();
+      prefsSwitch(); // Writes out any cached settings
       prefs.end();
       ESP.restart();
     }
@@ -4963,15 +10196,21 @@ void loop() {
       }
 
       // Play a preset's loop and if it doesn't exist, default back to (keep) the most recently-loaded loop..
-      loopCommands = prefs.getString("o", loopCommands);
+      // (Compiled when it was saved or last loaded; same loop again, no compiling at all.)
+      bool compiled = setLoop(prefs.getString("o", loopCommands));
       if (loopCommands != "") {
-        iLooping = true; // delimiters would act like an "end" command..
-        while (loopCommands.endsWith(commandDelimiter)) loopCommands.remove(loopCommands.length()-1);
-        QCommand = loopCommands;
-        LastMessage = "Processing Loop Commands" + displayNum + ": " + loopCommands;
-        if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
-        eXiTmp = eXi;
-        eXi = false;
+        if (compiled) {
+          rewindLoop();
+          iLooping = true;
+          QCommand = "";
+          LastMessage = "Processing Loop Commands" + displayNum + " [" + (String)loopLength + " instructions]: " + loopCommands;
+          if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+          eXiTmp = eXi;
+          eXi = false;
+        } else {
+          LastMessage = "Loop Too Large To Compile! (" + (String)loopProgramMAX + " instructions maximum)";
+          if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        }
       } else {
         LastMessage = "No Loop Commands Found: ";
         if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
@@ -4983,12 +10222,123 @@ void loop() {
 
     // Stop playing a macro (it reached the end)..
     if (input == "end") {
+      if (bench.running) {
+        LastMessage = benchReport(); // This also ends the loop.
+        if (!binaryMode) Serial.print(LastMessage);
+        return;
+      }
       endLoop();
       return;
     }
 
+    // Binary serial mode (for test equipment)..
+    if (input == "binary") {
+      if (!isSerial) {
+        LastMessage = "Binary Mode can only be started from Serial Connexion";
+        if (eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
+      Serial.println(" Binary Mode. Send frame 0x7F to return to text.");
+      binaryStart();
+      return;
+    }
+
+    if (input == "binary?") {
+      LastMessage = binaryReport();
+      if (isSerial || eXi) Serial.print(LastMessage);
+      return;
+    }
+
+    // Settings cache statistics, or set how long to wait before writing to flash..
+    if (input.substring(0,5) == "cache") {
+      xMSG = input.substring(5);
+      xMSG.trim();
+      if (xMSG != "") {
+        commitInterval = xMSG.toInt();
+        prefs.putUInt("k", commitInterval);
+      }
+      LastMessage = cacheReport();
+      if (isSerial || eXi) Serial.print(LastMessage);
+      return;
+    }
+
+    // Performance metrics ("stats reset" to start again)..
+    if (input.substring(0,5) == "stats") {
+      if (input.indexOf("reset") != -1) {
+        resetMetrics();
+        LastMessage = "Performance metrics reset.";
+        if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
+      LastMessage = statsReport();
+      if (isSerial || eXi) Serial.print(LastMessage);
+      return;
+    }
+
+    // Network sync (leader/follow/off/?, or schedule an event on every unit)..
+    if (input.substring(0,4) == "sync") {
+      LastMessage = syncCommand(input.substring(4));
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
+    // What's built, how big, how fast..
+    if (input == "build") {
+      LastMessage = buildReport();
+      if (isSerial || eXi) Serial.print(LastMessage);
+      return;
+    }
+
+    // Waveform kernel benchmark and check..
+    if (input.substring(0,7) == "kernels") {
+      LastMessage = kernelsReport(input.substring(7));
+      if (isSerial || eXi) Serial.print(LastMessage);
+      return;
+    }
+
+    // Command queue statistics..
+    if (input == "queue") {
+      LastMessage = queueReport();
+      if (isSerial || eXi) Serial.print(LastMessage);
+      return;
+    }
+
+    /*
+      Benchmark the command path with the currently-loaded loop/macro..
+                                                            */
+    if (input.substring(0,5) == "bench") {
+      LastMessage = startBench(input.substring(5));
+      if (!binaryMode) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
+    /*
+      Timed events (frequency/pulse width/mode changes at an exact time)..
+                                                                      */
+    if (input.substring(0,2) == "at") {
+      LastMessage = timedEvent(input.substring(2));
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
+    // Songs..
+    if (input.substring(0,4) == "song") {
+      LastMessage = songCommand(input.substring(4));
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
+    // Frequency sweeps..
+    if (input.substring(0,5) == "sweep") {
+      LastMessage = startSweep(input.substring(5));
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
     // Stop currently running signal..
     if (input == "stop" || input == "." || input == "silence") {
+      stopSweep();
+      stopSong();
       stopSignal();
       return;
     }
@@ -5091,12 +10441,19 @@ void loop() {
       Extended Information in the serial/web console..
                       */
     if (input == "e") {
-      // Flip the extended info flag..
-      eXi = eXi ? false : true;
+      if (!haveVerbose) {
+        LastMessage = "Extended Info isn't built in (#define VERBOSE)";
+        if (isSerial) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
+      // Flip the extended info flag (in binary mode, the one we go back to; the console stays quiet)..
+      if (binaryMode) binaryXi = binaryXi ? false : true;
+      else eXi = eXi ? false : true;
+      bool flag = (binaryMode) ? binaryXi : (bool)eXi;
       // All Hail The Conditional Operator! It always works. But sometimes you need to add braces..
-      LastMessage = "Extended Info: " + (String)(eXi ? "Enabled" : "Disabled");
+      LastMessage = "Extended Info: " + (String)(flag ? "Enabled" : "Disabled");
       if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
-      prefs.putBool("e", eXi);
+      prefs.putBool("e", flag);
       return;
     }
 
@@ -5129,9 +10486,9 @@ void loop() {
         xMSG = xMSG.substring(1);
       }
       xMSG.trim();
-      char importDATA[72];
+      char importDATA[128];
       // Convert String to char array for importSettings()..
-      xMSG.toCharArray(importDATA, xMSG.length()+1);
+      xMSG.toCharArray(importDATA, sizeof(importDATA) - 1);
       // Add a comma to the end of the char array..
       sprintf(importDATA + strlen(importDATA), ","); // .. so strsep() captures the last datum
       LastMessage = importSettings(importDATA, pNum.toInt()) + getFreeEntries() + "\n\n";
@@ -5146,12 +10503,29 @@ void loop() {
       Export default settings or a preset's settings
                                           */
     if (input.substring(0,6) == "export") {
+
+      // Everything; written out as we go, a preset at a time..
+      if (input.indexOf("all") != -1) {
+        if (isSerial) {
+          Serial.println();
+          uint16_t count = streamExport(Serial, input.indexOf("compact") != -1);
+          LastMessage = "Exported " + (String)count + " presets";
+          Serial.printf("\n %s%s\n\n", LastMessage.c_str(), getFreeEntries().c_str());
+        } else {
+          LastMessage = "Export ALL is too big for here! Get it from /backup (or /backup?compact),"
+                                                                " and put it back with /restore";
+          if (eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        }
+        return;
+      }
+
       LastMessage = exportSettings(input.substring(6));
       if (isSerial || eXi) Serial.printf("\n %s\n\n", LastMessage.c_str());
       return;
     }
 
 
+
     /*
       Toggle Export All ("ea" to toggle, "eae" to enable, "ead" to disable)
 
@@ -5246,10 +10620,164 @@ void loop() {
     }
 
 
+    /*
+      Toggle Triangle DDS Mode ("dds" to toggle, "ddse" to enable, "ddsd" to disable)
+
+                                      */
+    if (input.substring(0,3) == "dds") {
+      switch (input[3]) {
+        case 'e' :
+          useDDS = true;
+          break;
+        case 'd' :
+          useDDS = false;
+          break;
+        default:
+          useDDS = (useDDS) ? false : true;
+      }
+      xMSG = (useDDS) ? "Enabled" : "Disabled";
+      LastMessage = "Triangle DDS Mode is " + xMSG + ".";
+      // Dual Channel mode needs DDS..
+      if (!useDDS && useDual) {
+        useDual = false;
+        saveDual();
+        LastMessage += " (So is Dual Channel Mode.)";
+      }
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      prefs.putBool("d", useDDS);
+      if (mode == 't') {
+        checkLimits(frequency); // DDS has its own limits
+        stopSignal(); // Different driver, so a real restart
+        startSignal("DDS Switch");
+      }
+      return;
+    }
+
+
+    /*
+      Dual Channel Mode ("dual" to toggle, "duale" to enable, "duald" to disable, "dual?" for info)
+      Set a channel with dual1/dual2 and import-style settings, e.g. "dual2 w=s,f=1.5k,o=90"
+
+                                      */
+    if (input.substring(0,4) == "dual") {
+      switch (input[4]) {
+        case '?' :
+          LastMessage = dualReport();
+          if (isSerial || eXi) Serial.print(LastMessage);
+          return;
+        case '1' :
+          LastMessage = dualSettings(1, input.substring(5));
+          break;
+        case '2' :
+          // Channel 2 changes on-the-fly (channel 1 is the regular signal, so that restarts)..
+          LastMessage = dualSettings(2, input.substring(5));
+          if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+          saveDual();
+          return;
+        case 'e' :
+          useDual = true;
+          break;
+        case 'd' :
+          useDual = false;
+          break;
+        default:
+          useDual = (useDual) ? false : true;
+      }
+      if (input[4] != '1') {
+        if (useDual && !useDDS) {
+          useDDS = true;
+          prefs.putBool("d", useDDS);
+        }
+        xMSG = (useDual) ? "Enabled" : "Disabled";
+        LastMessage = "Dual Channel Mode is " + xMSG + ".";
+        if (useDual && mode != 't') LastMessage += " (Switch to Triangle wave to use it.)";
+      }
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      saveDual();
+      if (mode == 't') {
+        checkLimits(frequency); // DDS limits
+        stopSignal(); // A real restart, so the channels start from their offsets
+        startSignal("Dual Switch");
+      }
+      return;
+    }
+
+
+    /*
+      Modulation.. "mod am 50 5" (type, depth %, rate Hz), "mod fm", "mod pwm 20 1", "mod off", "mod?"
+      Leave off the depth/rate to keep the ones you had.
+
+                                      */
+    if (input.substring(0,3) == "mod") {
+      if (input[3] == '?') {
+        LastMessage = modulationReport();
+        if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
+      if (!parseModulation(input.substring(3), modulation)) {
+        LastMessage = "Usage: mod <am/fm/pwm/off> [depth] [rate]";
+        if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
+      // Triangle wave does it in the DDS engine..
+      if (modulation.type && mode == 't' && !useDDS) {
+        useDDS = true;
+        prefs.putBool("d", useDDS);
+        checkLimits(frequency);
+      }
+      saveModulation();
+      startSignal("Modulation");
+      LastMessage = modulationReport();
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
+
+    /*
+      Pulse Trains.. "train f=0.5,w=10ms,n=20,g=5s", "train s=10ms/5ms/20ms/5ms,n=3", "train" to (re)start
+      the last one, "train?" for info, "train stop" to stop (any other signal change stops it, too).
+
+                                      */
+    if (input.substring(0,5) == "train") {
+      String trainData = input.substring(5);
+      trainData.trim();
+      if (trainData == "?") {
+        LastMessage = trainReport();
+        if (isSerial || eXi) Serial.print(LastMessage);
+        return;
+      }
+      if (trainData == "stop" || trainData == "off") {
+        stopTrain();
+        LastMessage = "Pulse Train stopped. (enter to restart the regular signal)";
+        if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
+      if (trainData != "") {
+        PulseTrain newTrain = train;
+        LastMessage = trainSettings(trainData, newTrain);
+        if (LastMessage != "") {
+          if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+          return;
+        }
+        train = newTrain;
+        saveTrain();
+      }
+      LastMessage = startTrain();
+      if (LastMessage == "") LastMessage = trainReport();
+      if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+      return;
+    }
+
+
     /*
      Use Potentiometer?   up/upe/upd
                                       */
     if (input.substring(0,2) == "up") {
+      if (!havePot) {
+        LastMessage = "Potentiometer Control isn't built in (#define POT)";
+        if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
+        return;
+      }
       switch (input[2]) {
         case 'e' :
           usePOT = true;
@@ -5328,7 +10856,7 @@ void loop() {
         startSignal("Console Mode Change");
       }
       // It may not have changed, but it has now been "set". So we save it..
-      prefs.putChar("m", mode);
+      cacheSetting('m', mode);
 
 
     } else {
@@ -5431,6 +10959,13 @@ void loop() {
                   So there will no "fail" state returned here.
                 */
         case 'b' :
+          // "b auto" (or just "ba") picks the best bits for each frequency (see bestResolution())..
+          if (cmdData.startsWith("a")) {
+            autoBits = true;
+            prefs.putBool("B", true);
+            bChange = true;
+            break;
+          }
           PWMResBits = switchResolution(iData);
           bChange = iData;
           break;
@@ -5550,6 +11085,7 @@ void loop() {
         case 'l' :
           LastMessage = loadedPreset = loadPreset(iData);
           if (isSerial || eXi) Serial.printf(" %s\n", loadedPreset.c_str());
+          if (!loadedPreset.startsWith("Loading")) return; // Nothing changed; leave the signal be.
           break;
 
 
@@ -5571,7 +11107,6 @@ void loop() {
           setTouchMode(chr2);
           LastMessage = "Touch handler set to " + makeHumanTouchMode(touchMode);
           if (isSerial || eXi) Serial.printf(" %s\n", LastMessage.c_str());
-          prefs.putChar("h", touchMode);
           return;
 
 
@@ -5602,6 +11137,8 @@ void loop() {
       }
 
       // Re-start generator with new (or old) settings..
+      // (<enter> is a real restart, even for triangle and square, which would otherwise retune in place)
+      if (reGen && input == "" && (mode == 't' || mode == 'r')) stopSignal();
       if (reGen) startSignal("Main Loop");
     }
 
@@ -5651,7 +11188,9 @@ void loop() {
       if (bChange) {
         char bpl;
         if (PWMResBits != 1) bpl = 's';
-        sprintf(buffer + strlen(buffer), " PWM Resolution set to: %i bit%c%s", PWMResBits, bpl, rState.c_str());
+        sprintf(buffer + strlen(buffer), " PWM Resolution set to: %i bit%c%s%s (duty steps of %.4g%%)%s", \
+                      (autoBits) ? ledcBits() : PWMResBits, bpl, (autoBits) ? " [auto]" : "", \
+                                          resolutionNote().c_str(), 100.0 / ledcSteps(), rState.c_str());
       }
       if (loadedPreset != "") sprintf(buffer + strlen(buffer), " Loaded Preset %s\n", loadedPreset.c_str());
       if (savedPreset != "") sprintf(buffer + strlen(buffer), " Saved Preset %s\n", savedPreset.c_str());
@@ -5663,11 +11202,20 @@ void loop() {
     // This will never display during a loop (isSerial == false)
     if (isSerial) Serial.println("\n Current Settings:\n");
     if (isSerial) Serial.println(getCurrentSettings());
+
+  } else if (iLooping && loopLength != 0) {
+
+    // Nothing else to do; next instruction of the compiled loop/macro..
+    SignalLock hold;
+    runLoopInstruction();
   }
 
 #if defined REMOTE
   // Handle any web server stuff..
-  if (RemControl) server.handleClient();
+  if (RemControl) {
+    PhaseTimer webTimer(PHASE_WEB);
+    server.handleClient();
+  }
 #endif
 
   // Scheduled to reboot?
@@ -5696,14 +11244,28 @@ void setup() {
 
   Serial.println("\n ***   Welcome to ESP32 Signal Generator v" + version + "  ***");
 
+  // Before anything else can change the signal (see SignalLock)..
+  signalLock = xSemaphoreCreateRecursiveMutex();
+
+  // Before anything can send us commands..
+  startCommandQueue();
+
   // Get settings from NVS..
   loadDefaultPrefs();
 
+  // Sine table for DDS/Dual Channel modes..
+  synthInit();
+  // The block kernels are checked against the (slow, but obviously right) reference generator..
+  if (uint8_t failed = synthCheck()) Serial.printf(" Waveform kernels: %u DON'T match!\n", failed);
+
   // Buttons!
   Serial.print(setupPhysicalButtons(false).c_str());
+  // .. and touches and the pot, from now on..
+  startInputs();
 
   // Set CPU speed (before network!)
   setCPUSpeed(cpuSpeed, true);
+  cyclesPerMicro = getCpuFrequencyMhz(); // For the metrics
 
   if (eXi) printBasicSketchInfo();
 
@@ -5729,18 +11291,20 @@ void setup() {
   // We get the signal up first, /then/ deal with remote control..
 #if defined REMOTE
   if (RemControl) startServer();
+  if (RemControl && syncRole && !startSync()) Serial.println(" Network Sync failed to start!");
 #endif
 
   Serial.printf("\n Current Settings:\n\n %s\n", getCurrentSettings().c_str());
 
-  // We just do it anyway (even when it's not 1st run), to return the free entries..
-  Serial.println(listPresets(true));
+  // Read the presets into RAM (on the first run, this creates their NameSpaces), and show the free
+  // entries..
+  Serial.println(loadCatalog());
 
   // Pick up any commands that were queued before a reboot..
   String readQ = prefs.getString("q", "");
   if (readQ != "") {
     Serial.printf("\n Discovered Queued Commands: %s\n Processing..\n", readQ.c_str());
-    QCommand = readQ;
+    queueCommand(FROM_BOOT, readQ);
     prefs.remove("q");
   }
 
@@ -0,0 +1,442 @@
+/*
+  A part of ESP32 Signal Generator
+
+  https://corz.org/public/scripts/ESP32/SignalGenerator/
+
+  Waveform synthesis for the I2S DAC (DDS, Dual Channel, modulation and the block kernels).
+
+  Numbers in, samples out. No Arduino, no ESP-IDF, no globals; just plain C++, so you can build
+  this on your PC and check the samples there, which is a lot quicker than squinting at a scope.
+  Something like..
+
+    #include "Synth.h"
+    int main() {
+      synthInit();
+      SynthChannel a = {}, b = {};
+      synthSetChannel(a, 't', 1000, 250000, 50, 255, 0);
+      synthSetChannel(b, 's', 1000, 250000, 50, 255, 90);
+      uint32_t block[250];
+      synthFillStereo(block, 250, a, b);
+      for (auto s : block) printf("%u\t%u\n", (s >> 8) & 0xFF, s >> 24);
+    }
+
+  .. and plot it, or whatever you like.
+
+  I2S sends 32-bit frames; two 16-bit channels. The built-in DAC takes the high byte of each, so an
+  8-bit sample for the first channel (the one triangle always used, pin 25) lives in bits 8-15 and
+  one for the second channel (pin 26) in bits 24-31.
+
+  It's all inline (or const), so more than one file can include it; the sketch and your test, say.
+
+*/
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <math.h>
+
+// One DAC channel's oscillator..
+struct SynthChannel {
+  uint32_t phase;       // Phase accumulator (one cycle == 2^32, so it wraps all by itself)
+  uint32_t tuningWord;  // Phase increment per sample (frequency * 2^32 / sample rate)
+  uint32_t upPoint;     // Phase at which the rising edge (triangle) or the high part (rectangle) ends
+  uint32_t slopeUP;     // Triangle rise per 24-bit phase step, Q32
+  uint32_t slopeDOWN;   // Triangle fall per 24-bit phase step, Q32
+  uint8_t amplitude;    // Peak (255, 127, 84, 63)
+  char wave;            // 't' triangle/sawtooth, 'w' saw, 's' sine, 'r' rectangle, 'n' noise
+};
+
+// One cycle of sine, centred on zero. A function's static, so there's only ever the one table..
+inline int8_t *synthSine() {
+  static int8_t table[256];
+  return table;
+}
+
+
+// Build the sine table. Call this once before anything else..
+inline void synthInit() {
+  int8_t *sine = synthSine();
+  for (uint16_t i = 0; i < 256; i++) sine[i] = (int8_t)lround(127.0 * sin(i * 2.0 * M_PI / 256.0));
+}
+
+
+// Frequency -> tuning word (which can't be 0, or the phase would never move)..
+inline uint32_t synthTuningWord(double frequency, uint32_t sampleRate) {
+  double words = frequency * 4294967296.0 / sampleRate;
+  if (words > 4294967295.0) words = 4294967295.0;
+  return (words < 1) ? 1 : (uint32_t)words;
+}
+
+
+/*
+  Work out where the rising edge ends and the rise/fall slopes for a pulse width (sawtooth angle).
+
+  We only use the top 24 bits of phase for the wave shape (the bottom 8 bits are far below what an
+  8-bit DAC can show), so a slope is "DAC units per 24-bit phase step", stored as Q32.
+                                                                                          */
+inline void synthSetShape(uint32_t &upPoint, uint32_t &slopeUP, uint32_t &slopeDOWN, uint8_t upTime, uint8_t amplitude) {
+  upPoint = (uint32_t)(((uint64_t)upTime << 32) / 100);
+  if (upTime >= 100) upPoint = 0xFFFFFFFF;
+  uint32_t up24 = upPoint >> 8;
+  uint32_t down24 = 0xFFFFFF - up24;
+  slopeUP = (up24) ? ((uint64_t)amplitude << 32) / up24 : 0;
+  slopeDOWN = (down24) ? ((uint64_t)amplitude << 32) / down24 : 0;
+}
+
+
+// Noise doesn't have a phase, so its accumulator holds a 32-bit xorshift state instead (never 0)..
+inline uint32_t synthNoiseStep(uint32_t state) {
+  if (state == 0) return 0x2545F491;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+
+// Everything a channel needs, in one go. Phase offset is in degrees..
+inline void synthSetChannel(SynthChannel &c, char wave, double frequency, uint32_t sampleRate, uint8_t pulse, \
+                                                                  uint8_t amplitude, uint16_t offset) {
+  c.wave = wave;
+  c.amplitude = amplitude;
+  c.tuningWord = synthTuningWord(frequency, sampleRate);
+  synthSetShape(c.upPoint, c.slopeUP, c.slopeDOWN, pulse, amplitude);
+  c.phase = (uint32_t)(((uint64_t)(offset % 360) << 32) / 360);
+  if (wave == 'n') c.phase = synthNoiseStep(c.phase); // Any non-zero state will do
+}
+
+
+// Triangle/sawtooth value at this phase..
+inline uint32_t synthTriangle(uint32_t phase, uint32_t upPoint, uint32_t slopeUP, uint32_t slopeDOWN) {
+  uint32_t p24 = phase >> 8;
+  uint32_t value;
+  if (phase < upPoint) {
+    value = ((uint64_t)p24 * slopeUP) >> 32;             // Rising edge
+  } else {
+    value = ((uint64_t)(0xFFFFFF - p24) * slopeDOWN) >> 32; // Falling edge
+  }
+  return (value > 255) ? 255 : value;
+}
+
+
+// Any wave, at the channel's current phase (0-255)..
+inline uint32_t synthSample(const SynthChannel &c) {
+  switch (c.wave) {
+    case 's' :
+      // Sine scales from the centre (like the cosine generator does)..
+      return 128 + ((int32_t)synthSine()[c.phase >> 24] * c.amplitude) / 256;
+    case 'r' :
+      return (c.phase < c.upPoint) ? c.amplitude : 0;
+    case 'w' :
+    case 'n' :
+      // Saw (a plain ramp, top 8 bits of phase) and noise (top 8 bits of the state), Q8 scaled..
+      return ((c.phase >> 24) * (c.amplitude + 1)) >> 8;
+    default :
+      return synthTriangle(c.phase, c.upPoint, c.slopeUP, c.slopeDOWN);
+  }
+}
+
+
+// .. and on to the next one..
+inline void synthStep(SynthChannel &c) {
+  c.phase = (c.wave == 'n') ? synthNoiseStep(c.phase) : c.phase + c.tuningWord;
+}
+
+
+/*
+  The reference generator; one sample at a time, in floating point, from the shapes as you'd draw
+  them. Triangle is the way fillBuffer() has always made it: up to the peak over the pulse width,
+  back down over the rest. It shares nothing with the kernels (below) but the phase accumulator and
+  the noise sequence, so it's an honest check on them; they do the same sums in fixed point, and
+  should never be more than one DAC step away from it (none at all for rectangle, which has no
+  sums to round). Slow, but obviously right. "right" puts the
+  samples in the second channel (bits 24-31), on top of whatever's already in the block.
+                                                                                          */
+inline void synthReference(uint32_t *block, uint16_t samples, SynthChannel &c, bool right = false) {
+  const float cycle = 4294967296.0f;
+  float up = c.upPoint / cycle;     // Pulse width, 0-1
+  float amplitude = c.amplitude;
+  for (uint16_t i = 0; i < samples; i++) {
+    float x = c.phase / cycle;      // How far through the cycle, 0-1
+    float value;
+    switch (c.wave) {
+      case 's' :
+        // 256 steps to a cycle, swinging 127/256ths of the amplitude either side of the centre..
+        value = roundf(128 + amplitude * 127 / 256 * sinf((c.phase >> 24) * 2 * (float)M_PI / 256));
+        break;
+      case 'r' :
+        value = (c.phase < c.upPoint) ? amplitude : 0;
+        break;
+      case 'w' :
+      case 'n' :
+        // A ramp (noise is the same, with a random "phase")..
+        value = floorf(amplitude * x);
+        break;
+      default :
+        value = floorf((x < up) ? amplitude * x / up : amplitude * (1 - x) / (1 - up));
+    }
+    uint32_t sample = (value < 0) ? 0 : (value > 255) ? 255 : (uint32_t)value;
+    if (right) block[i] |= sample << 24; else block[i] = sample << 8;
+    c.phase = (c.wave == 'n') ? synthNoiseStep(c.phase) : c.phase + c.tuningWord;
+  }
+}
+
+
+/*
+  Block kernels..
+
+  The same waves, one whole DMA block at a time, but with the wave, the amplitude and the channel
+  fixed at compile time. Each combination is its own function, so the switch below disappears (the
+  compiler keeps only the one case), the amplitude is a constant (a multiply and a shift, no
+  division), and the settings live in registers for the whole block. Integer only: Q32 phase, Q32
+  triangle slopes, Q8 amplitude.
+
+  Amplitude is one of the four levels (255, 127, 84, 63), the same as everywhere else. Triangle
+  doesn't use it; its slopes already have it built in (see synthSetShape()).
+
+  Every kernel gives exactly what synthSample() gives (bit for bit), stays within one DAC step of
+  synthReference(), and ends on the same phase; synthCheck() proves it.
+                                                                                          */
+template <char Wave, uint8_t Amplitude, bool Right>
+inline void synthBlock(uint32_t *block, uint16_t samples, SynthChannel &c) {
+  uint32_t phase = c.phase;
+  const int8_t *sine = synthSine();
+  const uint32_t tuningWord = c.tuningWord, upPoint = c.upPoint;
+  const uint32_t slopeUP = c.slopeUP, slopeDOWN = c.slopeDOWN;
+  for (uint16_t i = 0; i < samples; i++) {
+    uint32_t value;
+    switch (Wave) {
+      case 's' : value = 128 + ((int32_t)sine[phase >> 24] * Amplitude) / 256; break;
+      case 'r' : value = (phase < upPoint) ? Amplitude : 0; break;
+      case 'w' :
+      case 'n' : value = ((phase >> 24) * (Amplitude + 1)) >> 8; break;
+      default  : value = synthTriangle(phase, upPoint, slopeUP, slopeDOWN);
+    }
+    if (Right) block[i] |= value << 24; else block[i] = value << 8;
+    phase = (Wave == 'n') ? synthNoiseStep(phase) : phase + tuningWord;
+  }
+  c.phase = phase;
+}
+
+typedef void (*SynthKernel)(uint32_t *block, uint16_t samples, SynthChannel &c);
+
+const char synthWaves[] = "twsrn";            // Triangle, saW, Sine, Rectangle, Noise
+const uint8_t synthLevels[] = { 255, 127, 84, 63 };
+
+#define SYNTH_LEVELS(wave, right) \
+  { synthBlock<wave, 255, right>, synthBlock<wave, 127, right>, synthBlock<wave, 84, right>, synthBlock<wave, 63, right> }
+#define SYNTH_WAVES(right) { \
+  SYNTH_LEVELS('t', right), SYNTH_LEVELS('w', right), SYNTH_LEVELS('s', right), \
+  SYNTH_LEVELS('r', right), SYNTH_LEVELS('n', right) }
+
+const SynthKernel synthKernels[2][5][4] = { SYNTH_WAVES(false), SYNTH_WAVES(true) };
+
+#undef SYNTH_WAVES
+#undef SYNTH_LEVELS
+
+
+// The kernel for this wave/amplitude/channel, or NULL if there isn't one..
+inline SynthKernel synthKernel(char wave, uint8_t amplitude, bool right = false) {
+  int8_t w = -1, l = -1;
+  for (uint8_t i = 0; i < 5; i++) if (synthWaves[i] == wave) w = i;
+  for (uint8_t i = 0; i < 4; i++) if (synthLevels[i] == amplitude) l = i;
+  if (w == -1 || l == -1) return NULL;
+  return synthKernels[right][w][l];
+}
+
+
+// Fill a block from a channel, fast if we can..
+inline void synthFill(uint32_t *block, uint16_t samples, SynthChannel &c, bool right = false) {
+  SynthKernel kernel = synthKernel(c.wave, c.amplitude, right);
+  if (kernel) {
+    kernel(block, samples, c);
+    return;
+  }
+  // No kernel for this one (an odd amplitude); the same sums, deciding everything every sample..
+  for (uint16_t i = 0; i < samples; i++) {
+    if (right) block[i] |= synthSample(c) << 24; else block[i] = synthSample(c) << 8;
+    synthStep(c);
+  }
+}
+
+
+/*
+  Fill a block of stereo frames, one channel each side.
+
+  Both accumulators step once per frame, from the same sample clock, so whatever phase relationship
+  they start with, they keep (exactly, if the frequencies are the same; or drifting at precisely the
+  difference between them, if not, which is the whole point of X-Y displays).
+              */
+inline void synthFillStereo(uint32_t *block, uint16_t frames, SynthChannel &a, SynthChannel &b) {
+  synthFill(block, frames, a);
+  synthFill(block, frames, b, true);
+}
+
+
+/*
+  Modulation..
+
+  A modulator is just another (sine) oscillator, stepping along with the carrier, sample by sample..
+
+    AM  - the carrier's level dips by up to <depth> percent
+    FM  - the carrier's frequency swings <depth> percent either side
+    PWM - the pulse width (sawtooth angle) swings <depth> points either side (once per block)
+                                                                                          */
+struct SynthModulator {
+  char type;              // 'a' AM, 'f' FM, 'p' PWM
+  uint8_t depth;          // Percent (PWM: pulse width points)
+  uint32_t phase;
+  uint32_t tuningWord;    // Modulation rate
+  uint32_t carrierTuning; // The carrier's own (unmodulated) tuning word
+  uint8_t carrierPulse;   // .. and pulse width
+};
+
+
+// Fill a block of (single channel) samples from a modulated carrier..
+inline void synthFillModulated(uint32_t *block, uint16_t samples, SynthChannel &c, SynthModulator &m) {
+
+  // Pulse width moves once per block (it's two divisions to work out a new shape)..
+  if (m.type == 'p') {
+    int16_t p = m.carrierPulse + ((int16_t)m.depth * synthSine()[m.phase >> 24]) / 127;
+    if (p < 0) p = 0;
+    if (p > 100) p = 100;
+    synthSetShape(c.upPoint, c.slopeUP, c.slopeDOWN, p, c.amplitude);
+  }
+
+  int64_t deviation = (int64_t)m.carrierTuning * m.depth / 12700; // FM: tuning per unit of sine
+  int32_t dip = (m.depth * 256) / 100;                              // AM: 0-256
+  const int8_t *sine = synthSine();
+
+  for (uint16_t i = 0; i < samples; i++) {
+    int32_t lfo = sine[m.phase >> 24];
+    uint32_t value = synthSample(c);
+    if (m.type == 'a') value = (value * (256 - (dip * (127 - lfo)) / 254)) >> 8;
+    block[i] = value << 8;
+    c.phase += (m.type == 'f') ? (uint32_t)(m.carrierTuning + deviation * lfo) : c.tuningWord;
+    m.phase += m.tuningWord;
+  }
+}
+
+
+/*
+  Kernel self-check and benchmark..
+
+  synthCheck() runs every kernel from the same starting state (a few blocks, awkward settings, both
+  channels) as two other generators, and counts the ones that..
+
+    - differ at all from synthSample(), one sample at a time; that's the same fixed-point sums with
+      nothing fixed at compile time, so any specialising slip (or rounding slip) shows up here..
+    - stray from synthReference() by more than the fixed point can explain. It rounds differently
+      from the float shapes (Q32 slopes, Q8 amplitude, a truncated sine table), so a sample can land
+      one DAC step either side of the float value; that's the only tolerance, and rectangle, which
+      doesn't round anything, gets none..
+    - touch the other channel, or end up somewhere else in the cycle.
+
+  0 == all good.
+
+  synthBenchmark() does the same check and then times each (left channel) kernel, and the reference
+  for the same wave, over <samples> samples. clock() is any microsecond clock; micros() on the
+  ESP32, or on your PC, something like this (host/kernels.cpp is the full version)..
+
+    unsigned long hostMicros() {
+      using namespace std::chrono;
+      return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+    }
+
+    int main() {
+      synthInit();
+      SynthBenchResult results[synthBenchKernels];
+      uint8_t failed = synthBenchmark(results, hostMicros, 10000000);
+      for (auto &r : results) printf("%c %3u  %s  %12.0f  %12.0f\n", r.wave, r.amplitude, \
+                                    r.matches ? "OK  " : "FAIL", r.kernelRate, r.referenceRate);
+      return failed;
+    }
+                                                                                          */
+struct SynthBenchResult {
+  char wave;
+  uint8_t amplitude;
+  bool matches;           // Exactly synthSample() and within a DAC step of synthReference()
+  float kernelRate;       // Samples per second
+  float referenceRate;
+};
+
+const uint8_t synthBenchKernels = 20;   // 5 waves x 4 levels
+const uint16_t synthBenchBlock = 128;   // Same as the DMA blocks
+
+
+// A channel set up to test with; an odd frequency and pulse width, so nothing lines up nicely..
+inline SynthChannel synthTestChannel(char wave, uint8_t amplitude) {
+  SynthChannel c;
+  synthSetChannel(c, wave, 1234.5, 250000, 37, amplitude, 45);
+  return c;
+}
+
+
+inline bool synthCheckKernel(char wave, uint8_t amplitude, bool right) {
+  uint32_t expected[synthBenchBlock], exact[synthBenchBlock], got[synthBenchBlock];
+  SynthChannel a = synthTestChannel(wave, amplitude), b = a, c = a;
+  SynthKernel kernel = synthKernel(wave, amplitude, right);
+  if (kernel == NULL) return false;
+  uint8_t shift = (right) ? 24 : 8;
+  uint32_t mask = (uint32_t)0xFF << shift;
+  int16_t tolerance = (wave == 'r') ? 0 : 1; // (see above)
+  for (uint8_t pass = 0; pass < 8; pass++) {
+    for (uint16_t i = 0; i < synthBenchBlock; i++) expected[i] = exact[i] = got[i] = (i * 0x00010101) & ~mask; // Other channel junk
+    synthReference(expected, synthBenchBlock, a, right);
+    kernel(got, synthBenchBlock, b);
+    for (uint16_t i = 0; i < synthBenchBlock; i++) {
+      uint32_t sample = synthSample(c);
+      if (right) exact[i] |= sample << 24; else exact[i] = sample << 8;
+      synthStep(c);
+      if (got[i] != exact[i]) return false;
+      if ((expected[i] & ~mask) != (got[i] & ~mask)) return false;
+      int16_t difference = (int16_t)((got[i] & mask) >> shift) - (int16_t)((expected[i] & mask) >> shift);
+      if (difference < -tolerance || difference > tolerance) return false;
+    }
+    if (a.phase != b.phase || c.phase != b.phase) return false;
+  }
+  return true;
+}
+
+
+inline uint8_t synthCheck() {
+  uint8_t failed = 0;
+  for (uint8_t w = 0; w < 5; w++) {
+    for (uint8_t l = 0; l < 4; l++) {
+      if (!synthCheckKernel(synthWaves[w], synthLevels[l], false)) failed++;
+      if (!synthCheckKernel(synthWaves[w], synthLevels[l], true)) failed++;
+    }
+  }
+  return failed;
+}
+
+
+inline uint8_t synthBenchmark(SynthBenchResult *results, unsigned long (*clock)(), uint32_t samples) {
+
+  static uint32_t block[synthBenchBlock];
+  uint32_t blocks = samples / synthBenchBlock;
+  if (blocks == 0) blocks = 1;
+  uint8_t failed = 0;
+
+  for (uint8_t w = 0; w < 5; w++) {
+    for (uint8_t l = 0; l < 4; l++) {
+      SynthBenchResult &r = results[w * 4 + l];
+      r.wave = synthWaves[w];
+      r.amplitude = synthLevels[l];
+      r.matches = synthCheckKernel(r.wave, r.amplitude, false) && synthCheckKernel(r.wave, r.amplitude, true);
+      if (!r.matches) failed++;
+
+      SynthChannel c = synthTestChannel(r.wave, r.amplitude);
+      SynthKernel kernel = synthKernel(r.wave, r.amplitude);
+      unsigned long start = clock();
+      for (uint32_t i = 0; i < blocks; i++) kernel(block, synthBenchBlock, c);
+      unsigned long took = clock() - start;
+      r.kernelRate = (took) ? blocks * synthBenchBlock * 1000000.0 / took : 0;
+
+      start = clock();
+      for (uint32_t i = 0; i < blocks; i++) synthReference(block, synthBenchBlock, c);
+      took = clock() - start;
+      r.referenceRate = (took) ? blocks * synthBenchBlock * 1000000.0 / took : 0;
+    }
+  }
+  return failed;
+}
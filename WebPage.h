@@ -16,10 +16,10 @@
 
     ** There is now a direct URL command interface, e.g. /p50. See the main sketch for details.
 
-    MCU purists may prefer const char *WebPage = ...
-
-    But you would lose that lovely String.replace(). ESP32 has gobs of RAM, and robust heap
-    management - enjoy the good life!
+    The page lives in flash (const char, PROGMEM) and is sent as-is, with an ETag, so your browser
+    only downloads it again when you upload a new version. Anything that changes (version, preset
+    names) is fetched by the page itself, from /pageData. So if you add your own live data, add it
+    to /pageData (see sendPageData() in the main sketch) and fill it in from getPageData(), below.
 
     It's good to get into the habit of NOT putting a newline after the opening HEREDOC statement.
     Formats like SVG will fail dramatically if you do this.
@@ -29,7 +29,7 @@
     switch out the links on this page; inside setUP() and setDOWN(), below.
 
 */
-String WebPage = R"HTML5(<!DOCTYPE html>
+const char WebPage[] PROGMEM = R"HTML5(<!DOCTYPE html>
 <html>
 <head>
   <title>ESP32 Signal Generator</title>
@@ -266,8 +266,8 @@ String WebPage = R"HTML5(<!DOCTYPE html>
 </style>
 </head>
 <body>
-  <div class="controller"><!-- You can switch out {tokens} for live data at page-load -->
-    <div id="head" onclick="createWebConsole()" title="Click here to activate the Web Console"><span id="header">ESP32 Signal Generator</span>&nbsp;<span id="version">v{Version}</span>
+  <div class="controller"><!-- Live data is filled in at page-load, from /pageData -->
+    <div id="head" onclick="createWebConsole()" title="Click here to activate the Web Console"><span id="header">ESP32 Signal Generator</span>&nbsp;<span id="version"></span>
     </div>
     <div id="live-values">
       <p id="frequencyVAL" onclick="getFrequency()" title="Click here to update with the current frequency.">Frequency: <span id="FreqValue"></span></p>
@@ -332,15 +332,15 @@ note: this also sets sawtooth angle in the triangle generator">
     </div>
     <div id="presets" title="Load/Save presets..
 (Ctrl+Click to save a new preset with the current settings.)">
-      <div id="preset_1" title="{1}" onclick="loadPreset(1)" class="preset-button">1</div>
-      <div id="preset_2" title="{2}" onclick="loadPreset(2)" class="preset-button">2</div>
-      <div id="preset_3" title="{3}" onclick="loadPreset(3)" class="preset-button">3</div>
-      <div id="preset_4" title="{4}" onclick="loadPreset(4)" class="preset-button">4</div>
-      <div id="preset_5" title="{5}" onclick="loadPreset(5)" class="preset-button">5</div>
-      <div id="preset_6" title="{6}" onclick="loadPreset(6)" class="preset-button">6</div>
-      <div id="preset_7" title="{7}" onclick="loadPreset(7)" class="preset-button">7</div>
-      <div id="preset_8" title="{8}" onclick="loadPreset(8)" class="preset-button">8</div>
-      <div id="preset_9" title="{9}" onclick="loadPreset(9)" class="preset-button">9</div>
+      <div id="preset_1" title="" onclick="loadPreset(1)" class="preset-button">1</div>
+      <div id="preset_2" title="" onclick="loadPreset(2)" class="preset-button">2</div>
+      <div id="preset_3" title="" onclick="loadPreset(3)" class="preset-button">3</div>
+      <div id="preset_4" title="" onclick="loadPreset(4)" class="preset-button">4</div>
+      <div id="preset_5" title="" onclick="loadPreset(5)" class="preset-button">5</div>
+      <div id="preset_6" title="" onclick="loadPreset(6)" class="preset-button">6</div>
+      <div id="preset_7" title="" onclick="loadPreset(7)" class="preset-button">7</div>
+      <div id="preset_8" title="" onclick="loadPreset(8)" class="preset-button">8</div>
+      <div id="preset_9" title="" onclick="loadPreset(9)" class="preset-button">9</div>
     </div>
   </div>
   <div id="InfoDIV" title="Information appears here.
@@ -366,12 +366,75 @@ var updateDelay = 777;
 // There is no way back. If you really must read the title again, refresh the page.
 var goneConsole = false;
 
+// True while we have a live event stream (then we don't need to keep asking for the status)..
+var pushed = false;
+var lastMessageTime = 0;
+
 
 // you could call the functions directly right here, but I like this better..
 window.onload = (event) => {
   getStatus();
+  getPageData();
+  getEvents();
 };
 
+
+/*
+   Live Events..
+
+   The generator pushes changes to us as they happen, from whichever page, console, button or loop
+   they came from. If the browser can't do EventSource, or the stream drops, we go back to asking.
+                                                                                          */
+function getEvents() {
+  if (!window.EventSource) return;
+  var events = new EventSource("events");
+  events.onopen = function() { pushed = true; };
+  events.onerror = function() { pushed = false; };
+
+  // Wave, frequency, loop state, then the full status..
+  events.addEventListener("status", function(e) {
+    var lines = e.data.split("\n");
+    document.getElementById("WaveForm").innerHTML = lines[0] + ((lines[2] != "") ? " (" + lines[2] + ")" : "");
+    document.getElementById("FreqValue").innerHTML = lines[1];
+    var foo = lines.slice(3).join("\n");
+    foo = foo.replaceAll("\t", "<div>");
+    foo = foo.replaceAll("\n", "</div>");
+    // Give any command output a moment on screen first..
+    var wait = lastMessageTime + (updateDelay * 2) - Date.now();
+    window.setTimeout( function() {
+      postMSG(foo);
+    }, (wait > 0) ? wait : 0);
+  });
+
+  // Command output..
+  events.addEventListener("message", function(e) {
+    lastMessageTime = Date.now();
+    commandOutput(e.data);
+  });
+
+  // Presets renamed/wiped..
+  events.addEventListener("names", function(e) {
+    getPageData();
+  });
+}
+
+// Version, then the preset names, one per line..
+function getPageData() {
+  var AJAX = new XMLHttpRequest();
+  AJAX.onreadystatechange = function() {
+    if(this.readyState == 4 && this.status == 200) {
+      var lines = this.responseText.split("\n");
+      document.getElementById("version").innerHTML = "v" + lines[0];
+      for (var i = 1; i <= buttonMax && i < lines.length; i++) {
+        var button = document.getElementById("preset_" + i);
+        if (button) button.title = lines[i];
+      }
+    }
+  };
+  AJAX.open("GET", "pageData", true);
+  AJAX.send();
+}
+
 // If you add buttons, increase this number to match
 var buttonMax = 9;
 
@@ -404,9 +467,12 @@ function sendCommand() {
       }
       document.querySelector("#webConsole").focus();
       document.querySelector("#webConsole").value = "";
-      window.setTimeout( function() {
-        getCommandStatus();
-      }, updateDelay);
+      // With live events, the output comes to us (a blank command has none, so we ask)..
+      if (!pushed || myCommand == "!") {
+        window.setTimeout( function() {
+          getCommandStatus();
+        }, updateDelay);
+      }
     }
   };
   var myCommand = document.querySelector("#webConsole").value;
@@ -424,31 +490,7 @@ function getCommandStatus() {
   AJAX.onreadystatechange = function() {
     if(this.readyState == 4 && this.status == 200) {
       if (this.responseText) {
-        /* Rather than force the user to reload the page for updated button titles, we can check for
-           rename commands and switch the button title right here in JavaScript, using browser CPU cycles.
-
-           This only works if namePreset() outputs *exactly* THIS text: " ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ " */
-
-        if (this.responseText.indexOf("Set name of preset") != -1 ) { // Set name of preset [x] to "Name"
-          var regex = /preset \[(.+)\] to \"([^"]+)\"/
-          var tData = this.responseText.match(regex);
-          if ( parseInt(tData[1]) <= buttonMax ) { // only apply to buttons 1-buttonMax (no need to check for <1)
-            document.getElementById("preset_" + tData[1]).title = tData[2]; // Yeah, JavaScript is alright.
-          }
-        }
-        // Similarly, we can clear the titles of wiped presets..
-        if (this.responseText.indexOf("Clearing") != -1 ) {
-          var regex = /Clearing preset\ (.+)/
-          var tData = this.responseText.match(regex);
-          if ( parseInt(tData[1]) <= buttonMax ) {
-            document.getElementById("preset_" + tData[1]).title = "";
-          }
-        }
-
-        postMSG(this.responseText);
-        window.setTimeout( function() {
-          delayedStatus();
-          }, updateDelay * 2);
+        commandOutput(this.responseText);
       }
     }
   };
@@ -456,6 +498,35 @@ function getCommandStatus() {
   AJAX.send();
 }
 
+// Show the output from a command (polled or pushed)..
+function commandOutput(message) {
+  /* Rather than force the user to reload the page for updated button titles, we can check for
+     rename commands and switch the button title right here in JavaScript, using browser CPU cycles.
+
+     This only works if namePreset() outputs *exactly* THIS text: " ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ ↓ " */
+
+  if (message.indexOf("Set name of preset") != -1 ) { // Set name of preset [x] to "Name"
+    var regex = /preset \[(.+)\] to \"([^"]+)\"/
+    var tData = message.match(regex);
+    if ( parseInt(tData[1]) <= buttonMax ) { // only apply to buttons 1-buttonMax (no need to check for <1)
+      document.getElementById("preset_" + tData[1]).title = tData[2]; // Yeah, JavaScript is alright.
+    }
+  }
+  // Similarly, we can clear the titles of wiped presets..
+  if (message.indexOf("Clearing") != -1 ) {
+    var regex = /Clearing preset\ (.+)/
+    var tData = message.match(regex);
+    if ( parseInt(tData[1]) <= buttonMax ) {
+      document.getElementById("preset_" + tData[1]).title = "";
+    }
+  }
+
+  postMSG(message);
+  window.setTimeout( function() {
+    delayedStatus();
+    }, updateDelay * 2);
+}
+
 
 /*
     Text Inputs
@@ -676,6 +747,7 @@ function loadPreset(presetNumber) {
 }
 
 function delayedStatus() {
+    if (pushed) return; // It'll come to us.
     window.setTimeout( function() {
     getStatus();
   }, updateDelay);
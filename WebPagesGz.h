@@ -0,0 +1,615 @@
+/*
+  A part of ESP32 Signal Generator
+
+  Gzip copies of WebPage.h and Console.h, made by host/gzpages.py. Don't edit this; edit the
+  pages, then run "make pages" in host/ (if you don't, the page you edited is sent uncompressed).
+*/
+
+// WebPage (27927 bytes, 9423 gzipped)..
+const uint32_t WebPageGzSource = 0x542bc137;
+const uint8_t WebPageGz[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xdd,0x7d,0xd7,0x76,0xe3,0xc6,0xb2,0xe8,0xf3,0x99,
+  0xaf,0x68,0xd3,0xcb,0x1e,0x6a,0x24,0x31,0x07,0x71,0x66,0x24,0x5f,0xe6,0x1c,0x01,0xc6,0x2d,0x9f,0xbd,
+  0x40,0x02,0x04,0x21,0x22,0x11,0x81,0x41,0xe7,0xcc,0xeb,0xfd,0x81,0xfb,0x87,0xf7,0x4b,0x6e,0x75,0x37,
+  0x12,0x93,0x24,0x6f,0xdf,0xbd,0x96,0x8f,0xc7,0x8b,0x22,0xd8,0xa1,0xba,0xba,0xaa,0xba,0x42,0x77,0x35,
+  0xfc,0xfd,0xa7,0x52,0xb7,0xc8,0x4e,0x7b,0x65,0xb4,0xb2,0x14,0xf9,0xe9,0xd3,0x77,0xf7,0x4b,0xe0,0xf8,
+  0xa7,0x4f,0x08,0x7d,0xb7,0x24,0x4b,0x16,0x9e,0xca,0x4c,0x2f,0x99,0x40,0x8c,0x24,0xaa,0x9c,0x8c,0xaa,
+  0x82,0x2a,0x18,0x9c,0xa5,0x19,0xdf,0xa3,0xb4,0x16,0xb7,0x53,0x04,0x8b,0x43,0x2a,0xa7,0x08,0x8f,0xa1,
+  0xad,0x24,0xec,0x74,0xcd,0xb0,0x42,0x68,0xa1,0xa9,0x96,0xa0,0x5a,0x8f,0xa1,0x9d,0xc4,0x5b,0xab,0x47,
+  0x5e,0xd8,0x4a,0x0b,0xe1,0x9e,0xfc,0xb8,0x43,0x92,0x2a,0x59,0x12,0x27,0xdf,0x9b,0x0b,0x4e,0x16,0x1e,
+  0xe3,0x21,0x02,0xe6,0xa7,0xfb,0x7b,0x84,0x7a,0x9d,0x2a,0x5a,0x72,0xd0,0x56,0x53,0x91,0xa4,0x70,0xa2,
+  0x70,0x87,0x04,0x75,0xa1,0xf1,0x02,0x8f,0x38,0x13,0xcd,0x39,0x53,0xc8,0xa4,0xd0,0xfd,0x13,0xa0,0x6c,
+  0xe9,0xe6,0xd7,0x68,0x54,0x90,0x15,0x6e,0x15,0x91,0xb4,0xa8,0xa5,0x69,0xb2,0x19,0xa5,0x0d,0xee,0x49,
+  0xcf,0x7b,0xda,0xd1,0x88,0xa2,0xfb,0x7b,0x32,0x80,0x2c,0xa9,0x6b,0x64,0x08,0xf2,0x63,0xc8,0x5c,0x01,
+  0x8e,0x0b,0xdb,0x42,0x78,0x9c,0x10,0xb2,0x0e,0x3a,0xe0,0x4e,0x3a,0x45,0x75,0x55,0x0c,0x21,0x53,0x7a,
+  0x15,0xcc,0xc7,0x50,0x3c,0xb3,0x8f,0x67,0x42,0x68,0x65,0x08,0xcb,0xc7,0x10,0xcf,0x59,0xdc,0x57,0xaf,
+  0xcd,0x37,0x3a,0xd2,0x9d,0x34,0x2a,0x74,0x07,0xbb,0x58,0xb3,0x2a,0x6a,0x79,0xf8,0xd7,0x61,0x86,0xab,
+  0xf2,0x50,0x84,0xa7,0x02,0xfe,0x99,0xef,0x17,0xf3,0x7d,0xf8,0x2a,0xc6,0x6f,0x5f,0x96,0x1b,0x5c,0x50,
+  0xa8,0xf2,0x05,0x76,0x58,0xce,0xe7,0x5b,0xd5,0x5e,0x31,0xba,0x5f,0x15,0x70,0x75,0x5e,0xde,0x31,0x15,
+  0xf9,0x15,0x1e,0xec,0xfa,0x0e,0xaa,0xa4,0x76,0x41,0x68,0x0e,0xa3,0x3c,0x86,0x93,0xe7,0x63,0xcc,0x30,
+  0x5e,0x29,0xdc,0x2e,0x0a,0x95,0xc1,0x22,0xdf,0x38,0x54,0x06,0xa5,0xfd,0x1a,0x57,0xcc,0xf8,0xf2,0x68,
+  0xca,0x97,0x3b,0xdb,0xf9,0x38,0x2e,0xcf,0xd5,0x7e,0xbe,0x9f,0x6c,0xc8,0xd3,0xc9,0x40,0x9e,0x15,0x0b,
+  0x49,0x6e,0x32,0xd0,0xea,0x65,0xbe,0xc1,0x8e,0x0a,0x13,0xb1,0x9f,0x9a,0xe0,0x0e,0xc9,0xb2,0x5c,0xee,
+  0x8f,0xfa,0xda,0x6b,0x6a,0x3c,0xe8,0xc5,0xac,0xe2,0x62,0xc0,0x54,0x6b,0xc9,0x94,0x1d,0x1b,0x08,0xf5,
+  0xbd,0xd6,0xec,0xef,0x0a,0xda,0x96,0xed,0xc7,0xa5,0x6a,0x4f,0xdc,0xef,0x36,0x15,0x7e,0x21,0x46,0xd5,
+  0xad,0x56,0xeb,0x27,0x4b,0xbc,0xb6,0xd9,0x54,0x1a,0xab,0x87,0x83,0xdc,0x9e,0x54,0xcc,0x76,0x91,0xd1,
+  0xea,0xdc,0x6d,0x4f,0xcc,0x65,0x0d,0x35,0xb9,0x2d,0xcd,0x5e,0xd5,0x92,0xc0,0xaa,0xea,0xb6,0xbb,0xac,
+  0x98,0x62,0x2f,0x3a,0x4d,0x14,0x67,0x7a,0x21,0x96,0x3d,0xcc,0x86,0x3b,0x23,0x9e,0xec,0xb5,0x96,0xca,
+  0x54,0xdb,0x89,0xf9,0xfe,0x21,0x3b,0x4d,0xa7,0xfb,0x9b,0x1e,0xdb,0xd4,0x92,0xaa,0x61,0x1e,0x1a,0x95,
+  0x8a,0x91,0xde,0xdb,0x6c,0x39,0x1f,0x2d,0xcd,0x67,0xa3,0xf9,0x70,0xab,0xa4,0xc4,0x42,0x4e,0x5f,0xf7,
+  0xf3,0x6a,0xbe,0xb6,0xad,0xee,0xcd,0x22,0xdf,0x51,0x57,0xf9,0x7a,0xa1,0x94,0x53,0x57,0xad,0x71,0x2c,
+  0x6e,0xe7,0xab,0x0d,0x63,0xb2,0x59,0x94,0xaa,0xb1,0x69,0xcb,0x4e,0xf4,0xf6,0x73,0x35,0x5b,0x6a,0x8a,
+  0x51,0x69,0x95,0xd1,0x72,0x0f,0xac,0xb2,0xb7,0x85,0x7e,0x59,0xc8,0x8f,0xc5,0x7e,0xa6,0x38,0x4c,0x54,
+  0x5e,0x0f,0xe9,0xcc,0x70,0xb4,0x8c,0x1e,0x0e,0x5c,0xd1,0xde,0xdb,0x8b,0x0c,0x9b,0x68,0x95,0xec,0xac,
+  0xd9,0xd8,0x0d,0x56,0x85,0xec,0xfc,0xa1,0xfc,0x32,0xc9,0x35,0x6a,0xe9,0x31,0x9b,0xce,0x0a,0xb9,0xe6,
+  0xb8,0xb2,0x95,0x54,0xb1,0xc2,0x56,0xaa,0x71,0x26,0x97,0xce,0x70,0x49,0x42,0xff,0x42,0x63,0x30,0x4c,
+  0x97,0x8d,0x75,0x43,0x14,0xc5,0xc7,0xc7,0x10,0x8a,0xc2,0x12,0x31,0xad,0x03,0x95,0xfd,0xe8,0x17,0xa4,
+  0xa9,0x0b,0x01,0x1d,0x34,0x1b,0x69,0xba,0xa0,0x22,0x0e,0x91,0x3a,0x64,0x71,0xe2,0x1d,0x2a,0x32,0x0c,
+  0xac,0x03,0x45,0x81,0x75,0x80,0x0c,0x5b,0x16,0x4c,0xc4,0xe9,0xba,0x7c,0x40,0x5f,0xa2,0xd0,0x15,0xaf,
+  0x36,0xf4,0x5f,0xf0,0x80,0x10,0x59,0x15,0x5f,0x51,0x3c,0x16,0xfb,0x05,0xfd,0x24,0x29,0x78,0x01,0x71,
+  0xaa,0xf5,0x8d,0xd4,0xad,0x04,0x49,0x5c,0x59,0x57,0x2a,0x97,0xb0,0xc8,0xee,0x97,0x9c,0x22,0xc9,0x87,
+  0xaf,0x88,0xe5,0x56,0x9a,0xc2,0xd1,0x0a,0x5e,0x32,0x75,0x99,0x83,0x42,0x49,0x05,0xa9,0x17,0xee,0xe7,
+  0xb2,0xb6,0x58,0xd3,0xaa,0x85,0x26,0x6b,0xc6,0x57,0xf4,0x73,0xf2,0x81,0x9b,0xa7,0xd2,0xb4,0x4c,0xe1,
+  0x0c,0x51,0x52,0xbf,0xa2,0x18,0xfe,0xf9,0xe3,0x13,0xee,0xbf,0xbd,0x43,0xba,0x21,0x38,0x08,0x9e,0xd5,
+  0xeb,0x77,0x30,0xb6,0xa1,0x5c,0xab,0x9e,0xdb,0x96,0xa5,0xa9,0x77,0x28,0xa2,0xe2,0x45,0x2f,0xa9,0xba,
+  0x6d,0xdd,0xa1,0x9f,0xb1,0x62,0x81,0x32,0x00,0x6b,0x0a,0xd6,0x3d,0x6d,0xe3,0x40,0x98,0x6b,0x06,0xac,
+  0xd4,0x7b,0x83,0xe3,0x25,0xdb,0x04,0x40,0x91,0x78,0x5a,0x50,0x5c,0x68,0x11,0xac,0x4b,0x0c,0x4d,0x96,
+  0x05,0xe3,0x64,0xc0,0x78,0x24,0x0b,0xed,0x10,0x67,0x5b,0x9a,0xff,0xe7,0x5b,0x90,0xa6,0xb9,0xcc,0x2f,
+  0x2e,0x18,0x99,0x9b,0x0b,0x2e,0xc5,0x3d,0xfa,0xa8,0x9a,0x2a,0x78,0xe3,0x18,0x98,0xd4,0x4e,0x0b,0x4b,
+  0xd8,0x5b,0xf7,0x9c,0x0c,0x6a,0xef,0x2b,0x22,0xe5,0x14,0xac,0xce,0xf1,0x3c,0x08,0xc9,0xbd,0x41,0xb9,
+  0x12,0x8b,0x24,0x1c,0x44,0x81,0x19,0xb2,0xc6,0x59,0x81,0xc6,0x18,0xe4,0xcf,0x5b,0xc1,0x30,0x25,0x6f,
+  0x9a,0x84,0x5f,0x58,0xb9,0x7c,0x45,0x0f,0x31,0x0f,0x31,0x42,0x18,0x97,0x10,0xdc,0x62,0x2d,0x1a,0x9a,
+  0xad,0xf2,0xf7,0x97,0x18,0xe5,0x0c,0xef,0x0e,0x8c,0x62,0xde,0x43,0x00,0x11,0xa7,0xe3,0x6e,0x25,0x59,
+  0xc2,0xb7,0xd3,0x71,0x13,0x1e,0xba,0xb8,0x6c,0xe7,0x48,0xd7,0x5c,0x93,0xf9,0xa0,0x28,0xdc,0x5b,0x9a,
+  0x8e,0xc9,0xeb,0xc1,0x7c,0x05,0x2e,0xf2,0xc2,0x9e,0xc8,0xa1,0x87,0xf7,0xd2,0x10,0x36,0x36,0x68,0xd9,
+  0xc3,0x28,0xdf,0x02,0xfe,0x8e,0xb9,0xad,0xd0,0x06,0x8d,0x4b,0x7f,0x95,0xba,0xe3,0x0e,0x7c,0x0d,0x7b,
+  0xf0,0xc7,0xb4,0x38,0xcb,0x36,0xf1,0x83,0x00,0x13,0x73,0xa4,0x03,0xc3,0xfd,0xd9,0x04,0x89,0x96,0x41,
+  0xc9,0xff,0xac,0x6b,0x3b,0xc1,0x80,0xef,0x9d,0x30,0x07,0x76,0x9b,0x9a,0x2c,0x14,0xa0,0x19,0x2e,0x00,
+  0xa8,0xa6,0xf3,0x6d,0x38,0xdf,0x50,0x1e,0xf1,0x65,0xe8,0x8a,0x4c,0x2d,0x6c,0xc3,0xc4,0x74,0xd0,0x35,
+  0x09,0x4c,0x91,0xe1,0x71,0xd9,0xeb,0x64,0x5a,0x82,0x7e,0x7f,0x51,0x54,0x8f,0x80,0x7b,0xd8,0x1f,0x8f,
+  0x72,0x3c,0x1b,0xf4,0x31,0xfe,0x51,0x39,0xf7,0xc5,0xee,0x12,0xb3,0x02,0x3c,0x8e,0x53,0xce,0x1e,0xb1,
+  0xcc,0x61,0xa3,0xcf,0x9a,0x8b,0x8c,0xfc,0x73,0x33,0x3d,0x9a,0xd9,0xc9,0x1a,0x8f,0xc4,0xbd,0x35,0x77,
+  0x3c,0xce,0xd7,0x95,0x46,0x38,0x14,0x1c,0xcd,0x2f,0xf3,0x86,0x71,0x8b,0x9c,0xc1,0xbc,0x16,0x47,0xc4,
+  0xa5,0xa5,0xd7,0x69,0x1a,0x8b,0x65,0xb3,0x0f,0xcb,0x93,0x89,0x7e,0xe5,0x16,0x96,0xb4,0x15,0x4e,0x30,
+  0xf0,0x0b,0x7d,0xe8,0x6e,0x99,0x8b,0x83,0xd7,0xe6,0x18,0x09,0x5a,0x7c,0x1d,0x8b,0xe5,0x72,0x79,0xac,
+  0x53,0x1f,0x16,0xdc,0x62,0x9e,0xf4,0xd0,0xf2,0x09,0xfd,0x07,0xe7,0x13,0xe8,0xf8,0x41,0x1c,0x02,0x64,
+  0x38,0x37,0x2a,0x5e,0x83,0x00,0x5d,0x8e,0x5b,0xa5,0x68,0xa3,0x63,0xb5,0xb7,0x10,0x82,0xeb,0x06,0x56,
+  0xb2,0xab,0xc5,0x2e,0x29,0x3a,0x4a,0xc9,0x93,0xb1,0x33,0xbf,0x1c,0x29,0x15,0x59,0x58,0x62,0x4b,0x16,
+  0x49,0xfc,0x72,0x61,0xa6,0xc7,0x5d,0xb3,0xa9,0x00,0xd6,0xd7,0xd6,0xdc,0x51,0x8f,0x84,0x3b,0x85,0x53,
+  0xf4,0xce,0x57,0x94,0x87,0xb4,0x0c,0xa4,0xbd,0xdf,0x72,0xb2,0x2d,0xb8,0x98,0x03,0x59,0x6d,0x45,0x05,
+  0xea,0xda,0x2a,0xc0,0x48,0x9c,0xad,0xbb,0xf8,0x3b,0xeb,0xee,0x68,0xa1,0xa4,0xdd,0xc1,0x82,0x28,0x40,
+  0x45,0x2c,0x60,0xdc,0x8e,0x94,0xa8,0x83,0x84,0x6b,0x64,0x28,0xbd,0x8e,0x8d,0x21,0xd1,0x7f,0xd8,0xf6,
+  0x9a,0x27,0x8d,0x3d,0x8b,0x14,0x0f,0x1a,0x82,0xc0,0x64,0x92,0x47,0x20,0xce,0x54,0xaa,0x03,0xce,0xf3,
+  0x37,0x22,0xd9,0x0b,0x6a,0x27,0x15,0x90,0xa6,0xf7,0x74,0x37,0x00,0xfc,0x0f,0x4d,0xe7,0x16,0x92,0x75,
+  0xa0,0xf6,0xea,0x0d,0x4b,0x42,0x41,0xb9,0x33,0xd2,0x4c,0x08,0x0f,0x60,0xfd,0xa1,0xa5,0xb4,0x17,0x1c,
+  0xb2,0x12,0x83,0x94,0xd6,0xf7,0xf4,0x17,0xa5,0x8c,0xf7,0xf3,0xc4,0x7d,0x48,0xd1,0x72,0x02,0x99,0xe0,
+  0xf6,0x71,0xc0,0x0e,0x15,0xaf,0x41,0x8e,0x67,0x02,0xa0,0xcf,0xa6,0x7b,0xd5,0xb3,0x70,0xe6,0xe7,0xeb,
+  0x1d,0x82,0x95,0xff,0xf3,0x18,0xd2,0xbb,0x6b,0xde,0xb7,0x28,0xfe,0x14,0x7d,0xb5,0x4a,0x87,0x72,0x7f,
+  0x9e,0x80,0x76,0xf5,0x90,0xcf,0x99,0xb8,0x07,0x67,0x61,0x08,0xbc,0x84,0x4d,0x2e,0x7d,0x00,0x5f,0xf6,
+  0x0d,0xb2,0x05,0x84,0x22,0x16,0x79,0x38,0x71,0x3d,0x4e,0x6c,0x1e,0x2c,0x56,0x05,0x37,0xf3,0x04,0xf3,
+  0xcc,0x7b,0x22,0xe3,0xd7,0xd5,0xa5,0x56,0xaa,0x8f,0x30,0x76,0x47,0x8e,0x6d,0x91,0xe0,0xcf,0x81,0xc4,
+  0xf6,0x0c,0xad,0x02,0x35,0x63,0x90,0x20,0x6d,0x07,0xbf,0xd1,0xe7,0x96,0xbd,0x90,0x78,0xce,0x69,0x22,
+  0x7c,0xbe,0x43,0x9f,0x8b,0x9a,0x6d,0x48,0x30,0xc7,0x8e,0xb0,0x83,0x9f,0x8a,0xa6,0x6a,0x26,0x4c,0xf5,
+  0xdc,0x11,0x22,0x0e,0xd8,0x7f,0x5c,0x74,0xb2,0x2e,0xcd,0xd7,0x5f,0xc0,0x41,0x09,0xcc,0xfd,0x12,0x10,
+  0xa2,0xc0,0x04,0x1d,0x9d,0xf4,0x90,0xfe,0xe5,0xd8,0x8b,0x27,0x0d,0x20,0x68,0xb8,0xc8,0x57,0xa0,0xfa,
+  0x37,0x12,0x1a,0x9c,0xaf,0x5c,0x1c,0x68,0xb0,0x2b,0x0e,0xe2,0xd7,0xaa,0xc6,0x63,0xd7,0x1b,0xc7,0x16,
+  0x49,0xe4,0xb4,0xf6,0x96,0xd4,0xbd,0xcf,0x4c,0x6a,0xc9,0x2e,0xab,0xb5,0xdc,0xa9,0xa6,0x4a,0x38,0x06,
+  0xdd,0x53,0xb9,0x97,0xfc,0xa9,0x37,0x4c,0x03,0x08,0x99,0xc3,0x81,0xb7,0x7d,0x87,0x33,0x26,0xe4,0x5c,
+  0xa5,0x7d,0x4e,0x8d,0x80,0x47,0x74,0x89,0x49,0x24,0xac,0xf1,0x95,0x55,0x0a,0x08,0x4b,0xa2,0x31,0x65,
+  0x29,0xfe,0x84,0x4c,0x4d,0x11,0x60,0xf9,0x21,0x58,0x08,0x10,0xa6,0x63,0x36,0x22,0x6b,0x25,0x99,0x98,
+  0x68,0x3f,0x21,0x59,0x93,0x29,0xe1,0x4e,0x50,0x27,0xc8,0xd2,0xd5,0x7a,0x65,0x06,0x01,0xaf,0x3f,0x20,
+  0xb6,0x81,0xd6,0xef,0x99,0xf9,0xe0,0x04,0x4e,0xa7,0x79,0x06,0xeb,0x1d,0x2d,0xf0,0x26,0x7d,0x7e,0x90,
+  0xd8,0x14,0xfe,0xd4,0x97,0x24,0x36,0x05,0xe1,0xa5,0x14,0x30,0x2d,0x7b,0xb9,0xbc,0xc3,0x65,0x44,0x84,
+  0x10,0x14,0x85,0x06,0x82,0xa9,0x03,0x09,0x60,0xb0,0xd0,0x1d,0xd0,0x75,0x2d,0xc0,0x74,0x45,0x69,0x11,
+  0x89,0x40,0xff,0xa2,0x01,0x0b,0x8c,0x93,0xe5,0xc3,0x1d,0xda,0x09,0x88,0x17,0x96,0x40,0x76,0x80,0x24,
+  0x50,0x40,0x44,0x12,0xbf,0x70,0xea,0xe1,0x0b,0x9a,0x1b,0xb0,0x22,0x61,0xee,0x5f,0x96,0x92,0x61,0x5a,
+  0x5f,0xee,0xd0,0x3f,0xa1,0x95,0xfa,0x4f,0x14,0x85,0xa1,0xa3,0x68,0xc1,0xe9,0xdc,0x5c,0x92,0x61,0x59,
+  0x09,0x26,0x06,0xdb,0x35,0xd0,0x8b,0x6d,0x5a,0xb0,0x3c,0xb7,0x2e,0x28,0x6e,0xae,0x61,0x87,0x94,0x8c,
+  0x8f,0x51,0x25,0xc3,0xff,0xb9,0x7f,0x84,0xcb,0xff,0x4b,0x01,0x65,0x06,0x61,0x39,0x28,0x35,0x1c,0x9f,
+  0xab,0x3c,0x0a,0x2b,0xc0,0x4a,0xdf,0x3d,0x8a,0xe9,0xfb,0x1b,0xa7,0x9c,0xdb,0xdf,0x7b,0xde,0x44,0xea,
+  0x01,0x97,0x53,0xea,0x9f,0x47,0xa0,0xde,0x12,0x4f,0xbb,0x12,0x1c,0x88,0x4a,0xaf,0x84,0xa4,0x3f,0xc8,
+  0xdf,0x60,0xb4,0x77,0x1c,0x6e,0xc5,0x8e,0x9a,0x1d,0x99,0xc4,0x33,0x8b,0xe7,0x34,0x0a,0x5a,0xb7,0xa0,
+  0x5a,0x4d,0xb9,0x8a,0xe8,0x08,0xd8,0x5b,0xa6,0x9a,0x42,0x08,0xd8,0xeb,0xf4,0x11,0x00,0x5f,0x37,0xd3,
+  0x86,0xc7,0x0a,0x25,0xee,0x92,0xc0,0x5d,0x90,0x74,0xd2,0x54,0xd1,0x79,0xa4,0x22,0x85,0x8e,0xca,0xc2,
+  0x33,0xf7,0x89,0x9d,0xf6,0x68,0x18,0xf0,0x93,0x30,0x19,0x4f,0x02,0x20,0x97,0x0c,0x49,0xbf,0xe0,0xd8,
+  0x7c,0x1f,0x2b,0x17,0x17,0x2c,0x9d,0xc3,0xb9,0xaf,0xe9,0x7b,0x9b,0x1e,0x02,0xce,0x74,0xaf,0x90,0xe7,
+  0xa2,0x65,0x70,0x70,0x48,0x25,0x7c,0x24,0x4e,0x98,0x75,0xcd,0x41,0x79,0x67,0xa7,0xe6,0x07,0x59,0xc8,
+  0xdf,0xa3,0xce,0x6e,0xd3,0xf7,0x28,0xdd,0x99,0xfd,0x3e,0xd7,0xf8,0x03,0xd9,0xd0,0xe4,0xa5,0x2d,0x5a,
+  0x80,0x61,0x34,0x1f,0x43,0xbe,0x80,0x86,0x9e,0xc8,0x4e,0x6a,0x0b,0xeb,0x0e,0xbc,0x67,0x89,0x97,0xf8,
+  0x52,0x82,0x1a,0x1e,0x86,0x40,0x9c,0x05,0x24,0x16,0x85,0x7b,0xf0,0x91,0xf9,0x3b,0xb4,0x34,0x34,0x05,
+  0x45,0x71,0x41,0x09,0xb7,0xa4,0xfb,0xa4,0x0e,0x60,0x89,0x7f,0x0c,0xe1,0x01,0x43,0x78,0x87,0x4b,0x96,
+  0x16,0x6b,0x18,0xc4,0x10,0x38,0x4b,0x18,0x7b,0x1a,0x33,0x7c,0x13,0x42,0x64,0x1b,0xf8,0x31,0x54,0xc4,
+  0x2d,0x80,0xfd,0x06,0x2c,0x5e,0x90,0x79,0xac,0xba,0xa0,0x29,0xd1,0x14,0xd0,0xde,0xb5,0xcf,0x80,0x1b,
+  0x18,0x63,0xd5,0x83,0x8d,0xb1,0xbd,0xb6,0xbf,0x8c,0x1b,0x3e,0xfd,0xaa,0xce,0x4d,0xfd,0x9b,0xdf,0xc9,
+  0xd9,0x4e,0x01,0x38,0xb4,0x9e,0xa2,0x1b,0x05,0x7c,0x4f,0x30,0x0f,0x78,0xf6,0xa1,0x27,0x87,0xd4,0xdf,
+  0x75,0x52,0x15,0x74,0xb8,0x03,0x93,0x13,0x05,0xab,0xe2,0xd6,0x5c,0x9d,0x98,0xad,0xf3,0x78,0x5a,0x3b,
+  0xc9,0x5a,0x91,0xb9,0x2d,0x6c,0xc3,0xc0,0xbb,0x7b,0x1e,0xcc,0x48,0xe8,0xc9,0x83,0xf2,0x15,0xf9,0x88,
+  0xe3,0xc2,0x11,0x46,0xc7,0x43,0xfd,0x7b,0x54,0x3f,0x41,0x2c,0xb0,0x7f,0x72,0x8c,0x17,0xae,0xa8,0x80,
+  0xcb,0x8f,0xd1,0x72,0xf8,0x4d,0x96,0xfa,0x1f,0x44,0xd2,0x8d,0x1c,0x00,0x47,0x0c,0x31,0x88,0x9e,0x3b,
+  0xc2,0x39,0x76,0x27,0xc4,0xf5,0x50,0xa6,0xbb,0x69,0x00,0xee,0x31,0x84,0x77,0x7a,0x42,0x4f,0xf8,0xef,
+  0xf7,0x28,0x29,0xf6,0x1a,0x39,0x36,0x14,0x8f,0x40,0x1a,0xf9,0xb3,0x02,0xef,0x02,0x97,0x04,0x66,0x14,
+  0x88,0x4d,0xbd,0x79,0xb5,0xb1,0x79,0xf0,0x68,0x8b,0x70,0x0f,0x84,0xed,0x3a,0x6e,0x1b,0x71,0x87,0xa4,
+  0x7d,0x2e,0x21,0x46,0x63,0xd2,0xd0,0x93,0x04,0xca,0xeb,0x0d,0xd4,0x9c,0x66,0x47,0x24,0x67,0x48,0x59,
+  0x40,0x0e,0xa0,0xcc,0x23,0xa4,0x13,0xeb,0x62,0xb0,0x9f,0xc2,0x60,0x87,0x17,0x2b,0xd0,0x66,0x07,0xb4,
+  0x02,0x22,0xa2,0x39,0xb1,0x32,0x32,0x78,0x47,0xb0,0xe0,0xc8,0xfa,0x12,0x64,0x53,0xd8,0x61,0xde,0xdc,
+  0x84,0x9e,0x7e,0x7b,0x0b,0xdd,0x61,0x2f,0xf4,0x34,0xec,0xbd,0x81,0x28,0x34,0x38,0xa2,0xe0,0xb0,0xf7,
+  0xc7,0xe8,0x07,0x11,0x7c,0x80,0x7a,0x78,0xa8,0x20,0x32,0xd7,0x38,0x8d,0xb5,0x09,0xd8,0x7e,0xba,0xf8,
+  0xf1,0xd2,0xb6,0x39,0x99,0xee,0xfe,0x0a,0xb2,0x80,0xf7,0xb6,0xc1,0xab,0xd0,0xd0,0x77,0xe2,0x11,0x3e,
+  0x81,0xa5,0x57,0x11,0xa0,0x86,0x9c,0xa8,0xda,0x55,0x29,0x00,0x87,0x74,0x01,0x3d,0x60,0xcf,0x15,0xc9,
+  0x02,0x09,0x16,0x2c,0xdb,0x50,0xd1,0x92,0x03,0xf2,0x7c,0xf3,0xd6,0xe8,0x31,0x45,0x3c,0xd4,0x03,0xab,
+  0xea,0x84,0x3e,0xd0,0x81,0xaa,0xf4,0xa3,0xa5,0xed,0x51,0xc5,0xd7,0xf9,0x21,0xe7,0x88,0x2a,0xd0,0x46,
+  0x03,0x06,0x2e,0x6c,0x68,0x25,0x2d,0x51,0x98,0xf8,0x1c,0x04,0xeb,0xc7,0xc7,0xcf,0xde,0x68,0x9f,0x6f,
+  0x90,0x5f,0x81,0x1e,0xd1,0xe7,0xcf,0xb8,0xdb,0x5c,0xb6,0x8d,0x0b,0xbd,0xce,0x1a,0xfb,0x60,0xdc,0x43,
+  0x26,0xec,0x44,0x87,0x28,0x71,0xa8,0x52,0x70,0x50,0x71,0x18,0x56,0x27,0x53,0x21,0xde,0x19,0x2f,0x98,
+  0x12,0x95,0x21,0x97,0x7d,0x58,0x86,0xf0,0xd9,0x19,0xaa,0xbd,0xde,0xa1,0x75,0xed,0x35,0xbc,0xbe,0xb9,
+  0x43,0xe0,0x80,0xb5,0xe1,0x51,0xb9,0x89,0x20,0x21,0x22,0x46,0x50,0x22,0x92,0x4c,0x29,0x41,0x72,0x3a,
+  0xf2,0x13,0x94,0x1b,0x3c,0xae,0xab,0xe6,0x5c,0xe9,0xf1,0xbc,0x7d,0x17,0x53,0xca,0xa7,0x2b,0x2a,0x06,
+  0x73,0x18,0xab,0x16,0x5f,0xef,0x7d,0x0a,0x03,0x26,0xe0,0x92,0xa2,0x5f,0x65,0xeb,0x1b,0x91,0x85,0x5f,
+  0x45,0xeb,0x1b,0x5d,0x01,0xb8,0x25,0xe1,0x01,0xac,0x00,0xe8,0x79,0xb6,0x06,0xa2,0x58,0x34,0xde,0x16,
+  0xc2,0x7f,0x41,0x78,0xb0,0x98,0x87,0x9e,0x18,0xf8,0x0b,0xd6,0xe5,0x55,0x78,0x4b,0x6e,0x48,0xd3,0xeb,
+  0x22,0x43,0xab,0xaf,0x4b,0x8b,0x37,0xc6,0x9f,0x93,0x16,0x1f,0xcc,0x45,0x69,0xf1,0xaa,0x3d,0x9e,0x94,
+  0x31,0x99,0x09,0x75,0x29,0x0c,0x6d,0x79,0x2c,0x3a,0x18,0x6f,0x72,0x96,0xf9,0xae,0xd4,0xc4,0xd7,0xef,
+  0x88,0x0c,0x1e,0xfc,0x9a,0xb8,0x7c,0x48,0x40,0x7c,0x64,0xfe,0x82,0xa2,0xa2,0xdb,0x50,0x19,0x7a,0xea,
+  0xe1,0x2f,0x34,0xc6,0x3e,0x21,0x0a,0xff,0x72,0xf3,0x96,0xc4,0xd0,0x1e,0xd7,0x45,0xc6,0xa9,0xbf,0x2e,
+  0x33,0x27,0x63,0xfd,0x39,0xc9,0x39,0x05,0x76,0x51,0x7e,0x4e,0x1a,0x79,0x8c,0x13,0x4e,0xa4,0x08,0xc7,
+  0x74,0xf8,0x17,0x99,0x02,0xf5,0x90,0x91,0x2e,0x18,0x38,0xe4,0x47,0xe1,0xd8,0x3d,0x44,0x4c,0x37,0x91,
+  0x4f,0xaa,0x66,0x81,0x03,0x41,0x42,0x4a,0x20,0x2c,0xe1,0x37,0x98,0x01,0x6e,0x67,0x69,0x1a,0x34,0xe7,
+  0x54,0x51,0xc6,0x7c,0x24,0x70,0x2c,0x43,0xa2,0xbf,0x45,0xd7,0xb9,0x7b,0x47,0xd6,0x08,0xa2,0x04,0xcf,
+  0x7f,0x45,0xe2,0x02,0x68,0xff,0x05,0x25,0x6d,0x2e,0x59,0xe0,0x90,0x40,0xc4,0x0d,0xf1,0x13,0x8e,0x24,
+  0x50,0x38,0x0e,0x14,0x7d,0x53,0xd4,0x48,0x97,0xeb,0x92,0x46,0xab,0xaf,0x0b,0xda,0xd9,0x58,0x7f,0x4e,
+  0xd4,0xce,0xc1,0x5d,0x14,0xb6,0xb3,0x66,0x27,0xe2,0x76,0xac,0xa7,0x36,0x36,0x07,0x4c,0xc4,0xfe,0x29,
+  0x32,0xfc,0x8e,0x30,0x33,0x68,0xa2,0x63,0x71,0xa5,0x20,0xde,0x16,0x9b,0x82,0x64,0x95,0x70,0xeb,0xb7,
+  0x85,0x66,0x71,0x51,0x68,0x2e,0x8d,0xfa,0xef,0x11,0x1e,0xc2,0x52,0x6f,0x0f,0xdf,0x8f,0x4d,0x02,0x72,
+  0x75,0x2c,0x31,0x64,0x93,0x1e,0xec,0x18,0xa5,0x11,0x76,0xd4,0xcf,0x85,0x25,0xe0,0x23,0xd2,0xe6,0xc7,
+  0xba,0x9b,0x74,0x0d,0x90,0xe5,0x84,0x24,0x0c,0xf8,0x71,0x0b,0x0b,0xd1,0x66,0xd1,0x01,0x3c,0xd3,0xf5,
+  0x8a,0xc7,0x02,0x3f,0xf1,0x57,0x5a,0x51,0xc7,0x14,0x30,0xa1,0x12,0x88,0xf4,0xcd,0x9b,0x30,0xf6,0x0e,
+  0x7f,0x2d,0x2b,0xba,0x75,0x60,0x14,0x4e,0x96,0x69,0xd3,0x6f,0x01,0xaf,0x2f,0x1a,0x5c,0x30,0x6f,0x4e,
+  0x12,0x88,0xc1,0xe0,0xdd,0xa5,0x0f,0x4d,0xd1,0x3c,0x99,0x22,0x74,0x7c,0x7f,0x82,0x2e,0x74,0x3c,0xa9,
+  0x9f,0x1f,0xb2,0x99,0xec,0xb7,0x73,0xc6,0x7d,0x18,0x5d,0x2b,0xf4,0xc4,0xba,0x9a,0xed,0x43,0x28,0x5b,
+  0xc7,0x28,0xbb,0x9d,0xdf,0x45,0xdb,0x6d,0x18,0x65,0x5c,0xf5,0xba,0x73,0xe6,0x30,0x97,0x44,0x57,0xb9,
+  0xda,0xfa,0x31,0x4f,0xd0,0xaf,0x36,0x54,0x7d,0x43,0x17,0x39,0x71,0x49,0x24,0x9d,0xfd,0x62,0x6f,0xf0,
+  0x96,0xc6,0xf1,0x30,0x22,0xac,0x48,0xa7,0x26,0x02,0xda,0xb4,0x68,0x19,0xf2,0x2d,0x55,0xbb,0x78,0xf1,
+  0xe0,0x5a,0x0e,0xa9,0xc2,0xce,0x69,0x73,0x1e,0x72,0x42,0xa1,0x25,0xa9,0xa2,0x19,0xb9,0x39,0x92,0xf4,
+  0xc0,0x88,0xff,0x8c,0x7b,0x43,0x06,0xe8,0x83,0xb7,0x27,0x7a,0xa4,0x3e,0x1c,0xf7,0xe9,0x73,0xb4,0x2b,
+  0x1d,0x7a,0x8a,0x9f,0x71,0x2b,0x08,0x37,0xf1,0x0e,0xdc,0xc4,0x55,0xb8,0x89,0x37,0xe1,0x26,0xdf,0x81,
+  0x9b,0xbc,0x0a,0x37,0xf9,0x26,0xdc,0xd4,0x3b,0x70,0x53,0x57,0xe1,0xa6,0xde,0x84,0x9b,0x7e,0x07,0x6e,
+  0xfa,0x2a,0xdc,0xf4,0x9b,0x70,0x33,0xef,0xc0,0xcd,0x5c,0x85,0x9b,0x79,0x13,0x6e,0xf6,0x1d,0xb8,0xd9,
+  0xab,0x70,0xb3,0x6f,0xc2,0x7d,0x78,0x07,0xee,0xc3,0x55,0xb8,0x0f,0x6f,0xc2,0xcd,0xbd,0x03,0x37,0x77,
+  0x15,0x6e,0xee,0xd2,0x92,0xf4,0x1f,0xdc,0x71,0x9c,0xad,0xd7,0x40,0x8c,0x88,0x4d,0x07,0x47,0x8c,0x15,
+  0xa7,0xeb,0x02,0x67,0x98,0xc4,0x9e,0x45,0x3e,0x39,0x2b,0x13,0xd6,0xdf,0xe7,0xdf,0x3e,0x3b,0x49,0x58,
+  0x78,0xa1,0x62,0x4f,0xe2,0x68,0x55,0xd2,0xcd,0x36,0x77,0x71,0xd2,0xde,0x78,0xeb,0xc7,0x1d,0x5a,0x52,
+  0x44,0xbc,0x87,0x81,0x5d,0x9a,0x39,0x68,0x1c,0xe4,0x2a,0x26,0x32,0x6d,0xbc,0x83,0x1c,0x98,0x2a,0x6d,
+  0x52,0x22,0xf9,0x9d,0x81,0xfd,0x92,0x01,0xed,0x49,0xec,0x3c,0xdd,0xe2,0xa3,0x29,0xa0,0x91,0xd0,0x11,
+  0x64,0x9c,0x93,0x19,0x42,0xa6,0xb1,0xf8,0xc3,0x09,0x96,0x45,0x92,0x60,0x29,0x16,0xf3,0x6d,0x9c,0xa4,
+  0x57,0xd6,0xeb,0x46,0x15,0x17,0x14,0x27,0x85,0xfa,0x78,0x82,0xcb,0xb2,0x65,0xf8,0xd3,0xdd,0xe7,0xab,
+  0xa3,0xe6,0x2e,0x35,0x27,0xa9,0x7c,0xc9,0x41,0x83,0x1d,0x0e,0x6b,0xe9,0x5d,0x79,0x58,0xe8,0x9b,0xf9,
+  0x5d,0xab,0xf2,0xba,0xc3,0xb0,0x98,0x5c,0x9f,0xad,0x0c,0x2a,0xb8,0x8d,0xda,0xca,0xf0,0x2f,0x53,0xbb,
+  0x93,0xb0,0x54,0xce,0x6a,0x8d,0x63,0xe3,0xe6,0x6a,0xbe,0x98,0xc9,0x07,0x08,0x64,0xf2,0xab,0xb4,0x52,
+  0x9b,0x64,0x0b,0xd2,0xb4,0x55,0x81,0x4f,0xe3,0xa5,0x9f,0xee,0x54,0x57,0x8d,0x44,0x65,0x98,0xe9,0x8c,
+  0xc6,0x5a,0x6e,0xb1,0x9a,0x0b,0xd5,0xa5,0xa1,0xe4,0x67,0x0d,0x4b,0xc1,0xed,0x96,0xc6,0x2a,0xca,0x72,
+  0xab,0x01,0x9b,0x91,0xd9,0x55,0xf6,0x50,0x97,0x5a,0x87,0x06,0x93,0x89,0xf7,0xd8,0x66,0xbc,0xbf,0x6c,
+  0xcd,0x6e,0x99,0x4c,0xba,0x37,0x9b,0x37,0xb4,0x19,0xb7,0x52,0x71,0x3d,0x9b,0x99,0x31,0xc3,0x66,0x6e,
+  0xc8,0x72,0x9d,0x3e,0xbb,0xe1,0x07,0x73,0x63,0xb0,0x1f,0x72,0xf1,0xd1,0x4b,0x2b,0xd1,0x65,0xb9,0x51,
+  0x7f,0x6d,0xdc,0xb2,0xf0,0x19,0xae,0xb3,0xf0,0x79,0x28,0x0e,0x47,0xdc,0x6a,0x3a,0x36,0x0a,0xfc,0x70,
+  0x93,0x1b,0x0f,0x37,0xfa,0x88,0xcd,0xc4,0xd9,0x51,0x86,0xe7,0xc6,0x99,0x9c,0x80,0x7f,0x4f,0xb2,0x15,
+  0x69,0x66,0x34,0xb4,0xe1,0x26,0x3d,0x62,0x39,0x7d,0xc0,0x6e,0x74,0x86,0x6d,0xe6,0xfa,0xb3,0x56,0x47,
+  0xe5,0xe6,0x0d,0x63,0xd4,0x94,0x27,0xa4,0x0c,0xea,0x98,0x8d,0xde,0x65,0x36,0x7c,0x77,0x92,0x49,0xaf,
+  0xc6,0xf3,0x0a,0x3f,0x6e,0x55,0xe6,0xc3,0x4c,0x7c,0x32,0xdc,0xec,0x47,0xa3,0x4c,0x9c,0x1b,0x37,0x79,
+  0xfc,0x99,0x8f,0x37,0x39,0x1e,0xe3,0x3d,0x36,0x1a,0xfc,0x28,0x5b,0xe1,0xd8,0x4d,0x9c,0xc1,0x6d,0x31,
+  0x5c,0x96,0xcb,0x0d,0x58,0x2e,0x3e,0x60,0x9b,0xe9,0xfe,0xa8,0x99,0x9e,0xe0,0x71,0x87,0xf3,0xc2,0x68,
+  0x9a,0x2d,0x28,0xb3,0x56,0x43,0x05,0x9a,0xac,0x86,0xcd,0xf4,0x70,0xd4,0x8c,0x4f,0x30,0x0d,0xa0,0xef,
+  0x60,0x68,0x14,0x46,0x14,0xa7,0x86,0x4a,0x60,0xc0,0x1c,0x28,0x2c,0x80,0x03,0xf0,0x46,0x0f,0x4a,0xf4,
+  0x16,0x33,0xa6,0xda,0x88,0x0d,0xd7,0x69,0x36,0x9f,0x2f,0x57,0x0a,0xa2,0xd8,0x2c,0x8a,0x5a,0xb3,0xb8,
+  0x33,0x5b,0x95,0x42,0x7f,0x5c,0xdd,0xc7,0x84,0xda,0xa1,0xae,0x36,0x25,0x6d,0xd3,0x7c,0xc9,0xef,0xda,
+  0xec,0x2e,0x37,0x1c,0x01,0xab,0xe3,0xfc,0x64,0x2c,0xef,0x17,0x33,0x85,0x57,0x67,0x09,0x7e,0x33,0xaf,
+  0x75,0x92,0xcb,0xc9,0x6d,0x69,0xa5,0x71,0x9d,0x17,0xbd,0x38,0x50,0x66,0xf0,0x5f,0x3a,0x23,0xe9,0xcd,
+  0x8d,0x61,0xb4,0xc6,0x29,0x3b,0x6b,0x3f,0x6c,0x5b,0xd1,0xc2,0x7e,0x31,0x6f,0x1c,0x1e,0x5e,0x3b,0x71,
+  0xcb,0x58,0xa6,0x6e,0xe7,0x6a,0x36,0x5a,0x8a,0xe5,0x7a,0x93,0xd4,0x6d,0xf4,0xf5,0x21,0xba,0xcd,0xc0,
+  0x90,0xb7,0x38,0x03,0xb7,0x30,0x8b,0x91,0x84,0xda,0x69,0x75,0x36,0x29,0xac,0xe2,0x53,0x76,0xd8,0x2f,
+  0x54,0x62,0x43,0x6b,0x2b,0xbe,0x30,0xfb,0x58,0x63,0x78,0x98,0x55,0x0a,0xf9,0x4a,0x7b,0x54,0xcc,0x1e,
+  0x12,0x65,0x5d,0xed,0xa7,0x6e,0x7b,0xd1,0x65,0xaa,0x96,0x60,0xab,0xa5,0xf6,0x60,0x52,0xb7,0x73,0xb9,
+  0xa1,0xb4,0x65,0x63,0x59,0x21,0x53,0xca,0x71,0xad,0xdb,0xea,0x61,0xd4,0x8f,0x1a,0xfb,0xa8,0x11,0x37,
+  0xf3,0x52,0x8b,0x6f,0xe6,0x26,0xbd,0xc1,0x88,0x59,0x95,0x47,0xcc,0x60,0x91,0x6b,0xe9,0xec,0xd0,0xdc,
+  0x55,0x32,0xfc,0xde,0xc8,0xef,0xe3,0x42,0xb2,0xd0,0xd7,0x3a,0xcd,0x4e,0x35,0xbd,0x12,0x53,0x9b,0xfd,
+  0xb8,0xde,0x9b,0x8e,0x36,0xbd,0xdb,0xb1,0xd4,0x9e,0x0e,0xf3,0xf3,0x16,0x57,0x2f,0x88,0x20,0xe7,0x6c,
+  0xa1,0x61,0x31,0x2f,0xed,0x09,0xd3,0x30,0xab,0xe5,0xa2,0x6c,0x74,0x4d,0x5e,0xde,0x34,0x17,0x75,0x69,
+  0x33,0xd1,0xc6,0xdd,0x44,0x6e,0x90,0x54,0x78,0x73,0x30,0x9b,0x17,0xda,0x46,0x7d,0x94,0x6d,0xb4,0x99,
+  0xd1,0x78,0x99,0xcf,0x0c,0x3a,0xb3,0x55,0x79,0x7c,0xd0,0x33,0xcb,0xfc,0x78,0x36,0x2e,0xf6,0x94,0x7d,
+  0xb5,0x3f,0x7d,0xad,0x14,0x15,0x6e,0xd7,0x13,0x87,0x4b,0x73,0x9c,0xaa,0xd4,0x73,0x52,0x5d,0x54,0xb2,
+  0xa6,0x98,0xaa,0xcb,0xa9,0xca,0xa6,0xc1,0x6e,0xf6,0xac,0x34,0xb6,0x44,0x66,0x51,0x4e,0xac,0x2b,0x13,
+  0x21,0xde,0x99,0x8c,0xe4,0x5e,0xf3,0xb0,0x6b,0x71,0xc5,0x1a,0x53,0x34,0x44,0x53,0x6f,0x56,0xc6,0x4c,
+  0xa1,0xd6,0x9f,0xb4,0x76,0xf9,0x68,0x2e,0x75,0x10,0x76,0x46,0x37,0xdf,0x8a,0x6f,0xa6,0x87,0x39,0xbf,
+  0x9a,0x14,0x86,0xbd,0xe9,0x38,0x3d,0x4a,0xaf,0x76,0x31,0x9d,0x6b,0xa5,0xf2,0x2f,0xf6,0x66,0x34,0x54,
+  0x1f,0xca,0x93,0x52,0xdf,0x68,0x4f,0xf9,0x4e,0x33,0x31,0xe4,0x94,0x78,0x4f,0x30,0x5f,0xb7,0x62,0x3c,
+  0xb3,0x6a,0xbe,0x54,0x1b,0xc9,0x09,0x63,0xa4,0x5e,0xac,0x78,0x7b,0x63,0xbf,0xe4,0x4a,0xcb,0x59,0x67,
+  0x99,0xeb,0x2f,0xca,0x36,0x53,0xe5,0x12,0xe3,0xf8,0xee,0x55,0x29,0xee,0xf6,0xda,0x88,0x1f,0x1c,0x58,
+  0xbb,0x93,0xe4,0xc7,0x9d,0xdb,0x5c,0x63,0x52,0x5b,0x68,0x83,0x56,0xaf,0x74,0x58,0xbd,0x3e,0x94,0xeb,
+  0x3a,0x3b,0xb5,0xd7,0xad,0x12,0xa7,0x4f,0xba,0x0f,0x9b,0x01,0x67,0xe7,0xec,0x75,0x34,0x7b,0xdb,0xdb,
+  0xdf,0xb6,0x8c,0x45,0xb4,0x97,0xcb,0xd8,0x83,0xa8,0xd8,0xa9,0x5a,0xcd,0xea,0x9c,0x9d,0x8f,0xf5,0x65,
+  0x99,0x28,0x1b,0x66,0x38,0xea,0x0e,0x9a,0xe9,0xe2,0xb4,0x5e,0x77,0x12,0x81,0xb1,0xa7,0xc5,0x62,0xcd,
+  0xaa,0xf1,0x6e,0xe0,0x8c,0x0f,0x59,0xe9,0xd1,0x1d,0x3e,0x57,0xc1,0xa7,0x2f,0xd8,0x2b,0x82,0x58,0x98,
+  0x1e,0x71,0x78,0x27,0x1c,0x11,0x49,0xd5,0xd0,0xd3,0x13,0xc2,0x47,0xbe,0x0c,0xe9,0xd0,0x83,0xf6,0xe1,
+  0x9b,0x4f,0x28,0x8f,0x4c,0xec,0x4b,0xa3,0xc5,0x4a,0x92,0x79,0x00,0x6d,0xc3,0x5f,0xb2,0xa3,0x4c,0xa1,
+  0x6f,0x6c,0xd0,0xbb,0xf7,0x01,0xed,0x8e,0xf3,0x1b,0x21,0x1a,0x31,0x2d,0x7c,0xb0,0x08,0x05,0x51,0x7d,
+  0xa7,0xe0,0x1d,0x9e,0x28,0x0e,0x0d,0x5d,0x77,0x94,0xe6,0xb6,0x92,0xb8,0xe7,0xf1,0xf1,0xf1,0x09,0x8d,
+  0x5c,0x37,0xd5,0x49,0x8e,0xe7,0xe8,0x46,0x18,0x41,0xc4,0x4d,0x79,0x8f,0xba,0x3f,0x1d,0x9d,0x9e,0x77,
+  0x67,0x66,0xed,0x34,0x17,0x01,0x7f,0x83,0xc7,0x3f,0x82,0x8a,0x7c,0x2a,0x08,0xc8,0xb4,0x69,0x88,0x45,
+  0xce,0x83,0x49,0xa0,0x45,0x6c,0x01,0xd8,0xc0,0xa5,0x60,0x1c,0xed,0x4e,0x61,0xd3,0xe3,0x59,0x1c,0x92,
+  0xa4,0x8f,0x9d,0x4b,0x3a,0x52,0xc2,0x1d,0x87,0xe4,0x70,0x2e,0xb9,0x85,0xf0,0x6f,0xb2,0x16,0x85,0x14,
+  0xfe,0x2d,0xe4,0x6b,0x9b,0x07,0xc5,0x48,0x10,0x85,0x33,0x19,0x54,0xc6,0xb5,0x01,0x3b,0x4f,0xcc,0x62,
+  0x7c,0xa2,0x72,0x98,0xf5,0x0b,0x49,0x3e,0xb9,0xb0,0xb9,0x71,0xda,0x58,0x24,0x3a,0xab,0x45,0x75,0x68,
+  0xcf,0x93,0x0d,0x55,0xb9,0x4d,0x3d,0x54,0x89,0x15,0x99,0x79,0x56,0x24,0xdf,0x7b,0xc8,0x8b,0xf5,0x62,
+  0x7e,0xc4,0xe9,0xa3,0x7e,0x2b,0x97,0x6f,0xa7,0x65,0x85,0x3c,0x37,0x72,0x22,0xfe,0x66,0xe7,0x9d,0xce,
+  0xc0,0x90,0xab,0xe4,0xd9,0xa8,0x74,0x99,0xf9,0xac,0x01,0x9a,0xbf,0x3f,0xc8,0xe8,0xa3,0x21,0x97,0x1e,
+  0xe0,0x7a,0x86,0xa3,0xcf,0xa0,0x99,0x47,0x83,0x4c,0x9c,0xc1,0xed,0xd8,0x56,0xa7,0xcd,0x70,0xf0,0x9c,
+  0x2d,0xf4,0x18,0xd0,0xbc,0x0c,0x07,0x9a,0x12,0x97,0x37,0xf7,0x2c,0xb3,0x81,0x7e,0xdc,0x1e,0xb4,0x27,
+  0x7c,0x43,0x1d,0xd6,0xa2,0x4c,0x16,0xea,0x70,0x9b,0x56,0xa1,0x47,0xbe,0x9d,0x67,0xd0,0xe0,0xd0,0x16,
+  0x3e,0x58,0xd3,0xe2,0xf6,0x73,0xa8,0x6f,0xd2,0xdf,0x4c,0x16,0xb7,0x75,0xeb,0x9c,0xdf,0x44,0x23,0x43,
+  0x59,0xcb,0x7d,0xa6,0x75,0x6e,0x1f,0xe8,0x4f,0x9f,0xb9,0x40,0xd9,0x85,0x0f,0x85,0x7d,0xd2,0xf7,0x8f,
+  0x7c,0xb8,0x0b,0x65,0x67,0x38,0xd1,0x4f,0xc3,0xd2,0x97,0x5b,0xc2,0xc8,0x8a,0x6b,0x39,0x8a,0xf9,0x5d,
+  0x1f,0x5b,0x8f,0x46,0x51,0x34,0xdb,0xa5,0x7e,0xaa,0x5f,0x5e,0xb5,0x87,0x95,0xc1,0x74,0x5a,0x1d,0x68,
+  0xf3,0x5a,0x21,0xb6,0xac,0x1f,0xfa,0x72,0x43,0x12,0xb7,0xdd,0x58,0xa1,0xc0,0x8c,0x2a,0xec,0x48,0xa9,
+  0x48,0x73,0x25,0x77,0xe0,0x6b,0xa3,0x04,0x9f,0x5c,0x3d,0x2c,0x53,0xd5,0xaa,0x54,0xdf,0x74,0xd6,0x7a,
+  0x62,0xb5,0xc1,0x56,0x63,0x5e,0x8d,0xdb,0x2d,0x3b,0xb7,0x7d,0xe8,0x95,0x0f,0xed,0xd7,0x41,0xdc,0x7a,
+  0x99,0x25,0x85,0xda,0x4b,0xa6,0xab,0x6e,0x32,0xb7,0x49,0x28,0x6e,0xbd,0xe6,0x7a,0xf3,0xe4,0x6d,0xcf,
+  0xc8,0x46,0xe7,0xf9,0x78,0xa5,0x8e,0xe5,0xb2,0xf4,0xca,0x0c,0x07,0x85,0x51,0xe9,0xa5,0xf5,0xc2,0x77,
+  0xd4,0x76,0xac,0x53,0xa8,0xd4,0x97,0xfb,0x46,0x7c,0x67,0xc7,0x98,0x46,0x33,0xd7,0xc9,0x1a,0x95,0x79,
+  0xc2,0xac,0x48,0x83,0xc2,0xa0,0x91,0xd7,0xfa,0xcb,0x43,0x34,0x9a,0x5e,0xee,0x14,0x53,0x9e,0xa9,0xc6,
+  0x52,0xed,0x24,0x3b,0x09,0x3e,0x31,0x5f,0x65,0x33,0x5c,0xb7,0x1d,0x9b,0xd9,0xe5,0x4d,0x49,0x66,0xc7,
+  0xdc,0xa8,0xa1,0x14,0xfa,0xaa,0xa1,0x47,0xc5,0x6c,0xe3,0x75,0xc4,0xe4,0xa6,0x2b,0x39,0xb6,0x6c,0xd6,
+  0xe7,0x8d,0xb8,0xc9,0xbc,0x16,0x0e,0x87,0x5d,0x2d,0x5d,0x4d,0xf4,0x99,0xf2,0xf4,0x76,0xb3,0x8a,0xed,
+  0x87,0xa6,0xa2,0x74,0x3b,0xfd,0x84,0x32,0x6f,0xe4,0xb7,0xea,0x54,0x28,0x27,0x36,0xba,0x6e,0x6c,0x4b,
+  0xb5,0x3c,0x33,0x19,0xaa,0xcc,0x78,0xc6,0xec,0x8d,0xb8,0xba,0xd5,0xfa,0xb3,0x87,0x7a,0xbe,0x5c,0x1e,
+  0x4c,0x2c,0x41,0xca,0x57,0xd7,0x71,0x55,0x68,0x8f,0x54,0xb3,0x50,0x2d,0xa7,0xe7,0xd3,0x66,0xbb,0x57,
+  0xaf,0x1d,0x76,0xa3,0xdc,0x2e,0xff,0xd2,0x13,0xbb,0xd5,0x3e,0x5f,0x5d,0x72,0x25,0xab,0xf0,0x2a,0x35,
+  0x17,0x7a,0x23,0x56,0x95,0x63,0x5c,0xbd,0xbd,0x2d,0xcb,0xe0,0x03,0x95,0x73,0xa9,0x79,0xbf,0xd4,0x4e,
+  0x71,0xb3,0x76,0x9c,0x4b,0x8d,0xed,0xea,0xc3,0x6c,0xc3,0xee,0x93,0xd6,0xcb,0x61,0xde,0xef,0xe5,0x17,
+  0xc6,0xbc,0xbd,0xae,0x5a,0xb1,0x4a,0x54,0xa9,0xbd,0xee,0xf3,0xc5,0x64,0x51,0x55,0x0f,0x62,0xba,0x73,
+  0xc8,0x56,0x72,0x83,0xec,0xa6,0x9d,0xee,0x09,0xf1,0xb4,0x5d,0x68,0x48,0xb9,0x43,0xc1,0xe6,0xd9,0x68,
+  0xf4,0x25,0x9b,0x7c,0x28,0xd9,0x4c,0x8c,0x5f,0x98,0x83,0x43,0x9b,0x2c,0xf5,0x73,0xed,0xfc,0x3d,0xca,
+  0x05,0x34,0xdb,0xf1,0x89,0xbe,0xa7,0xe1,0x9c,0xb2,0x80,0x8a,0xd3,0x0d,0x4d,0x07,0x55,0xbb,0x70,0xf3,
+  0x99,0x40,0xff,0x80,0x06,0x37,0x20,0x16,0x37,0x4d,0x08,0x81,0xe9,0xc6,0x27,0xce,0xa9,0xc1,0x27,0x5d,
+  0x64,0xef,0x73,0xe1,0xb9,0xdd,0x0a,0x87,0xf7,0x3c,0x31,0xa4,0xb3,0x53,0xf0,0xb9,0x2d,0xc9,0xd6,0x3d,
+  0x54,0x03,0x22,0x2e,0xf0,0x9b,0xa0,0xe2,0x73,0xca,0xfe,0xbf,0x7b,0xc4,0x85,0xb9,0x22,0x97,0xfa,0xf1,
+  0x82,0x3e,0x4d,0x40,0x79,0x51,0x1a,0xf0,0xb3,0x6a,0x8e,0x89,0x35,0x56,0x95,0xfa,0x62,0x09,0xfe,0x41,
+  0x73,0xd1,0x14,0x57,0x4d,0xb3,0x55,0xd0,0xd6,0xe5,0x55,0x71,0xd3,0x4c,0x98,0x66,0xa5,0xd2,0x37,0x77,
+  0xe2,0x26,0x36,0xde,0x4e,0x52,0xe5,0xa5,0x9c,0xb4,0x47,0xeb,0x0e,0x27,0xea,0xc3,0x8a,0x26,0x55,0x8c,
+  0x4c,0x75,0xab,0x81,0xa5,0x8a,0x73,0xc5,0x54,0x53,0x2c,0x16,0x5b,0x5c,0x62,0x6b,0x71,0x7d,0x25,0xab,
+  0x0a,0xe2,0x50,0xce,0x55,0x5e,0x05,0x61,0x9f,0xbe,0xcd,0x46,0xd7,0xfc,0xeb,0x4b,0x6c,0x92,0x6d,0x57,
+  0xcd,0xb5,0xd5,0xce,0xa6,0xa5,0xea,0xa4,0x95,0x30,0x56,0x22,0x58,0xe2,0xaa,0x1c,0x7f,0xe5,0xb3,0xf1,
+  0x97,0xe9,0xbe,0xaf,0x2e,0x76,0xaf,0xb5,0x4a,0x25,0xce,0x17,0xeb,0xe3,0xa2,0x55,0x4f,0x2c,0x07,0x19,
+  0x65,0x2c,0xf4,0x8a,0xb3,0x2d,0x6f,0x4c,0xac,0xe9,0xab,0x30,0xa8,0x34,0x26,0xbb,0xce,0xd4,0xea,0x35,
+  0xbb,0xda,0x58,0xae,0x4c,0x75,0xa9,0x9a,0x1a,0x8d,0x06,0x9d,0xe4,0xaa,0x2d,0x0c,0x4b,0xcd,0xfd,0xaa,
+  0x57,0x6c,0x98,0x15,0x81,0xcd,0x4f,0x47,0x5b,0x96,0x8d,0xdb,0x0f,0xb3,0x6d,0x83,0x9b,0xda,0x51,0xb6,
+  0x33,0x95,0x52,0xc3,0xf1,0x4e,0x79,0x4d,0xf2,0x19,0x86,0xeb,0x76,0xb2,0x55,0x26,0x36,0x69,0x15,0xcb,
+  0x0f,0x4d,0x61,0xd2,0xe2,0xd6,0xf1,0xee,0x62,0xbf,0x7d,0x60,0x66,0xaf,0xcd,0x07,0x93,0xd9,0x67,0x98,
+  0x76,0xaa,0xd1,0x55,0xf2,0x85,0xdb,0x64,0xbb,0xaf,0x9b,0x43,0x65,0x5c,0x7f,0xc9,0x36,0x04,0x5e,0x9e,
+  0x71,0xb9,0xdc,0xfa,0x75,0xce,0x97,0xfb,0xec,0xa1,0xb9,0xad,0x4c,0x9a,0x5c,0xb7,0x51,0x5f,0xef,0xab,
+  0xdb,0x51,0x8e,0x61,0xf8,0x72,0xbc,0xc9,0x6a,0x8a,0x20,0x17,0xf9,0x56,0x82,0x7f,0xcd,0x46,0x93,0xc9,
+  0xcd,0x46,0x58,0xeb,0x9b,0xec,0x96,0x2d,0xa5,0x13,0xdb,0xd5,0xb6,0x9c,0x2e,0xc8,0xc9,0xec,0xb0,0x19,
+  0x9b,0xee,0xed,0x5b,0x7d,0x3a,0x62,0x7b,0xbb,0x5e,0xb9,0x18,0x8f,0x2a,0xd5,0xed,0xa1,0x90,0x55,0xb6,
+  0x40,0x60,0xbe,0xd5,0xef,0xb5,0x97,0x62,0x42,0xab,0xb5,0x94,0xd4,0x74,0xdc,0x4b,0x15,0x8d,0xc9,0x60,
+  0xf5,0x30,0x52,0x3a,0x9c,0x51,0x9c,0xa6,0xd3,0x9d,0x15,0xdb,0x5c,0x4a,0x29,0xb1,0x95,0xd2,0x72,0x9d,
+  0x5c,0xe9,0x35,0xbb,0x89,0x6f,0xa2,0x5a,0x2e,0x1d,0x7b,0xe8,0x27,0x66,0xb3,0x25,0x9f,0x17,0x6a,0x83,
+  0xd7,0xbc,0x9d,0xe3,0x32,0x9d,0x5e,0x6c,0x9e,0xe0,0x8a,0x1b,0x25,0x36,0x9d,0x89,0x27,0x91,0x50,0x09,
+  0x47,0x42,0xbb,0x5d,0xad,0x36,0xcf,0xac,0x88,0xe7,0x3a,0xac,0x14,0xda,0xa3,0xf2,0x90,0x08,0x4c,0x74,
+  0x57,0x88,0x2e,0x93,0xb7,0x60,0xaf,0x0a,0xa3,0x8d,0x3c,0xca,0x6f,0x63,0xf9,0x57,0x65,0x3c,0xc3,0xcf,
+  0x0d,0x6b,0x2d,0xe7,0xd5,0x04,0x29,0xef,0x98,0xb1,0x78,0xd5,0x1e,0xce,0xba,0xe6,0x30,0x8d,0xcb,0xcb,
+  0x50,0xd6,0x37,0xe2,0x85,0x1a,0x7c,0xe3,0xb2,0x9a,0x31,0x6a,0xb4,0xcd,0xd8,0x1e,0xc2,0x8a,0x46,0xcf,
+  0x2c,0xe7,0x1a,0x50,0x87,0xcb,0x9b,0x86,0x5c,0xe9,0x18,0x95,0x4e,0x0b,0x7f,0x9b,0xeb,0x78,0x13,0xea,
+  0xda,0xa4,0x6c,0xd4,0xc0,0xcf,0xf8,0x1b,0xff,0x6e,0x91,0xf2,0x78,0xa1,0x03,0xcf,0xf8,0xbb,0x4b,0xda,
+  0xc4,0x0b,0x4d,0xe7,0xbb,0x05,0xed,0x48,0x1d,0xb4,0x6b,0x01,0x5c,0xb7,0x1d,0xf9,0x4d,0x9e,0x01,0x06,
+  0xe9,0x8f,0xdb,0xd2,0xdf,0x6d,0xa7,0x4d,0x2b,0x00,0xd7,0x1d,0xa3,0xe3,0xf4,0x6d,0x7b,0xdf,0xb4,0x3f,
+  0x7e,0xee,0x98,0x95,0x82,0xd7,0xd6,0x6d,0x13,0xe8,0x4f,0xda,0xb8,0xcf,0xc1,0x8f,0xd7,0xf6,0xf4,0x43,
+  0xf1,0xbe,0x5c,0x77,0xe5,0xe3,0xd1,0xc3,0x83,0x71,0xda,0x26,0xbf,0x5a,0xed,0x59,0x72,0xad,0x70,0x9e,
+  0x1c,0x30,0xac,0x0c,0xbc,0xee,0xd7,0x1d,0x1b,0xb7,0xa8,0x17,0xfb,0x5a,0x0b,0x6c,0x5c,0xaf,0x5c,0xa8,
+  0x4f,0xaa,0x03,0x73,0x51,0x63,0xda,0x6b,0xb0,0x6d,0x7a,0xf3,0x10,0xdb,0xb6,0x5f,0x16,0xa9,0x2e,0x1b,
+  0xcf,0xf7,0xd7,0x9d,0xca,0x60,0xbd,0x6a,0x30,0xb1,0x7d,0x87,0x5d,0xe7,0xfa,0xc3,0xd1,0x68,0x3e,0xa9,
+  0x16,0x24,0xae,0x36,0x7a,0x58,0x4e,0xd2,0x51,0x31,0x25,0xb4,0xd7,0xb3,0xee,0x44,0x49,0x1f,0xd6,0x9b,
+  0xcd,0x21,0x61,0x65,0x0f,0xb7,0xdb,0x87,0x79,0xed,0xd0,0x56,0x3b,0x31,0x6b,0x3e,0x49,0xf0,0x5b,0x68,
+  0xd2,0x5a,0xa7,0xbb,0x13,0x2d,0x63,0x6f,0xcd,0xac,0x1d,0x3d,0x40,0xa4,0x94,0xc8,0x45,0x5f,0x32,0x24,
+  0x5a,0x5a,0x66,0x97,0x2f,0xe5,0x5a,0x16,0xcb,0xdc,0x6a,0x4d,0xa2,0xa5,0xd4,0x21,0x39,0x66,0x67,0xf1,
+  0x68,0xb1,0x5d,0x28,0x55,0x8d,0x9d,0x36,0xcc,0x98,0x75,0x6b,0xbe,0x2e,0x2d,0xf2,0xfb,0xc5,0x26,0x6b,
+  0xc4,0x77,0xa5,0x2c,0xd3,0x4c,0x95,0x5b,0xc3,0x46,0x6f,0x99,0x4b,0x26,0xd7,0xfa,0x68,0xbc,0x6e,0xbc,
+  0x66,0x4c,0x25,0x17,0x7d,0xc8,0x75,0x92,0x5a,0x21,0xdf,0x29,0x66,0x66,0xb7,0xfc,0x48,0xb2,0x57,0xe2,
+  0x66,0x32,0x5d,0x0e,0x07,0x4c,0x85,0x95,0xe3,0x89,0x71,0x3b,0xcf,0x45,0x13,0x5c,0xc2,0xae,0x9b,0x29,
+  0x63,0xd6,0xca,0xe7,0x63,0x13,0x6d,0x57,0x9c,0xac,0x72,0xe2,0x6a,0xb0,0xad,0x64,0x85,0x5a,0x2a,0xb1,
+  0xad,0xd4,0xfb,0x45,0xa5,0xd8,0x17,0x99,0x76,0x76,0xbb,0xed,0x17,0x1b,0x25,0x30,0x8b,0xa9,0x97,0x59,
+  0x1f,0x14,0x65,0x29,0x6d,0x65,0x76,0x46,0x5e,0x9b,0x4f,0xbb,0xcd,0xcd,0xe0,0xb5,0x23,0xa6,0x8d,0x49,
+  0x3b,0xb5,0xe7,0x45,0xa1,0x63,0xd5,0xf6,0x9d,0x7e,0x6b,0x24,0xd6,0xa7,0xfa,0xd6,0x6e,0x54,0xdb,0xb1,
+  0x55,0x25,0xb1,0xc9,0x6b,0x03,0x45,0xee,0x8a,0xd3,0x57,0x56,0x7c,0x68,0xa5,0x4a,0xdc,0x40,0x1a,0x94,
+  0x21,0x76,0xaa,0x66,0xf3,0xe3,0x6a,0xaf,0x3c,0x6f,0xbf,0x4c,0xab,0x2f,0xab,0x4e,0x65,0x5a,0xac,0x96,
+  0xd2,0xbd,0xcc,0x6e,0x56,0x5e,0xac,0x46,0x0c,0xd3,0x6d,0x2a,0x87,0x71,0x2e,0xbf,0x91,0x9a,0x79,0x6b,
+  0x5f,0x5d,0xe6,0x85,0xb2,0xaa,0x09,0x87,0x62,0x6a,0x25,0xf0,0xf1,0xae,0x22,0x4a,0xc3,0x5d,0x27,0x55,
+  0xa9,0x1a,0xab,0xcc,0x3c,0x9d,0xd2,0x5f,0xca,0xcb,0xdd,0xa6,0x2b,0xa4,0x92,0x82,0xd8,0xe2,0xfa,0xa3,
+  0xe8,0xae,0x65,0x75,0x1b,0xf3,0xce,0xdc,0x58,0x2a,0x09,0xa6,0xa8,0x71,0x7a,0xe7,0x55,0xe6,0x73,0xcb,
+  0x97,0xc4,0xae,0x3f,0xda,0x96,0xe4,0x7e,0x7a,0x29,0xc5,0x8d,0x7c,0x3c,0x5b,0x6c,0xa9,0x9d,0x0e,0xd8,
+  0x24,0x5b,0x8a,0xe7,0x6b,0x5b,0xd1,0xd8,0xa8,0xb7,0x83,0xc2,0x6c,0x33,0x11,0x1b,0xbb,0xce,0x6d,0xb5,
+  0x3e,0x61,0x95,0x97,0x82,0xd0,0x48,0xee,0xf5,0x72,0xce,0x2e,0x09,0xb5,0xb9,0x50,0xdf,0x1e,0x52,0x75,
+  0x5e,0x49,0x35,0x55,0x61,0x90,0xa8,0xf4,0xcb,0xdc,0xbe,0xcb,0x67,0xe6,0x6d,0x69,0x35,0xee,0x36,0x06,
+  0xbc,0xc4,0x14,0xba,0x4a,0x6b,0x9f,0xac,0x6c,0xad,0x45,0x7f,0xc3,0xcc,0xea,0x65,0xf6,0xc1,0xae,0x4e,
+  0xd3,0xb5,0x17,0xbe,0x58,0x4d,0x5b,0xcc,0xa6,0xc0,0x2f,0x37,0x49,0x08,0xbf,0xd5,0xb5,0xb9,0xee,0xb4,
+  0xba,0x49,0xb9,0xb9,0xe0,0xf6,0x8d,0x5d,0xeb,0xb6,0xd3,0x14,0xd7,0x36,0x6b,0xe9,0xa6,0x95,0xe6,0xf6,
+  0x76,0x59,0xe7,0x1f,0x6c,0xf5,0x36,0xdf,0xd9,0x0d,0xba,0x75,0xad,0xa4,0x6e,0xe8,0xb5,0xd4,0x7c,0x59,
+  0xae,0xb0,0x6b,0xc6,0xee,0x2b,0xc5,0x62,0xd0,0x6e,0xbb,0xfb,0x5f,0x34,0x1b,0x1d,0x4c,0x25,0xe7,0x18,
+  0x6d,0xf7,0xee,0xef,0x42,0x33,0x5e,0x23,0x9a,0x21,0x46,0xc1,0x7a,0x73,0x86,0x28,0x80,0x11,0xfd,0xe7,
+  0x5c,0xe6,0xc0,0x7c,0x3e,0x91,0x43,0x1a,0xb7,0x1e,0x03,0x74,0xf6,0xb6,0x3e,0x7d,0x37,0x17,0x86,0xa4,
+  0x5b,0xf0,0x14,0x8d,0xa2,0xf1,0x4a,0x50,0x89,0x29,0xff,0xc2,0x6b,0x5f,0xdc,0xd4,0x58,0x7a,0xb4,0xb3,
+  0xd4,0x50,0xa9,0x3e,0x32,0xcf,0x72,0xa9,0x96,0x36,0x04,0x66,0xe4,0xa0,0x4a,0x0a,0x6e,0xc3,0x2d,0xbd,
+  0xe8,0xcc,0x92,0x14,0x01,0x85,0x15,0xf3,0x26,0x12,0xf9,0xb4,0xe5,0x0c,0x07,0x40,0x49,0x90,0xb9,0x03,
+  0x7a,0x44,0xd9,0x6c,0xf6,0xdb,0xf1,0xd0,0x38,0xfc,0x23,0x97,0x44,0x39,0x95,0x37,0x03,0x1b,0xe8,0x8e,
+  0x37,0xe0,0x85,0x3d,0xc7,0x88,0x39,0x60,0x03,0x1d,0x0c,0x9a,0xc4,0x2b,0x50,0x5c,0xf0,0x10,0x1e,0x3a,
+  0xa4,0x2b,0x20,0x29,0x62,0xef,0xe4,0x7c,0x8b,0xde,0x4d,0x66,0x42,0x09,0xf4,0xc5,0xef,0x14,0x21,0x68,
+  0xb2,0x24,0x60,0x84,0x22,0x88,0x55,0x77,0x30,0x03,0x9c,0x86,0x1c,0x71,0x93,0x8a,0x0d,0x01,0x27,0x06,
+  0x23,0x05,0x27,0xf2,0x1a,0x24,0xf6,0xc4,0xa7,0xbd,0xc4,0xfb,0x21,0x63,0xdd,0x41,0x29,0x84,0x87,0x26,
+  0x1d,0x0f,0x47,0xc3,0x94,0x24,0xa2,0xa6,0x0a,0x6e,0xce,0xf5,0xa3,0x73,0x5c,0x4a,0x47,0x33,0x6c,0x01,
+  0xe7,0x35,0x43,0xf9,0x4e,0xa0,0xe9,0x54,0x1c,0xc2,0x99,0x7c,0x48,0xd8,0x52,0x54,0x61,0x18,0x05,0x9f,
+  0x50,0x0a,0x2a,0x49,0x47,0xd6,0xd4,0xcf,0x16,0x52,0x05,0x81,0x84,0xbd,0x6b,0x01,0xe2,0x49,0xce,0x5c,
+  0x4b,0xaa,0xe8,0x9d,0x61,0xd3,0xc9,0xb9,0xbc,0xd0,0x6d,0x13,0xd6,0x99,0x3f,0x26,0x2e,0x93,0x39,0xd3,
+  0x6a,0x83,0x6b,0x07,0xd8,0xb1,0x98,0x75,0x8f,0x38,0x0d,0x97,0x60,0x43,0x7c,0x3c,0x12,0x7c,0x2f,0x70,
+  0x34,0x4e,0xb9,0xaf,0x92,0xf3,0x2f,0x13,0xf1,0xe0,0x11,0x2e,0x2c,0x98,0xbd,0x1f,0x57,0x53,0x57,0xb1,
+  0xee,0x67,0x30,0xa3,0xb9,0x60,0x01,0x2f,0x60,0xf0,0x1d,0xb9,0xb0,0x10,0xd1,0x54,0xbc,0x2f,0x0c,0x43,
+  0x84,0xc9,0x7c,0x6e,0x10,0xc4,0xe1,0x38,0xb5,0x34,0x90,0x6f,0xf6,0x8d,0xfe,0xec,0x39,0x29,0x99,0x5e,
+  0x41,0x19,0x77,0x20,0xf5,0x3f,0x08,0x7a,0x38,0xb7,0x9b,0xe6,0x78,0xd2,0x1a,0x18,0x04,0x97,0xe0,0xbd,
+  0x08,0xef,0x98,0x9d,0xce,0xd7,0x44,0x8b,0x15,0xa7,0x8a,0xf0,0x8d,0x53,0x03,0x4d,0x7c,0x8d,0x1e,0xa6,
+  0x82,0xb3,0xd5,0x74,0x5d,0x50,0x9d,0x1c,0x50,0x92,0xc4,0x26,0xe0,0xdc,0x75,0x9d,0xdc,0xb9,0x0f,0x7a,
+  0xbf,0xe4,0x9c,0x15,0x08,0xa5,0x69,0x3a,0x1e,0x82,0x74,0x5e,0x70,0x8a,0x40,0x7a,0x12,0x61,0x20,0xfe,
+  0xad,0x93,0xff,0x0d,0x5e,0x31,0xf0,0x84,0xd7,0x28,0x5e,0x0c,0x84,0xfc,0x58,0x76,0x3d,0x76,0x10,0x06,
+  0xf2,0xe0,0x62,0x9b,0x24,0xa1,0x5c,0xd4,0x88,0x48,0x11,0x6f,0x99,0x70,0xee,0xcf,0x27,0x7d,0xbf,0x99,
+  0x0e,0xee,0x32,0x30,0x48,0x52,0xc2,0x02,0x7c,0xf0,0xfd,0x93,0xc3,0xa6,0x00,0xe6,0x37,0x88,0x1e,0xea,
+  0x63,0x2e,0x60,0x69,0x21,0x7c,0x33,0x81,0x83,0xf8,0xd0,0x2b,0xd0,0x2e,0x1c,0xa2,0x35,0x21,0xc2,0x2f,
+  0xfa,0x0c,0xec,0x26,0x57,0xc2,0x1f,0x3d,0xb1,0xc1,0x63,0xf9,0x42,0x68,0x81,0xb4,0x7f,0x43,0x3f,0x8e,
+  0x3a,0x08,0x86,0x01,0xa4,0xba,0xd6,0x83,0x8a,0x2d,0xee,0x82,0xd3,0xfb,0xa3,0xe4,0xd8,0xf1,0xce,0xdf,
+  0x81,0xb9,0x23,0x3c,0x22,0x32,0xef,0xae,0x79,0x4f,0x65,0xd1,0x85,0x40,0x72,0xea,0x9d,0xc1,0x38,0x9e,
+  0x27,0x13,0x68,0x49,0xa6,0x85,0x25,0x26,0xec,0xe6,0x41,0xde,0xf9,0xa3,0x0b,0x6e,0x02,0x3c,0x59,0x29,
+  0x92,0x2a,0xe0,0xa9,0x0b,0x11,0x1c,0x97,0x44,0x4c,0x5d,0x96,0xac,0x70,0xe8,0x59,0xa5,0x73,0x46,0xc0,
+  0xf3,0x85,0x8d,0xd3,0x01,0x23,0x98,0xb6,0x34,0x33,0xb0,0x70,0xa8,0xf3,0x61,0x3f,0xb9,0xf4,0x26,0x22,
+  0xa9,0x30,0x52,0x8d,0x6d,0xb7,0x00,0x0e,0x81,0xf7,0x8f,0xd8,0xef,0xe8,0x16,0x85,0xc3,0xf4,0x47,0xe2,
+  0x77,0xf4,0xd3,0x23,0x0a,0x85,0x6e,0xd0,0x6f,0x28,0x84,0xc2,0x21,0xa8,0xf2,0x2a,0x6e,0x51,0xe8,0x26,
+  0x84,0xbe,0xe2,0xda,0x77,0xc6,0xf3,0x73,0x6d,0x2f,0x0d,0x18,0xff,0xfd,0x9b,0x37,0xa5,0xa5,0xa6,0xb9,
+  0xe5,0x11,0x53,0xc6,0x07,0x18,0xc9,0x9b,0xc8,0x8b,0x26,0xa9,0xc1,0x79,0xd1,0x46,0xf0,0x37,0x62,0x08,
+  0xba,0x0c,0xaa,0x38,0x2f,0xcb,0x50,0x6f,0x01,0xa1,0x42,0xe4,0x88,0xf8,0x9d,0x86,0x2a,0x69,0x18,0x0d,
+  0xb6,0x04,0xde,0x55,0xf1,0xda,0xe5,0xd4,0x83,0xab,0xfb,0x91,0x66,0x5b,0xf8,0x9c,0x86,0x43,0x8a,0x46,
+  0x5e,0x18,0x00,0x42,0xea,0xdc,0x59,0x20,0x3b,0x68,0xce,0x75,0x08,0x8c,0xf5,0x8e,0x93,0x2c,0x8c,0xf6,
+  0x89,0xe6,0x02,0x32,0x06,0x8d,0xcd,0x17,0x94,0xb8,0x41,0xf7,0x08,0xb4,0x88,0x10,0x51,0xb5,0x5d,0xf8,
+  0xc6,0xbd,0x99,0x44,0x64,0x1c,0x1f,0x40,0x43,0x27,0x18,0x34,0x7c,0x24,0x6c,0x7e,0xa2,0xbb,0xd5,0x66,
+  0xaa,0x61,0x98,0x8c,0xd3,0xef,0xc7,0x1d,0x0a,0x93,0x81,0x9f,0x50,0x0c,0xb3,0x87,0x3c,0x7f,0x85,0x67,
+  0x72,0xdd,0xe4,0xc6,0x15,0xc9,0xe2,0xd1,0x6c,0xde,0x96,0x37,0x85,0x22,0x7f,0x51,0xe0,0xce,0xd5,0xf2,
+  0xe9,0x44,0x1c,0xba,0x75,0xc9,0x40,0x61,0x2a,0x94,0x27,0xc8,0xf4,0x9c,0x3b,0x50,0x60,0xe7,0x40,0x5f,
+  0xf1,0xd1,0x9d,0xa4,0x0b,0xfc,0xdb,0x38,0xe1,0x86,0x97,0x97,0xc0,0x99,0x56,0xc6,0xe3,0xfc,0x20,0x96,
+  0x62,0x44,0xb3,0xd2,0x03,0x6b,0xce,0x39,0x0f,0x27,0xd0,0xee,0x48,0xd2,0x2d,0xde,0x53,0xc0,0x82,0x06,
+  0xc3,0x07,0x95,0x90,0x0f,0x92,0x0c,0x83,0xd9,0x9b,0x6f,0xe4,0x27,0x8e,0x86,0x99,0xb4,0x5b,0x35,0x70,
+  0x76,0x06,0x78,0x81,0x9b,0x16,0x1d,0x16,0x57,0x83,0xa6,0xc0,0x06,0xf7,0x40,0x96,0x3a,0x55,0xef,0x27,
+  0x4a,0x83,0xa0,0x2c,0x2d,0x69,0x32,0x0f,0x69,0x8b,0x2d,0x0c,0xde,0xfb,0x45,0x29,0xf4,0xeb,0xaf,0x34,
+  0xa9,0xc7,0x31,0xfd,0x50,0x96,0x88,0xc5,0x7c,0xe6,0x07,0x17,0xbb,0xd3,0x9f,0xfa,0x16,0xac,0xb0,0xb7,
+  0xce,0xd7,0xfd,0x1b,0x2b,0xd1,0x4d,0xd7,0x3f,0x5e,0x87,0xa1,0xad,0xbf,0xb0,0x63,0xbf,0xfb,0x17,0x37,
+  0x0c,0x14,0xc6,0x43,0x4b,0xd0,0x24,0xfe,0x0d,0xbe,0xbe,0x3f,0x3a,0xe6,0xa7,0xcd,0xed,0x31,0xce,0x50,
+  0xe2,0xac,0x55,0x59,0x50,0x45,0x6b,0x05,0x6d,0x6e,0x6f,0x7d,0xb4,0x29,0xe2,0x8e,0xc1,0x7a,0xbc,0x8e,
+  0x94,0x73,0x6e,0x8b,0x71,0x90,0xbc,0x29,0x50,0x0b,0x40,0x3b,0xdf,0x38,0x40,0x22,0xd4,0x97,0x71,0x15,
+  0x87,0xe4,0xa1,0xfa,0xc3,0xbf,0x9e,0xe1,0x73,0x04,0x54,0x7d,0x38,0x54,0x2d,0xb3,0x78,0xb5,0xbb,0x37,
+  0x2a,0xe0,0x19,0x6b,0x79,0x9f,0x6f,0xd8,0xdb,0x0b,0x7b,0x72,0x13,0xb8,0x9c,0x45,0x47,0x34,0x71,0xa2,
+  0x26,0x4e,0xb4,0x36,0x1d,0x0f,0x42,0xb5,0x95,0x39,0xf6,0x2c,0x35,0x04,0x9e,0xe6,0x62,0xf5,0xc9,0x9f,
+  0x21,0xa6,0xc9,0x23,0xbe,0xc9,0xe7,0x3a,0x03,0x81,0x6b,0x16,0x9f,0xce,0x0d,0x1f,0x1e,0xce,0x3f,0x1e,
+  0xbe,0xbc,0x45,0x15,0x80,0xe0,0x38,0x4c,0xfe,0x55,0x0f,0x2c,0xa7,0x98,0x75,0x27,0x39,0x6f,0xcf,0xc7,
+  0x49,0x6f,0xcf,0xe0,0xa5,0x63,0x3d,0xe7,0x67,0xaf,0x3d,0x87,0xfc,0x0b,0x76,0xcf,0xee,0x41,0xf8,0x73,
+  0x20,0x8d,0xed,0xd9,0xcf,0x5d,0x7b,0x3e,0x4f,0x3f,0x73,0xd4,0xc9,0x79,0xca,0xda,0xb3,0x97,0xb3,0xf6,
+  0xfc,0x81,0xa4,0x35,0x17,0xcc,0xb3,0x93,0xab,0xf6,0x4c,0x92,0xd5,0x9e,0xdd,0x6c,0xb5,0xe7,0x90,0xd3,
+  0xe0,0xd9,0xdd,0x07,0x7c,0x76,0x72,0x6b,0x3d,0xc7,0x9c,0xdc,0x56,0x03,0xd7,0x09,0xf3,0x6b,0x47,0x9c,
+  0x42,0x89,0xbc,0xec,0x45,0x30,0x24,0x4e,0x76,0xdd,0xa5,0xc8,0xb3,0x4a,0xfc,0x7a,0xce,0xf7,0xc6,0x57,
+  0xf8,0xad,0x45,0x58,0x89,0x83,0xbb,0x28,0x80,0xca,0xe7,0xef,0x28,0x63,0x29,0x81,0x76,0x12,0x98,0x66,
+  0x22,0x8e,0x11,0x4c,0xba,0x93,0xa4,0xb6,0xe7,0x10,0x16,0x17,0x07,0xb5,0xf0,0xcd,0x73,0x88,0x12,0x34,
+  0x70,0x47,0xd0,0x9f,0x0f,0xe5,0x47,0x00,0xff,0xd3,0xe4,0x48,0x95,0x77,0xe2,0x0a,0x02,0x2d,0x82,0x3e,
+  0x94,0xdc,0x06,0x48,0x31,0xd0,0xd3,0xcf,0x2c,0x22,0x56,0xcc,0xc9,0x6e,0x0b,0x81,0xec,0x79,0xaa,0xec,
+  0xfc,0x6a,0x90,0xe7,0x56,0x1d,0xb9,0xfb,0x8e,0x13,0x73,0xe3,0xdd,0x36,0xc7,0x97,0x80,0xd8,0x09,0x8b,
+  0x65,0x0b,0xaf,0x48,0x6f,0xd5,0x82,0xc6,0x33,0x0e,0x34,0x03,0x4a,0x03,0xbd,0x4c,0x6e,0xcd,0x81,0x1e,
+  0x21,0x0c,0x3b,0xb1,0xff,0x57,0x9a,0x06,0x55,0xce,0xb1,0x20,0xd3,0xfe,0xc7,0x61,0x08,0xf1,0xc6,0xfe,
+  0x80,0x85,0xbc,0x3a,0xba,0x2f,0xef,0x80,0x03,0x11,0xec,0xb0,0x6f,0x42,0x03,0x06,0x9a,0xda,0x10,0x47,
+  0x13,0x30,0xa7,0xfc,0x09,0x58,0x89,0x23,0x21,0xf8,0xeb,0x58,0x09,0x6f,0xd5,0x05,0xad,0x83,0xeb,0xbe,
+  0xf9,0x3a,0xd9,0xf5,0x24,0xce,0x9a,0xde,0x1c,0x6b,0xd3,0x7f,0x89,0xa2,0x1f,0xed,0xe4,0x2a,0x82,0x50,
+  0xc8,0xed,0x87,0xbd,0x67,0x1c,0x09,0xfb,0xd1,0xa5,0x49,0x23,0x6c,0xc7,0x0d,0x03,0x3e,0x78,0x11,0x53,
+  0x98,0x43,0x64,0x5b,0xc1,0x73,0xd5,0xf0,0xa2,0xc6,0xd7,0xfb,0xef,0xf0,0xc5,0x17,0x88,0x62,0x20,0x74,
+  0xb9,0xf1,0xae,0xab,0x92,0x48,0xc2,0x71,0xd9,0xff,0xfb,0xbf,0x91,0x72,0x70,0x5d,0x22,0x20,0x60,0xe8,
+  0xa7,0x23,0xda,0x7c,0x4c,0xd2,0x1c,0xe7,0xc3,0x01,0x13,0x0c,0x14,0x1d,0xfa,0x9d,0x8b,0xd5,0x05,0x23,
+  0x85,0x65,0x26,0x80,0xcb,0x1f,0x21,0x1c,0xee,0x1e,0xec,0xea,0x3d,0x07,0xfd,0xdc,0xcf,0xbf,0xe0,0xcb,
+  0xf7,0xbf,0x24,0xd2,0x9f,0x09,0x06,0x98,0x0a,0xc7,0x53,0xc7,0x33,0x3f,0x02,0x03,0xc4,0xf8,0x46,0xf0,
+  0x73,0xb5,0xa7,0xac,0x89,0xe1,0x10,0x5e,0x09,0x38,0x82,0x77,0xda,0x81,0xbf,0x0f,0x5a,0xc1,0xeb,0x76,
+  0x73,0xd1,0xde,0x7a,0xd5,0x6f,0x98,0x5b,0xbc,0xca,0xaa,0x4e,0xb6,0xaf,0xcb,0x47,0x2f,0x28,0x0a,0x7a,
+  0x64,0x27,0x74,0xfe,0x8b,0x2f,0xb8,0xa0,0x98,0x1c,0x7b,0xc4,0xef,0x2d,0xb8,0x37,0xdc,0x97,0x96,0xef,
+  0x7c,0xbf,0xe3,0xc1,0x30,0x2b,0x6d,0x17,0x5c,0x36,0xc4,0x7e,0x70,0x1e,0x81,0xc3,0xba,0x46,0x2e,0x9e,
+  0xba,0x7b,0x11,0xfc,0x4d,0x90,0xd8,0xc7,0xf8,0x3a,0xd1,0x00,0x9d,0x50,0xf4,0x0b,0x1a,0x70,0x00,0x17,
+  0x6f,0x1b,0x70,0x2a,0xf6,0x0d,0x17,0xd4,0x47,0xb1,0x4d,0xea,0x0e,0x19,0x02,0xd9,0x4a,0x71,0x37,0x96,
+  0x88,0xf7,0x48,0x57,0x01,0xef,0x25,0xbe,0x61,0x4b,0x48,0xb7,0x19,0xf0,0x51,0xdd,0x62,0x25,0x80,0x41,
+  0x84,0x76,0x94,0x0a,0x34,0x26,0xf0,0x0d,0x3c,0x91,0x87,0x9d,0x04,0x4e,0x96,0x73,0x5c,0xe7,0xc3,0x08,
+  0xe6,0x4e,0x80,0xd5,0x6f,0x70,0x5b,0x8e,0x21,0xbb,0x88,0xb0,0xf0,0x4c,0x2c,0xab,0xee,0xde,0x47,0xb1,
+  0x37,0x44,0x8b,0xc3,0x42,0xc6,0x77,0xdc,0xe9,0x28,0x2c,0xb6,0xf5,0x9a,0x2a,0x1f,0xc0,0x69,0x30,0xd6,
+  0x26,0xe6,0x21,0x1e,0xd6,0x49,0x0d,0xbc,0x71,0xc8,0x66,0xa2,0x2f,0xc2,0x9e,0xc3,0xdb,0x49,0x5f,0x10,
+  0x5b,0xab,0x33,0xe4,0x55,0x0b,0x58,0xf2,0xff,0xef,0xff,0xfe,0x3f,0x7f,0xfa,0x13,0x22,0xee,0x9f,0xb3,
+  0x22,0x29,0x8d,0x23,0xe4,0x75,0x11,0xdd,0x25,0x5e,0x6d,0x34,0x48,0xc1,0x57,0x87,0xa8,0x5f,0x0c,0xcb,
+  0x14,0x74,0xf8,0x7d,0x1c,0xe1,0xe5,0x4a,0x2c,0xd3,0x69,0x0b,0xf4,0x8f,0xfd,0xef,0x98,0x05,0xa1,0x0e,
+  0x14,0x87,0xbc,0xa8,0xd4,0x10,0x44,0x01,0xbb,0xa4,0x51,0xa7,0xd5,0xf3,0x3f,0xc2,0x91,0xdb,0x9b,0x67,
+  0xd2,0xf4,0x39,0x14,0xfe,0xc7,0x7f,0x86,0x7e,0x87,0x9f,0xa1,0xa8,0xd7,0xc1,0x22,0x77,0x8e,0x41,0x9d,
+  0x38,0x48,0x11,0x0f,0x37,0x4c,0xc0,0x38,0xa2,0x8a,0x51,0x06,0xf6,0x1a,0x26,0x4e,0x3e,0x0f,0x93,0xf6,
+  0x10,0xbe,0xdf,0x1c,0x07,0x06,0x0e,0x9e,0x84,0xc8,0xf4,0xf5,0x7a,0x30,0xa0,0xe3,0x4e,0xa3,0xf8,0xbd,
+  0xdf,0x30,0xac,0x6a,0xde,0x5e,0xa1,0x27,0x0c,0xe8,0x7b,0xfc,0xe6,0xbd,0x28,0x26,0x10,0x30,0x78,0x38,
+  0x78,0xb1,0x01,0x2d,0x49,0xfc,0xfe,0x0d,0x23,0x31,0x15,0xb8,0xd5,0x5d,0x40,0x40,0x10,0xb9,0x1e,0x43,
+  0xc4,0x27,0x12,0xb8,0xd2,0x4d,0xcc,0x0f,0x23,0x29,0x92,0xcc,0x19,0xce,0x9b,0x15,0x88,0x84,0xca,0x02,
+  0x67,0xf8,0xfe,0xb9,0x89,0x49,0x4e,0x42,0xd6,0x40,0x0a,0xf6,0x15,0x3e,0x16,0x71,0x57,0x10,0xc5,0x20,
+  0xf7,0xce,0x39,0xe3,0xb6,0x72,0xe0,0x3d,0x23,0xcc,0xa1,0x7f,0x07,0x43,0xfe,0x14,0x45,0x5d,0x23,0x4d,
+  0x69,0xf5,0xc9,0x77,0x21,0x5c,0x0d,0x81,0xab,0x3f,0x62,0x3a,0x79,0x6c,0x0f,0x85,0x13,0x8b,0x79,0x6c,
+  0x2d,0xc9,0x2e,0x89,0x63,0x1f,0x48,0x14,0x85,0x88,0x17,0x43,0xae,0x61,0x9a,0x9f,0x2e,0x6e,0x21,0x62,
+  0xb5,0xe7,0x5d,0xdc,0x44,0x45,0xa2,0xe5,0x8f,0xdd,0xb5,0xc0,0xfd,0xca,0xbf,0x8e,0xf5,0x78,0xdf,0x0f,
+  0xbb,0x48,0xae,0x37,0x3c,0x2c,0xff,0x22,0xed,0xc7,0xbd,0xb2,0x60,0x9f,0x53,0xa7,0xec,0xc8,0x55,0x59,
+  0xe2,0x0a,0xaf,0xf5,0x63,0xe8,0xf6,0xe3,0x20,0xbf,0x5d,0x73,0x29,0x96,0xfe,0xc5,0x7c,0x2c,0x79,0xcb,
+  0xcb,0xce,0x44,0xf0,0x82,0xec,0x6f,0xa1,0xdb,0xe5,0xdb,0x06,0xd0,0x97,0x04,0x56,0xb3,0xc1,0x76,0x90,
+  0x4b,0x9a,0x17,0x85,0x82,0xde,0xa0,0xfc,0x3b,0x0b,0x04,0xb9,0x26,0xfb,0x71,0x59,0x70,0x9a,0xbf,0x2f,
+  0x06,0xb8,0xe1,0x5b,0x12,0x10,0x04,0x74,0xc6,0x7c,0xd3,0x61,0xbe,0x97,0x6d,0xf8,0x2e,0xf3,0x31,0xa3,
+  0xde,0x67,0x7c,0xe0,0x82,0x5b,0x01,0xc2,0x68,0x72,0xf3,0xec,0x32,0xe3,0xfd,0x7b,0x69,0x7f,0x67,0xe6,
+  0x93,0x6b,0x88,0x1f,0x67,0xbe,0xd3,0xfc,0x7d,0xe6,0xe3,0x86,0x6f,0x31,0x3f,0x08,0xe8,0x2a,0xf3,0xbd,
+  0x3b,0x7d,0xef,0x32,0xdf,0x65,0xd6,0xfb,0x02,0x10,0xbc,0x4e,0x7b,0x91,0xef,0xc1,0x6b,0xac,0x7f,0x67,
+  0xce,0xd3,0xab,0xce,0x1f,0x67,0xbd,0xdb,0xfe,0x7d,0xde,0x93,0x96,0x6f,0x31,0xff,0x08,0xd4,0x55,0xee,
+  0x07,0x6e,0x04,0xbf,0xcb,0x7f,0x9f,0x69,0xef,0x48,0x00,0x91,0x81,0x61,0x0f,0x15,0xe8,0x56,0xf1,0x31,
+  0xeb,0xf1,0x8b,0x39,0xfe,0xc7,0xb3,0xfc,0x8d,0x00,0x91,0x4c,0xd1,0x0b,0x0d,0xb1,0x37,0x0b,0x71,0x99,
+  0xc3,0x2f,0xfc,0x92,0x92,0x25,0x09,0xf8,0xfc,0xeb,0xe3,0xf8,0x25,0xc0,0xa4,0x05,0x8c,0xee,0xd6,0x1f,
+  0x5f,0xb9,0x35,0xa1,0xcd,0xe5,0x75,0x56,0xd2,0x76,0xea,0x65,0x2a,0xd3,0x17,0xc8,0xfc,0xcd,0xe9,0x4c,
+  0xde,0x9b,0x73,0x99,0xd2,0xf4,0x95,0x3a,0xa7,0xb4,0xa6,0xef,0x5d,0xc6,0x94,0xf6,0xeb,0x4f,0x69,0x8d,
+  0x6b,0xae,0xec,0x91,0xe0,0x78,0x6f,0xec,0x5e,0x4f,0x06,0x82,0x47,0xa3,0xc7,0x5e,0x8c,0x73,0x97,0xf8,
+  0x6f,0x4e,0x75,0x3a,0xcd,0xb7,0x36,0x3f,0x8e,0x88,0x42,0x6e,0x1f,0xff,0xdd,0x49,0x02,0x93,0xfc,0x28,
+  0x41,0xfc,0xbb,0xcd,0x7f,0x73,0xa2,0xb8,0x13,0x0d,0xbd,0xb3,0xf3,0x88,0xef,0x6c,0xa2,0xf0,0x6f,0xde,
+  0xc9,0xe2,0xf1,0x96,0xe3,0x5f,0x6f,0xaf,0xd1,0x4f,0x8e,0x38,0x23,0x97,0x77,0x5c,0xfb,0x7e,0x56,0x04,
+  0xd9,0xe7,0xc8,0x73,0x9c,0x21,0xae,0x7e,0x42,0x79,0x15,0x69,0x32,0x8f,0x74,0xc9,0x20,0xe7,0x8d,0x86,
+  0xb4,0x58,0xff,0xf4,0x36,0xac,0xe3,0xc4,0x09,0x44,0x9c,0xee,0x7b,0xdb,0xe4,0xe6,0xb2,0x9b,0xd8,0x45,
+  0x5f,0x70,0x17,0x76,0xac,0xfe,0x2d,0xa6,0xcb,0x2d,0xcd,0xcc,0x22,0x69,0xf6,0xdc,0x62,0x21,0x98,0xe6,
+  0xcd,0xd5,0x9c,0x06,0xb2,0xaf,0x1e,0x78,0xe9,0x5b,0xa0,0xd4,0x7f,0xe5,0xda,0xfb,0x62,0xe0,0xa6,0xcd,
+  0xbc,0xe5,0x2d,0x56,0x03,0xaf,0x0f,0x73,0x5e,0x8d,0x45,0xf6,0x4a,0x4d,0xc1,0xd8,0x92,0x14,0xb1,0xa0,
+  0x3c,0x04,0x50,0xfa,0xeb,0x88,0xc4,0x1f,0x4e,0xb7,0x39,0x93,0x9c,0x77,0x29,0xe9,0x87,0xf2,0xd7,0x89,
+  0x19,0xa4,0x93,0xcf,0xa4,0xff,0x01,0x64,0xba,0x92,0x05,0xf5,0xc7,0xa9,0x84,0xb3,0x4f,0xdf,0xd3,0x37,
+  0x57,0x6f,0x5f,0x47,0x50,0xd8,0x94,0xf1,0x7e,0xa4,0x7c,0xc0,0xb7,0x0c,0x0d,0x7c,0xc8,0xed,0x64,0x69,
+  0xdc,0xf8,0xb4,0x3d,0xbe,0xd3,0x4d,0xe6,0xe6,0xae,0x1e,0xe7,0x62,0x37,0x4e,0xd5,0x8b,0x7c,0x9f,0x1b,
+  0x4f,0x61,0xfc,0x56,0xcf,0x7b,0x67,0x3b,0x5e,0x52,0x51,0xd2,0xbc,0xa1,0x89,0x21,0x7f,0x09,0x6e,0x7c,
+  0xf4,0x84,0xcd,0x69,0x27,0x6b,0x0b,0x92,0xd0,0x1b,0xa1,0xf3,0xf1,0x35,0xc2,0x8f,0x3b,0x94,0x8c,0xc5,
+  0x62,0xef,0x2b,0x03,0x4a,0xb9,0xf7,0xd8,0xe3,0xbf,0x5c,0x83,0x73,0x93,0x94,0x82,0x2a,0x20,0xf0,0xf6,
+  0x00,0xba,0x53,0xda,0x21,0x69,0x20,0xbe,0x94,0xe3,0x43,0x7f,0x1c,0x20,0x61,0x38,0x78,0xd7,0xd7,0x3d,
+  0x71,0x23,0x07,0x99,0x91,0x85,0x65,0xc8,0x4d,0xe1,0x80,0x89,0x41,0xb0,0x40,0xff,0xe5,0x75,0x80,0x31,
+  0x49,0x7b,0x32,0x85,0xbf,0x96,0x59,0xc6,0x18,0xde,0x42,0x78,0x46,0x27,0xfe,0x15,0xcb,0x16,0xd9,0x1f,
+  0xfe,0x17,0xcd,0x35,0xc9,0xf7,0x25,0x41,0x24,0x81,0x07,0x51,0x64,0x90,0x94,0x2e,0xc1,0x28,0x5d,0x7c,
+  0xc2,0xdc,0x78,0xef,0xcb,0x0e,0xee,0x1f,0x92,0x3a,0x12,0x39,0x1e,0xb1,0x83,0x8e,0x78,0xc1,0x20,0x00,
+  0x63,0xe9,0x2c,0x20,0x86,0xd4,0x03,0xa2,0xf0,0x83,0xbc,0x0b,0xf2,0xd2,0x10,0x0e,0x23,0x3f,0x3e,0x86,
+  0x2f,0x22,0xa7,0x63,0xbc,0xe5,0x9a,0x9d,0x90,0xcc,0xe3,0x1c,0x0a,0x3b,0xc7,0x73,0x6e,0xba,0x2b,0x36,
+  0xb6,0x75,0xeb,0x33,0xbe,0x84,0xac,0x29,0xf4,0xa5,0xa2,0x66,0xe4,0xc3,0xd9,0x11,0x27,0xf9,0xcc,0x67,
+  0x07,0xd4,0xce,0x2a,0xe8,0x01,0xeb,0x8f,0xd2,0xe8,0x61,0x18,0x7c,0xfa,0x51,0x77,0x92,0xdc,0x83,0x4b,
+  0xe2,0xf4,0x0c,0x80,0x8c,0x74,0x55,0xd7,0xba,0xaf,0xcc,0x38,0x56,0xb5,0x4e,0x5f,0x32,0xfe,0xf7,0xa8,
+  0x7b,0x11,0xe0,0x7b,0x94,0xbe,0x4f,0xf7,0x7b,0x94,0xfe,0xff,0xcf,0xfe,0x1f,0xab,0xcd,0x99,0xd4,0x17,
+  0x6d,0x00,0x00,
+};
+
+// WebConsole (5681 bytes, 2527 gzipped)..
+const uint32_t WebConsoleGzSource = 0x0da8371e;
+const uint8_t WebConsoleGz[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x58,0x59,0x77,0xdb,0x3a,0x0e,0x7e,0xbe,0xf9,
+  0x15,0xac,0x7a,0x5a,0xdb,0xad,0xe3,0x25,0x89,0xb3,0x78,0xe9,0x19,0xaf,0xd9,0xdb,0x38,0x76,0xb6,0xce,
+  0xcc,0x03,0x2d,0x51,0x12,0x1b,0x89,0x74,0x24,0xca,0x4b,0xef,0xcd,0x7f,0x1f,0x80,0x5a,0x6c,0x27,0xe9,
+  0x9d,0x7b,0x9f,0x66,0xda,0x73,0x6c,0x89,0x24,0x40,0xe0,0x03,0xf0,0x01,0x4e,0xf3,0x5d,0xef,0x5b,0x77,
+  0xfc,0x70,0xd5,0x27,0xae,0xf2,0xbd,0x2f,0x5b,0xcd,0xf4,0x8b,0x51,0xeb,0xcb,0x16,0x21,0x4d,0xc5,0x95,
+  0xc7,0xbe,0xdc,0xb1,0x09,0xe9,0x4a,0x11,0x4a,0x8f,0x11,0x5b,0x06,0xa4,0x3f,0xba,0xda,0xdd,0x21,0x23,
+  0xee,0x08,0xea,0x91,0x63,0x26,0x58,0x40,0x95,0x0c,0x9a,0xe5,0xf8,0x34,0xca,0xf9,0x4c,0x51,0x22,0xa8,
+  0xcf,0x5a,0xc6,0x8c,0xb3,0xf9,0x54,0x06,0xca,0x20,0xa6,0x14,0x8a,0x09,0xd5,0x32,0xe6,0xdc,0x52,0x6e,
+  0xcb,0x62,0x33,0x6e,0xb2,0x6d,0xfd,0x52,0x24,0x5c,0x70,0xc5,0xa9,0xb7,0x1d,0x9a,0xd4,0x63,0xad,0xaa,
+  0xa1,0xd5,0x78,0x5c,0x3c,0x92,0x80,0x79,0x2d,0x23,0x74,0x41,0x85,0x19,0x29,0xc2,0x41,0x8b,0x41,0xd4,
+  0x72,0x0a,0xaa,0xb9,0x4f,0x1d,0x56,0x9e,0x0a,0xc7,0x20,0x21,0xff,0xc9,0xc2,0x96,0x51,0xdd,0x5f,0x54,
+  0xf7,0x0d,0xe2,0x06,0xcc,0x6e,0x19,0x16,0x55,0xb4,0x9e,0x9d,0x69,0x4c,0x68,0xc8,0xf6,0xf7,0x8a,0xfc,
+  0xb6,0xf3,0xed,0x7a,0x5e,0x39,0x3f,0x76,0x64,0x1b,0xfe,0x7d,0x1d,0xdd,0xb8,0xfd,0x1b,0x07,0x9e,0x3a,
+  0xf8,0xda,0x1e,0x76,0xdb,0x43,0xf8,0xea,0x56,0x3f,0xff,0xb0,0x9f,0x70,0xa1,0x73,0x6c,0x75,0xc6,0x37,
+  0xfd,0x76,0xfb,0xe2,0xf8,0xaa,0x5b,0x5e,0xb8,0x1d,0xdc,0x6e,0x7b,0xf3,0xd1,0xc0,0xfb,0x09,0x0f,0xd1,
+  0xe9,0x1c,0xb6,0xf8,0x65,0x87,0x9d,0xdf,0x94,0x2d,0xd4,0xd3,0xb6,0x2a,0xa3,0x9b,0xea,0xa0,0xf3,0xd9,
+  0xec,0x0c,0xae,0xcd,0xf6,0xd9,0x72,0x70,0xdd,0x5b,0x3c,0xe2,0xc6,0x77,0xab,0x7f,0xfb,0x60,0xf5,0xbf,
+  0xce,0x26,0x77,0x55,0x6f,0x22,0x86,0xed,0xe1,0xee,0x99,0xf7,0x70,0x7f,0xed,0x7d,0xef,0x76,0x76,0xe9,
+  0xfd,0xb5,0x3c,0xed,0x5b,0x67,0xe3,0xdb,0xce,0xbd,0x33,0xdc,0xbb,0x47,0x81,0xdd,0xbe,0xd7,0x1f,0xde,
+  0x0e,0xe5,0xcf,0xbd,0xbb,0xeb,0xab,0x8a,0xea,0x9a,0xd7,0xa3,0xe3,0x93,0xdd,0xbd,0xa8,0x72,0xcd,0x4e,
+  0x17,0xf2,0x7c,0x38,0xef,0xc8,0xd9,0x78,0x58,0xe5,0xc7,0x57,0xce,0x62,0xfe,0x34,0xb0,0x4c,0xa7,0x2c,
+  0x66,0xf2,0x64,0xb8,0xdb,0xb3,0xe4,0xd3,0xd3,0xe0,0xcc,0x3d,0x5c,0x7a,0x97,0xf7,0x83,0xf0,0xb2,0x3b,
+  0x92,0xa7,0xf4,0xf3,0x95,0x73,0x74,0x10,0x88,0xdd,0x59,0xef,0xfb,0x4f,0xd1,0x63,0x63,0x21,0x66,0xdf,
+  0xec,0x41,0xe8,0x5c,0x95,0x1f,0x76,0xba,0xdf,0xa7,0x9d,0xca,0xc1,0xf2,0xfb,0xcd,0x3c,0xa8,0xee,0x5e,
+  0x5d,0xd8,0xfe,0x83,0x9c,0x3b,0xed,0xe1,0xf2,0xe0,0xa1,0x56,0x1b,0x3e,0x5d,0x8d,0xcf,0xe5,0xae,0x08,
+  0xc2,0xe5,0xd9,0x60,0x10,0xd4,0x16,0xd1,0xb8,0xdf,0x2e,0xf7,0x26,0xdf,0x6f,0x27,0x37,0x33,0x7f,0xcf,
+  0xe9,0x1c,0x4d,0x1f,0x87,0x6d,0xd1,0x3e,0x99,0x1d,0x2f,0xc2,0xae,0xf5,0x55,0xb8,0xed,0xd3,0x4e,0xef,
+  0x48,0xb8,0x17,0x77,0x95,0x6a,0xd4,0x3e,0x3e,0x0b,0xee,0x9f,0xcc,0xde,0x71,0xe5,0xe1,0x22,0xda,0xb9,
+  0x5a,0x4c,0xc4,0x41,0xef,0xdc,0x29,0x73,0x77,0x5f,0x1e,0x1d,0x8e,0xfd,0x45,0xc4,0x86,0x7d,0xd6,0xbe,
+  0x73,0x86,0xfb,0xdd,0x9b,0x9d,0xc1,0xcf,0x65,0x6d,0xff,0xe6,0xd6,0x2e,0x2f,0x97,0xb4,0x1b,0x2d,0x22,
+  0x73,0x7f,0xbc,0x73,0xd1,0x8b,0x0e,0xc2,0xb3,0xf9,0xb5,0xdb,0x39,0x98,0x1c,0xf6,0x7f,0xdc,0x1f,0x9d,
+  0x9d,0xd4,0xee,0xc6,0xb5,0x03,0x76,0x74,0x7e,0x37,0x98,0x71,0xe1,0x0c,0xc6,0x83,0xe3,0xea,0xe8,0xa8,
+  0xb6,0x4f,0x77,0x35,0xfe,0x9d,0xb3,0xeb,0x9b,0x5a,0x3f,0x78,0x3c,0x73,0x1c,0xa7,0xd5,0x32,0xca,0x90,
+  0xd0,0xa1,0x5a,0xc6,0x99,0x89,0x09,0xfe,0x3b,0x7c,0x13,0xa2,0xf3,0xae,0x4e,0xaa,0x95,0xca,0x07,0xf2,
+  0x8e,0xfb,0x98,0xa2,0x54,0xa8,0x86,0xde,0x73,0x19,0x77,0x5c,0x55,0x27,0xb5,0x37,0xf6,0x6c,0xc8,0xe2,
+  0x6d,0x9b,0xfa,0xdc,0x5b,0xd6,0xc9,0x98,0xba,0xd2,0xa7,0xf1,0x86,0xc5,0xc3,0xa9,0x47,0x61,0x91,0x0b,
+  0xc8,0x5b,0xb6,0x3d,0xf1,0xa4,0xf9,0x18,0x6f,0x99,0xd2,0x93,0x41,0x9d,0xbc,0xdf,0x3d,0xa4,0x93,0xbd,
+  0x5a,0xbc,0xe6,0xd3,0xc0,0xe1,0xa2,0x4e,0x2a,0xa5,0x1a,0xf3,0x49,0x05,0xff,0xe3,0xc6,0xf3,0x16,0x6a,
+  0x9a,0x15,0xa7,0x01,0x2b,0x4e,0x8b,0x50,0x6d,0x3e,0xf9,0x7d,0xf3,0x7c,0x2c,0x3e,0xa5,0x96,0x05,0xbe,
+  0xd7,0x57,0x52,0x25,0xac,0xaf,0x40,0x7a,0x1e,0x0b,0x5e,0x88,0xd0,0x48,0xc9,0xc6,0xba,0xd3,0x47,0xfb,
+  0x1f,0x36,0x1d,0x45,0x14,0x52,0x3d,0x1e,0x9d,0x30,0x2f,0xd1,0x90,0xfa,0x24,0xa4,0x60,0xd9,0x3d,0x21,
+  0x13,0xd6,0xf6,0x24,0x52,0x4a,0x8a,0x22,0x29,0x09,0x2c,0x62,0x2e,0xa6,0x50,0x9b,0xb1,0xcc,0x84,0x9a,
+  0x8f,0x4e,0x20,0x23,0x38,0xf4,0x96,0xdf,0x13,0x19,0x58,0x2c,0xd8,0x0e,0xa8,0xc5,0xa3,0x10,0xdd,0xaf,
+  0x82,0xff,0xeb,0x5b,0x75,0x92,0xde,0x96,0x01,0x37,0x77,0xb9,0x62,0x2f,0xfd,0x2e,0x55,0x11,0xb7,0xd2,
+  0x4e,0x2a,0xad,0x03,0x83,0x3c,0x50,0x27,0x3b,0xa5,0xda,0xc6,0xea,0x3c,0x71,0x73,0x22,0x3d,0xeb,0x2d,
+  0x37,0x12,0xcb,0xcd,0x28,0x08,0xf1,0xba,0xa9,0xe4,0xc0,0x54,0xc1,0x06,0x64,0x3b,0xb5,0x04,0x32,0xdb,
+  0x93,0x14,0x54,0x05,0xa8,0xf1,0x2d,0x5d,0x75,0x57,0xce,0xb2,0x08,0xbc,0x81,0x45,0xa5,0x72,0x70,0x70,
+  0x68,0xbf,0x29,0x49,0x4d,0xc5,0x67,0xec,0xd7,0xa2,0xb6,0x6d,0x6f,0xe6,0xd3,0xa1,0x49,0xcd,0xc9,0x6e,
+  0xa6,0xeb,0x55,0x28,0x12,0xdb,0x0f,0x56,0xc1,0x5d,0x3b,0xf3,0x37,0x0d,0x5d,0x13,0xfc,0x8b,0x76,0xa2,
+  0xd8,0xfb,0x53,0x61,0xcb,0xde,0xe9,0x6d,0x72,0x78,0x2a,0x43,0xa0,0x79,0x70,0x15,0x59,0x9d,0xa2,0x96,
+  0xc6,0xcb,0x62,0x4c,0x53,0x01,0x10,0xf1,0x61,0x25,0x8d,0xa3,0x92,0x53,0x78,0x5b,0xc5,0xd5,0xf4,0x18,
+  0x0d,0x30,0xa2,0xca,0x7d,0x95,0x18,0xba,0xa0,0xf4,0x67,0x26,0x8e,0xae,0x42,0xe4,0xe6,0x75,0x12,0x9a,
+  0x58,0x23,0x8d,0xad,0xdf,0x36,0x0a,0x39,0x6e,0x6f,0x34,0x2c,0x92,0xab,0x40,0x0e,0x60,0xe7,0x8e,0x0b,
+  0x4b,0xce,0xe1,0x9d,0xe4,0x2e,0x22,0x93,0x5b,0x34,0xed,0x80,0xb9,0x22,0xc9,0x75,0x65,0x14,0x70,0xc0,
+  0xee,0x2b,0x9b,0xc3,0xab,0x2f,0x85,0x0c,0xa7,0xd4,0x64,0xaf,0xf2,0xf0,0x08,0xdd,0xf9,0xed,0x75,0x15,
+  0xac,0x23,0x53,0xaf,0x43,0x7a,0x4e,0x1e,0x39,0xc8,0x68,0xcb,0x26,0x34,0x78,0x51,0x7c,0x64,0x55,0x7d,
+  0xf0,0xf1,0x0f,0x9f,0x59,0x9c,0xa2,0x1b,0x8c,0x09,0x42,0x85,0x45,0xf2,0x3e,0x17,0xdb,0x2b,0x04,0x2b,
+  0xd3,0x45,0x21,0x59,0xa7,0x8b,0x74,0x7d,0xa7,0xb2,0x77,0x88,0xeb,0xb1,0x66,0x64,0xc1,0xe4,0x31,0x65,
+  0x89,0xed,0x97,0x00,0x3f,0xeb,0xcf,0xd7,0xa4,0xb2,0xca,0xaa,0xb4,0x22,0xd6,0xb8,0x49,0x53,0xcd,0xea,
+  0x63,0x5d,0xd3,0x8b,0x4c,0xd8,0xc0,0x69,0x15,0xf7,0x67,0xed,0x66,0xb3,0x9c,0x10,0x76,0xb3,0x1c,0x8f,
+  0x22,0xcd,0x89,0xb4,0x96,0xf0,0xa5,0xf9,0x10,0xe2,0x10,0x4d,0x7c,0x0e,0x83,0x44,0xc0,0x54,0x14,0x08,
+  0x62,0x53,0x2f,0x64,0x0d,0x18,0x19,0x9a,0xc0,0x9c,0x90,0x19,0x34,0x84,0x51,0x60,0x65,0x38,0x6c,0x68,
+  0xdd,0xcd,0x98,0xd9,0x40,0x07,0x8c,0x20,0x6c,0x92,0xc4,0xd3,0xf8,0x62,0x26,0xa3,0x8d,0x4e,0xee,0x66,
+  0x59,0x9f,0x4a,0x45,0xe2,0x6a,0xe2,0xd6,0x86,0x44,0x7a,0xc5,0xaa,0x24,0x0c,0x30,0xca,0x96,0x66,0x04,
+  0x8b,0xdc,0x26,0x79,0xe5,0xf2,0xb0,0x34,0xa3,0x5e,0xc4,0x5a,0x2d,0x48,0x16,0xdf,0x87,0x70,0xe4,0x0a,
+  0x64,0xb5,0x4c,0x5a,0x24,0x97,0x43,0xa1,0x89,0x17,0x05,0x6f,0xc8,0xbc,0x3a,0x9c,0x2a,0x49,0x47,0x1f,
+  0xc5,0x16,0x70,0x69,0x7c,0xdc,0x48,0x36,0x61,0x0f,0x07,0xb0,0x96,0xd1,0x47,0xf6,0x02,0x92,0xd0,0xab,
+  0x21,0xf9,0x11,0x85,0x8a,0xd0,0x90,0x2c,0x65,0x44,0xe6,0x32,0xf2,0x2c,0xf0,0x94,0x40,0x06,0xb1,0x00,
+  0x06,0xae,0x34,0xad,0x4b,0x5b,0x77,0x2e,0xe6,0x13,0x14,0x66,0x38,0x85,0x25,0x46,0x5c,0x10,0x99,0x60,
+  0x8e,0x05,0xcc,0x64,0x50,0xa9,0x56,0x51,0xdb,0x14,0xc3,0x04,0x49,0xe0,0x79,0x78,0x96,0xa9,0x52,0x86,
+  0x6f,0x42,0xa6,0x52,0x98,0x1e,0x37,0x1f,0x61,0x68,0x03,0x6e,0x4b,0x6c,0xcb,0x17,0x32,0xd4,0xd6,0x18,
+  0x2f,0xf5,0x26,0x8e,0x67,0x66,0x7f,0x17,0xc5,0xa1,0x37,0x05,0x0c,0xca,0x9e,0xe0,0x79,0xb8,0x99,0xa5,
+  0x0e,0x95,0xe0,0xb2,0x3c,0x4c,0xa1,0xd0,0x13,0xc8,0x47,0x4f,0x35,0x18,0x7a,0xfb,0xd1,0x51,0x0d,0x62,
+  0x07,0xd2,0xd7,0x27,0xb5,0x89,0x05,0xe3,0xcb,0x08,0x44,0x9b,0xe5,0xf8,0x2e,0x3d,0x50,0x42,0x57,0xd5,
+  0xc1,0x4c,0x72,0x31,0xbb,0xf1,0x5b,0xa4,0xd0,0x29,0x47,0xb2,0x50,0xdf,0x0b,0x3e,0x35,0xcb,0x70,0x18,
+  0x33,0x10,0x72,0x0a,0xbf,0x30,0xf5,0xc0,0xd1,0x26,0x14,0x1e,0x9f,0x2a,0x78,0x2a,0x97,0x89,0x86,0x0c,
+  0x61,0xfd,0x64,0xc9,0x4f,0x24,0x54,0x91,0x6d,0x17,0xb5,0x01,0xc6,0xb7,0x73,0x63,0x85,0x64,0xa8,0xe8,
+  0x32,0xd4,0x93,0x33,0x05,0xb2,0xf0,0xc1,0x60,0x7d,0x4a,0xe8,0xa3,0x3e,0xe5,0x62,0x75,0x14,0xf0,0x85,
+  0xfe,0x62,0x31,0xab,0x54,0xc2,0x0b,0xc6,0x08,0xb8,0xc5,0x6c,0x98,0x27,0x42,0xc2,0x16,0x40,0xbc,0xde,
+  0x92,0xb8,0x72,0x0e,0x87,0x84,0x03,0xe2,0x54,0x11,0x23,0xd6,0x68,0x80,0x68,0x89,0xf4,0x98,0x4d,0x23,
+  0x4f,0xa1,0x9a,0x9d,0x5a,0xc5,0x0f,0x41,0x47,0x6c,0x27,0x87,0xfc,0x9e,0xb3,0x1c,0xb8,0x8f,0xee,0xc1,
+  0xb8,0x6d,0x13,0x80,0x6f,0x4e,0x43,0x91,0x53,0x31,0x97,0x16,0x57,0xc8,0x11,0x0b,0x70,0xc0,0x8d,0x4f,
+  0x7a,0xe7,0x13,0x89,0x84,0xe2,0xde,0x7a,0x6e,0x80,0xfe,0x34,0x2b,0xb4,0x9d,0x23,0xa9,0x61,0x70,0x29,
+  0xb4,0x05,0x0a,0x81,0x8a,0xa6,0x70,0x9f,0xb4,0x89,0xc7,0x66,0xcc,0x0b,0xf1,0xc9,0x62,0x93,0xc8,0x01,
+  0x92,0x70,0x20,0x73,0x94,0x2b,0xe1,0x92,0x69,0x00,0x5d,0x16,0x17,0xf0,0x85,0x92,0xc9,0x52,0x31,0xd4,
+  0xb5,0x35,0x03,0x02,0x8c,0xa6,0x30,0xbc,0xb3,0x1e,0xf4,0x88,0x25,0x64,0x3f,0xb8,0xd2,0xd0,0x78,0x8f,
+  0x03,0xa8,0x86,0x79,0xe2,0x4c,0x7a,0x9b,0x87,0xbd,0x08,0xee,0x11,0x0a,0x80,0x0e,0x18,0xf5,0x49,0x3e,
+  0xc9,0x14,0xd4,0x8c,0xee,0xc0,0x2b,0xc0,0x07,0xa9,0x14,0x85,0x05,0xc0,0x15,0x2f,0x98,0x46,0xa1,0xcb,
+  0x2c,0xd0,0x1d,0x73,0x87,0xd6,0xfe,0x4d,0x40,0x13,0x71,0x98,0x0e,0x40,0x91,0x58,0x81,0x9c,0xc6,0x69,
+  0xa7,0xa7,0x02,0x60,0x63,0xf0,0x18,0xe1,0x07,0xab,0xe5,0x7a,0x3e,0x26,0x98,0x61,0x78,0xb9,0x08,0x71,
+  0x50,0xc4,0xac,0x06,0xc7,0xe0,0xaa,0xb9,0xee,0x22,0x25,0x29,0x50,0x27,0xdc,0x96,0xd7,0x76,0x16,0x48,
+  0xeb,0x8b,0xa6,0x41,0x0b,0x28,0x03,0x83,0x57,0x7a,0x8a,0x58,0xb0,0x1c,0x31,0x0f,0x6e,0x90,0x41,0xde,
+  0x78,0xbf,0x46,0x36,0x85,0x92,0x26,0x96,0x7c,0x01,0x09,0xd2,0x61,0x2a,0x29,0xa8,0x0b,0x1e,0xaa,0x6c,
+  0xad,0x8f,0x5a,0xf5,0x91,0xe7,0x04,0x28,0x30,0xcf,0xe6,0x01,0xd4,0xbd,0xe2,0x3e,0xd3,0xb1,0x99,0x71,
+  0x68,0xbd,0x45,0xfd,0x08,0x12,0x1a,0x37,0xd8,0x86,0xc8,0x64,0x3c,0x91,0xa7,0x36,0xf2,0x06,0x66,0x15,
+  0x24,0x88,0xca,0x41,0xf9,0x7b,0x54,0x3c,0x22,0x64,0x76,0x24,0x4c,0xec,0xdb,0xaf,0x0c,0xd0,0x6e,0x20,
+  0xa0,0xed,0xb3,0xf6,0x3d,0x38,0x28,0xd8,0x9c,0xdc,0x5f,0x5e,0x9c,0x28,0x35,0xbd,0x66,0xe0,0x55,0x6a,
+  0x24,0x6e,0x03,0x0c,0x10,0x1e,0x6b,0x09,0x18,0x29,0x66,0xba,0x54,0x38,0x48,0x6d,0xa9,0xea,0x7c,0xda,
+  0x9c,0xb8,0x1d,0x73,0xa1,0x3e,0x3b,0xc2,0xb3,0xa4,0xd5,0x22,0x7b,0xe4,0xe3,0xc7,0x98,0x13,0x51,0x3c,
+  0x0a,0x71,0x6d,0xa7,0x52,0xc9,0x56,0xd3,0xd4,0x1c,0x03,0x31,0x16,0xb2,0x1e,0x03,0xf3,0x86,0xba,0x1c,
+  0x1d,0xe7,0x5f,0x1f,0x59,0x6b,0x37,0x2b,0xfb,0xa6,0x4c,0xe4,0x8d,0xe3,0xfe,0xd8,0x28,0x12,0x23,0xe9,
+  0x0a,0x3d,0xf8,0x11,0x09,0xaf,0x0a,0x32,0x6f,0xe5,0x08,0x52,0x92,0x46,0x5b,0x83,0x7d,0x81,0x09,0xb8,
+  0x99,0x72,0xc5,0x94,0x8b,0xa0,0x50,0x12,0x45,0x45,0x82,0xf5,0x2f,0x96,0x73,0xcd,0x6b,0x50,0x15,0xec,
+  0x05,0xae,0x69,0x10,0xb5,0xf1,0xd8,0x11,0xde,0x25,0xd9,0xa3,0x37,0x46,0x30,0x72,0x98,0xac,0x40,0xe2,
+  0x96,0xd7,0x48,0x50,0xd7,0xe9,0x14,0x26,0xb8,0xaf,0x9d,0xcb,0x1b,0xf1,0x8e,0xa1,0x6d,0x8e,0x9f,0x01,
+  0x7e,0x74,0xf0,0x05,0xe4,0xab,0x4a,0x40,0x17,0x1b,0x31,0x1a,0x99,0x00,0x0b,0x02,0xb0,0xfa,0x57,0x12,
+  0x71,0xed,0x6c,0x88,0xc0,0x10,0xa6,0xcd,0xc0,0xec,0xc0,0x3f,0x0c,0xe4,0x0d,0x28,0xbd,0x10,0xaa,0x0a,
+  0x30,0xcc,0x94,0xb0,0xc2,0x6a,0x1c,0xd4,0xe1,0x61,0x25,0xfc,0xad,0xae,0x6d,0x7d,0xce,0x60,0x1d,0xbd,
+  0xe4,0xfd,0x35,0xb8,0x36,0x3a,0xcb,0xff,0x3a,0x07,0x57,0xe9,0x96,0xf5,0xf1,0xf5,0x54,0x23,0xef,0x5a,
+  0xc4,0x30,0x56,0x87,0x08,0x01,0xe7,0x00,0xa4,0x60,0x09,0x47,0x81,0xfe,0xd2,0xaa,0x03,0xe2,0xd1,0x3f,
+  0x1b,0xe1,0xce,0x47,0x24,0x58,0x3b,0x23,0x1d,0x08,0xba,0x76,0x03,0x88,0x54,0x78,0xcb,0x52,0xa6,0xe7,
+  0x97,0xd9,0x5d,0x82,0xc1,0x91,0xab,0x7c,0xee,0x5f,0x22,0x57,0xf8,0x67,0xe5,0xdf,0x85,0x74,0x4e,0x7b,
+  0x4e,0xbe,0xff,0x36,0xef,0xfc,0x75,0xa1,0x74,0x62,0x31,0x8c,0x54,0x0e,0xbc,0x6d,0xc7,0x4c,0x92,0x15,
+  0x09,0x8e,0x16,0x42,0xa6,0xf4,0x2c,0xb1,0x17,0x81,0x6f,0x73,0xd1,0x40,0x5a,0xa7,0xe1,0xa3,0xf6,0x1d,
+  0x11,0x81,0xf1,0x02,0x5b,0x44,0x58,0x2a,0xad,0x21,0xfc,0x2e,0x49,0xc0,0x3f,0xfe,0x20,0xfe,0x32,0xc9,
+  0x02,0x0c,0x85,0xf1,0x6e,0x03,0xe5,0xa4,0x7a,0x40,0xc5,0x18,0x38,0x10,0xee,0xca,0xbf,0x8e,0x73,0xfc,
+  0x6f,0x45,0x6a,0x23,0x1d,0xd7,0x95,0xcf,0x00,0x59,0x71,0xbd,0x19,0xbd,0x40,0x32,0xa3,0x0f,0xcc,0xbe,
+  0x35,0x5b,0xfe,0x0e,0x56,0x28,0xbe,0x2e,0x9a,0x3d,0x43,0x44,0x61,0xfc,0x37,0x59,0xdb,0xf3,0xf2,0xb9,
+  0x0f,0xf8,0xb3,0xe3,0xc3,0x4e,0x2d,0xa7,0x2d,0x40,0x14,0x36,0x5d,0x47,0xcf,0x37,0xd4,0x00,0x18,0x0d,
+  0x6d,0x5f,0x42,0x3f,0x25,0x4f,0x3a,0x79,0x03,0x6b,0x0a,0x73,0x2e,0x39,0x57,0x27,0x06,0xf9,0xbc,0x12,
+  0x2b,0xbc,0xc9,0x84,0xd9,0xf6,0x9f,0xb3,0xe0,0x15,0xce,0x6c,0x51,0xdc,0x32,0x2f,0x28,0xb4,0x96,0xcb,
+  0xb8,0xf0,0xdf,0xee,0x1e,0x29,0xd0,0xff,0xe7,0xb5,0xbb,0x9e,0x27,0xff,0xad,0x97,0xbc,0x4a,0x8a,0xd7,
+  0x3d,0x05,0x71,0xb9,0xcc,0xf8,0xf0,0x4f,0xd1,0x84,0xcb,0x60,0x9c,0xc0,0xa1,0x93,0x6a,0xe8,0x92,0x99,
+  0x03,0x07,0x57,0x02,0x93,0xeb,0x3a,0xaa,0xa9,0x61,0x09,0xd3,0x16,0x36,0x47,0x0b,0xec,0x2c,0x1e,0xc3,
+  0xc7,0xce,0xf2,0xd4,0xca,0x67,0xa3,0x6f,0xa1,0xc4,0x05,0x10,0xf4,0xc9,0xf8,0xf2,0x02,0xb3,0x2e,0x96,
+  0xd5,0xd7,0xc3,0xaf,0xaf,0x64,0xc6,0x85,0xd9,0x39,0xfe,0xdd,0x55,0x8e,0xff,0x30,0xbc,0xf5,0x1f,0x07,
+  0xf1,0x9d,0xd7,0x31,0x16,0x00,0x00,
+};
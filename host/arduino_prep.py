@@ -0,0 +1,169 @@
+#!/usr/bin/env python3
+"""
+  A part of ESP32 Signal Generator (host build)
+
+  Turn SignalGenerator.ino into a plain C++ file, the way the Arduino IDE does before it compiles:
+  #include <Arduino.h> at the top and a prototype for every top-level function, inserted just above
+  the first one. Default arguments are left off the prototypes, so (just like the IDE) a function
+  with defaults must be defined before anything calls it without them.
+
+    arduino_prep.py SignalGenerator.ino sketch.cpp
+    arduino_prep.py SignalGenerator.ino sketch.cpp --without BUTTONS POT
+
+  --without comments out those "#define"s first (see "Build Features" in the sketch), the way
+  you would to build without them.
+"""
+import re
+import sys
+
+KEYWORDS = ("struct", "class", "enum", "union", "namespace", "typedef", "extern")
+
+
+def scan(src):
+    """Yield (kind, text, line) for every top-level '{' head and preprocessor line."""
+    i, n, line = 0, len(src), 1
+    depth = 0
+    head, head_line = "", None
+    at_line_start = True
+    while i < n:
+        c = src[i]
+        if c == "\n":
+            line += 1
+            at_line_start = True
+            if depth == 0 and head:
+                head += " "
+            i += 1
+            continue
+        if at_line_start and c in " \t":
+            i += 1
+            continue
+        if at_line_start and c == "#":
+            j = i
+            text = ""
+            while j < n:
+                k = src.find("\n", j)
+                if k == -1:
+                    k = n
+                text += src[j:k]
+                if text.endswith("\\"):
+                    text = text[:-1]
+                    line += 1
+                    j = k + 1
+                    continue
+                j = k
+                break
+            yield ("pre", text.strip(), line)
+            i = j
+            continue
+        at_line_start = False
+        if src.startswith("//", i):
+            k = src.find("\n", i)
+            i = n if k == -1 else k
+            continue
+        if src.startswith("/*", i):
+            k = src.find("*/", i + 2)
+            line += src.count("\n", i, k)
+            i = k + 2
+            continue
+        m = re.match(r'R"([^(\s]*)\(', src[i:i + 40]) if c == "R" else None
+        if m and (i == 0 or not (src[i - 1].isalnum() or src[i - 1] == "_")):
+            end = src.find(")" + m.group(1) + '"', i)
+            line += src.count("\n", i, end)
+            i = end + len(m.group(1)) + 2
+            if depth == 0:
+                head += '""'
+            continue
+        if c in "\"'":
+            j = i + 1
+            while src[j] != c:
+                j += 2 if src[j] == "\\" else 1
+            if depth == 0:
+                head += src[i:j + 1]
+            i = j + 1
+            continue
+        if c == "{":
+            if depth == 0:
+                yield ("brace", head.strip(), head_line)
+            depth += 1
+        elif c == "}":
+            depth -= 1
+            if depth == 0:
+                head, head_line = "", None
+        elif depth == 0:
+            if c == ";":
+                head, head_line = "", None
+            else:
+                if not head.strip() and not c.isspace():
+                    head_line = line
+                head += c
+        i += 1
+
+
+def split_params(params):
+    out, level, cur = [], 0, ""
+    for c in params:
+        if c in "(<[{":
+            level += 1
+        elif c in ")>]}":
+            level -= 1
+        if c == "," and level == 0:
+            out.append(cur)
+            cur = ""
+        else:
+            cur += c
+    if cur.strip():
+        out.append(cur)
+    return out
+
+
+def prototype(head):
+    head = re.sub(r"\s+", " ", head).strip()
+    if not head or any(re.match(r"(template\s*<.*>\s*)?%s\b" % k, head) for k in KEYWORDS):
+        return None
+    m = re.match(r"^([\w:<>\*&\s,]+?[\s\*&])(\w+)\s*\((.*)\)\s*(const)?$", head)
+    if not m or "=" in m.group(1) or m.group(2) in ("if", "while", "for", "switch"):
+        return None
+    params = [p.split("=")[0].strip() for p in split_params(m.group(3))]
+    return "%s%s(%s);" % (m.group(1), m.group(2), ", ".join(params))
+
+
+def main(source, target, without=()):
+    src = open(source).read()
+    for name in without:
+        src, found = re.subn(r"^#define %s\b" % name, "//#define %s" % name, src, flags=re.M)
+        if not found:
+            sys.exit("arduino_prep.py: no #define %s in %s" % (name, source))
+    conds, protos, insert = [], [], None
+    for kind, text, line in scan(src):
+        if kind == "pre":
+            word = text[1:].strip().split(" ")[0]
+            if word.startswith("if"):
+                conds.append([text, False])
+            elif word in ("else", "elif") and conds:
+                conds[-1][1] = True
+            elif word == "endif" and conds:
+                conds.pop()
+            continue
+        proto = prototype(text)
+        if proto is None:
+            continue
+        if insert is None and not conds:
+            insert = line
+        wrapped = ""
+        for cond, in_else in conds:
+            wrapped += cond + "\n" + ("#else\n" if in_else else "")
+        wrapped += proto + "\n" + "#endif\n" * len(conds)
+        protos.append(wrapped)
+
+    lines = src.split("\n")
+    with open(target, "w") as out:
+        out.write('#include <Arduino.h>\n#line 1 "%s"\n' % source)
+        out.write("\n".join(lines[:insert - 1]) + "\n")
+        out.write("".join(protos))
+        out.write('#line %d "%s"\n' % (insert, source))
+        out.write("\n".join(lines[insert - 1:]))
+
+
+if __name__ == "__main__":
+    without = sys.argv[sys.argv.index("--without") + 1:] if "--without" in sys.argv else []
+    main(sys.argv[1], sys.argv[2], without)
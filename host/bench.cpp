@@ -0,0 +1,282 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  loop() benchmark. Runs setup(), then feeds the same commands in each of the three ways they can
+  arrive (typed at the Serial console, as web requests, and as a ";" chain in QCommand) and times
+  loop() while it works through them. Then plays them as a compiled loop/macro, and last, sets
+  the frequency one command at a time (waiting for each answer, like test equipment would), as
+  text lines and then as binary frames (see "Binary Mode" in the README)..
+
+    ./bench                     2000 of each, the default mix
+    ./bench 10000               10000 of each
+    ./bench 5000 1k p30 t 2k    5000 of each, your mix (repeated in order)
+    SG_ECHO=1 ./bench 10        .. and show the sketch's Serial output
+
+  For each source you get commands per second, microseconds per pass of loop() (average, 99th
+  percentile and worst) and heap allocations per command. The loop gets instructions per second
+  (and allocations per instruction) instead. Text versus binary gets set-and-check operations per
+  second, and the bytes each way per operation, which is what limits it on the board; so you also
+  get what 115200 baud allows. The allocations are counted (every
+  malloc() and new the sketch makes, not a change in free heap), which is what fragments the ESP32's
+  heap over a long run. The serial port, web server and NVS stubs keep their own buffers out of the
+  count, so web numbers are the handlers' share only; the real WebServer allocates for parsing, too.
+
+  This is a PC, so the times are only good for comparing one build with another; the allocation
+  counts carry straight over (give or take the String class; see stubs/Arduino.h).
+                                                                                    */
+#include <Arduino.h>
+#include <algorithm>
+#include <string.h>
+#include <string>
+#include <vector>
+#include "host.h"
+
+// From the sketch..
+extern String QCommand;
+extern bool amDelaying;
+extern bool iLooping;
+extern uint32_t loopInstructions;
+extern uint16_t loopLength;
+uint8_t commandsWaiting();
+uint16_t crc16(const uint8_t *data, uint8_t length);
+bool setLoop(const String &commands);
+void rewindLoop();
+void endLoop();
+
+static std::vector<std::string> mix = { "r", "1k", "p30", "2k", "p60", "]", "[", "/", "\\", "1500", "p50", "b8" };
+
+struct Run {
+  const char *name;
+  uint32_t commands;
+  double seconds;
+  std::vector<uint32_t> passes;   // ns per loop() pass
+  uint64_t allocations;
+  const char *unit = "commands";
+};
+
+static bool idle() {
+  return hostSerialPending() == 0 && hostWebPending() == 0 && QCommand == "" && commandsWaiting() == 0 && !amDelaying;
+}
+
+static uint32_t timedPass(Run &run) {
+  int64_t start = hostTrueMicros();
+  loop();
+  uint32_t ns = (uint32_t)((hostTrueMicros() - start) * 1000);
+  run.passes.push_back(ns);
+  return ns;
+}
+
+static void report(Run &run) {
+  std::vector<uint32_t> &p = run.passes;
+  std::sort(p.begin(), p.end());
+  double total = 0;
+  for (uint32_t ns : p) total += ns;
+  std::string unit = run.unit;
+  printf("  %-8s %7u %-12s in %7.3fs  %9.0f %-14s  loop(): %6zu passes, %7.2fus average, %7.2fus 99%%, %8.2fus max   %6.2f allocations/%s\n",
+         run.name, run.commands, unit.c_str(), run.seconds, run.commands / run.seconds, (unit + "/s").c_str(), p.size(),
+         p.empty() ? 0 : total / p.size() / 1000.0, p.empty() ? 0 : p[p.size() * 99 / 100] / 1000.0,
+         p.empty() ? 0 : p.back() / 1000.0, run.allocations / (double)run.commands, unit.substr(0, unit.size() - 1).c_str());
+}
+
+// A binary mode frame: sync, length, op, payload, CRC..
+static std::string binaryFrame(uint8_t op, const void *payload, uint8_t size) {
+  uint8_t body[34] = { (uint8_t)(size + 1), op };
+  memcpy(body + 2, payload, size);
+  uint16_t crc = crc16(body, size + 2);
+  std::string frame(1, (char)0xA5);
+  frame.append((const char *)body, size + 2);
+  frame += (char)(crc & 0xFF);
+  frame += (char)(crc >> 8);
+  return frame;
+}
+
+// One set-and-check at a time; <send> makes the request, <done> says when the whole answer is in..
+template <typename Send, typename Done>
+static void setAndCheck(Run &run, uint64_t &bytesIn, uint64_t &bytesOut, Send send, Done done) {
+  std::string answer;
+  HostHeap before = hostHeap();
+  int64_t start = hostTrueMicros();
+  for (uint32_t i = 0; i < run.commands; i++) {
+    std::string request = send(i);
+    bytesIn += request.size();
+    hostSerialInput(request);
+    answer.clear();
+    for (int guard = 0; guard < 100000 && !done(answer); guard++) {
+      timedPass(run);
+      answer += hostSerialTake();
+    }
+    bytesOut += answer.size();
+  }
+  run.seconds = (hostTrueMicros() - start) / 1e6;
+  run.allocations = hostHeap().allocations - before.allocations;
+}
+
+static void wireReport(const Run &run, uint64_t bytesIn, uint64_t bytesOut) {
+  double perOp = (bytesIn + bytesOut) / (double)run.commands;
+  printf("           (%.1f bytes in, %.1f bytes out per operation; at 115200 baud that's %.0f operations/s)\n",
+         bytesIn / (double)run.commands, bytesOut / (double)run.commands, 11520.0 / perOp);
+}
+
+static void settle() {
+  for (int i = 0; i < 100000 && !idle(); i++) loop();
+  for (int i = 0; i < 100; i++) loop();
+  hostSerialTake();
+}
+
+int main(int argc, char **argv) {
+
+  uint32_t count = (argc > 1) ? atoi(argv[1]) : 2000;
+  if (count == 0) count = 2000;
+  if (argc > 2) mix.assign(argv + 2, argv + argc);
+
+  hostI2SPaced = false;
+  hostSerialEcho = (getenv("SG_ECHO") != NULL);   // To see what the sketch says
+  setup();
+  settle();
+
+  printf("\n ESP32 Signal Generator loop() benchmark (host build): %u commands from each source, mix:", count);
+  for (auto &c : mix) printf(" %s", c.c_str());
+  printf("\n\n");
+
+  // Nothing to do; what a pass costs on its own..
+  {
+    Run run = { "idle", 10000, 0, {}, 0 };
+    run.passes.reserve(10000);
+    HostHeap before = hostHeap();
+    int64_t start = hostTrueMicros();
+    for (uint32_t i = 0; i < run.commands; i++) timedPass(run);
+    run.seconds = (hostTrueMicros() - start) / 1e6;
+    run.allocations = hostHeap().allocations - before.allocations;
+    run.commands = run.passes.size();
+    printf("  %-8s %7zu passes, %7.2fus average", run.name, run.passes.size(), run.seconds * 1e6 / run.passes.size());
+    std::sort(run.passes.begin(), run.passes.end());
+    printf(", %.2fus max, %.3f allocations/pass\n\n", run.passes.back() / 1000.0, run.allocations / (double)run.commands);
+  }
+
+  // Typed at the console (the lot, up front; the sketch only takes what the queue has room for)..
+  {
+    std::string input;
+    for (uint32_t i = 0; i < count; i++) input += mix[i % mix.size()] + "\n";
+    hostSerialInput(input);
+    Run run = { "serial", count, 0, {}, 0 };
+    run.passes.reserve(count * 4);
+    HostHeap before = hostHeap();
+    int64_t start = hostTrueMicros();
+    while (!idle()) timedPass(run);
+    run.seconds = (hostTrueMicros() - start) / 1e6;
+    run.allocations = hostHeap().allocations - before.allocations;
+    report(run);
+    settle();
+  }
+
+  // From the web (as /URL commands, a few at a time, like a busy page would send them)..
+  if (!hostWebStarted) {
+    printf("  web      (no web server in this build; REMOTE is off)\n");
+  } else {
+    Run run = { "web", count, 0, {}, 0 };
+    run.passes.reserve(count * 4);
+    std::vector<int> clients;
+    clients.reserve(count);
+    HostHeap before = hostHeap();
+    int64_t start = hostTrueMicros();
+    uint32_t sent = 0;
+    while (sent < count || !idle()) {
+      if (sent < count && hostWebPending() < 4) {
+        std::string command = mix[sent % mix.size()];
+        std::string uri = "/";
+        for (char c : command) {
+          char hex[4];
+          snprintf(hex, sizeof(hex), "%%%02X", (uint8_t)c);
+          uri += isalnum((uint8_t)c) ? std::string(1, c) : std::string(hex);
+        }
+        clients.push_back(hostWebRequest("GET", uri));
+        sent++;
+      }
+      timedPass(run);
+    }
+    run.seconds = (hostTrueMicros() - start) / 1e6;
+    run.allocations = hostHeap().allocations - before.allocations;
+    uint32_t refused = 0;
+    for (int c : clients) if (hostWebResponse(c).find("HTTP/1.1 503") == 0) refused++;
+    report(run);
+    if (refused) printf("           (%u refused with 503; the queue was full)\n", refused);
+    settle();
+  }
+
+  // One long chain..
+  {
+    String chain;
+    for (uint32_t i = 0; i < count; i++) {
+      if (i) chain += ";";
+      chain += mix[i % mix.size()].c_str();
+    }
+    Run run = { "QCommand", count, 0, {}, 0 };
+    run.passes.reserve(count * 4);
+    QCommand = chain;
+    HostHeap before = hostHeap();
+    int64_t start = hostTrueMicros();
+    while (!idle()) timedPass(run);
+    run.seconds = (hostTrueMicros() - start) / 1e6;
+    run.allocations = hostHeap().allocations - before.allocations;
+    report(run);
+    settle();
+  }
+
+  // The mix as a compiled loop (like "loop" on the board; compiled once, before the clock starts)..
+  {
+    String commands;
+    for (auto &c : mix) commands += (commands == "") ? c.c_str() : (";" + c).c_str();
+    Run run = { "loop", count, 0, {}, 0, "instructions" };
+    run.passes.reserve(count * 2);
+    if (!setLoop(commands)) {
+      printf("  loop     didn't compile!\n");
+    } else {
+      rewindLoop();
+      iLooping = true;
+      loopInstructions = 0;
+      HostHeap before = hostHeap();
+      int64_t start = hostTrueMicros();
+      while (loopInstructions < count) timedPass(run);
+      run.seconds = (hostTrueMicros() - start) / 1e6;
+      run.allocations = hostHeap().allocations - before.allocations;
+      run.commands = loopInstructions;
+      endLoop();
+      report(run);
+      printf("           (%u instructions compiled)\n", loopLength);
+      settle();
+    }
+  }
+
+  // Set-and-check, text then binary. The text console answers with the settings (all in the same
+  // pass of loop() as the command). A binary answer is always 14 bytes..
+  {
+    printf("\n");
+    uint64_t textIn = 0, textOut = 0, binaryIn = 0, binaryOut = 0;
+    Run text = { "text", count, 0, {}, 0, "operations" };
+    text.passes.reserve(count * 2);
+    setAndCheck(text, textIn, textOut, [](uint32_t i) { return std::to_string(1000 + i % 1000) + "\n"; },
+                [](const std::string &a) { return a.find("Current Settings:") != std::string::npos; });
+    report(text);
+    wireReport(text, textIn, textOut);
+    settle();
+
+    hostSerialInput("binary\n");
+    settle();
+    Run binary = { "binary", count, 0, {}, 0, "operations" };
+    binary.passes.reserve(count * 2);
+    setAndCheck(binary, binaryIn, binaryOut, [](uint32_t i) {
+                  float hz = 1000 + i % 1000;
+                  return binaryFrame(0x01, &hz, sizeof(hz)); },
+                [](const std::string &a) { return a.size() >= 14; });
+    report(binary);
+    wireReport(binary, binaryIn, binaryOut);
+    hostSerialInput(binaryFrame(0x7F, NULL, 0));
+    settle();
+    printf("           (binary is %.1fx text here, %.1fx over the wire)\n",
+           (binary.commands / binary.seconds) / (text.commands / text.seconds),
+           ((textIn + textOut) / (double)text.commands) / ((binaryIn + binaryOut) / (double)binary.commands));
+  }
+
+  printf("\n");
+  hostExit(0);
+}
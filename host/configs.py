@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""
+  A part of ESP32 Signal Generator (host build)
+
+  Build Features, measured. Builds the sketch once for each configuration (everything, then each
+  feature left out on its own, then the lot left out; see "Build Features" in the sketch), runs
+  the loop() benchmark on each and prints a table: code, initialised data and zeroed data (the
+  sketch's own, from size(1)), and how quick loop() is with nothing to do and with serial
+  commands coming in. The builds go in parallel; the benchmarks one at a time, three runs each,
+  and the best of the three counts (a PC's timings wobble).
+
+    make configs              (it needs build/bench.o and build/esp32.o; make does that)
+    make configs COUNT=20000  more commands for each run (default 5000)
+
+  These are x86-64 numbers, from g++; the differences between configurations are what's worth
+  having. On the board, "build" gives you the real flash, RAM and loop() rate for whatever you've
+  built.
+"""
+import concurrent.futures
+import os
+import re
+import subprocess
+import sys
+
+FEATURES = ["BUTTONS", "TOUCH", "POT", "VERBOSE", "SOFT_AP", "REMOTE"]
+CONFIGS = [("everything", [])] + [("no " + f, [f]) for f in FEATURES] + [("headless (none)", FEATURES)]
+
+
+def run(command):
+    return subprocess.run(command, shell=True, check=True, capture_output=True, text=True).stdout
+
+
+def folder(name):
+    return "build/configs/" + re.sub(r"\W+", "_", name).strip("_")
+
+
+def build(name, without, cxx, cxxflags, ldflags):
+    where = folder(name)
+    os.makedirs(where, exist_ok=True)
+    run("python3 arduino_prep.py ../SignalGenerator.ino %s/sketch.cpp %s" %
+        (where, ("--without " + " ".join(without)) if without else ""))
+    run("%s %s -c %s/sketch.cpp -o %s/sketch.o" % (cxx, cxxflags, where, where))
+    run("%s %s build/bench.o %s/sketch.o build/esp32.o -o %s/bench" % (cxx, ldflags, where, where))
+
+
+def measure(name, count):
+    where = folder(name)
+    text, data, bss = [int(v) for v in run("size %s/sketch.o" % where).split("\n")[1].split()[:3]]
+    idle, rate, busy = None, 0, None
+    for attempt in range(3):
+        bench = run("%s/bench %u" % (where, count))
+        passed = float(re.search(r"idle .*?passes,\s+([\d.]+)us average", bench).group(1))
+        serial = re.search(r"serial .*?(\d+) commands/s .*?([\d.]+)us average", bench)
+        idle = passed if idle is None else min(idle, passed)
+        rate = max(rate, int(serial.group(1)))
+        busy = float(serial.group(2)) if busy is None else min(busy, float(serial.group(2)))
+    return text, data, bss, idle, rate, busy
+
+
+def main(cxx, cxxflags, ldflags, count):
+    with concurrent.futures.ThreadPoolExecutor(os.cpu_count()) as pool:
+        for job in [pool.submit(build, name, without, cxx, cxxflags, ldflags) for name, without in CONFIGS]:
+            job.result()
+
+    print("\n ESP32 Signal Generator Build Features (host build, %u serial commands each)\n" % count)
+    print("| Configuration | Code | Data | BSS | Idle pass | Serial commands/s | Serial pass |")
+    print("|---|---:|---:|---:|---:|---:|---:|")
+    base = None
+    for name, without in CONFIGS:
+        text, data, bss, idle, rate, busy = measure(name, count)
+        if base is None:
+            base = text
+        change = "" if text == base else " (%+.1f%%)" % ((text - base) * 100.0 / base)
+        print("| %s | %u%s | %u | %u | %.2fus | %u | %.2fus |" % (name, text, change, data, bss, idle, rate, busy))
+    print()
+
+
+if __name__ == "__main__":
+    main(sys.argv[1], sys.argv[2], sys.argv[3], int(sys.argv[4]) if len(sys.argv) > 4 else 5000)
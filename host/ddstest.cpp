@@ -0,0 +1,166 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  DDS sample stream test. Puts the sketch in triangle DDS mode, asks for a list of frequencies (at
+  the console, the same as you would), and checks what actually comes out of the I2S stream..
+
+    ./ddstest                   the default list (0.01Hz steps, sub-Hz, and up to the DDS limit)
+    ./ddstest 1234.56 0.25      your list
+    SG_ECHO=1 ./ddstest         .. and show the sketch's Serial output
+
+  For each frequency, a few million samples are taken from channel 1 (bits 8-15 of each frame, the
+  byte the DAC plays) and the frequency is measured from the rising mid-level crossings; first to
+  last, interpolated between samples, so the only error is where within a sample each crossing
+  lands. Three things have to hold..
+
+    1. The stream runs at the frequency the sketch says it does (the tuning word's), to within what
+       the measurement can see.
+    2. That frequency is the nearest the tuning word can get to the one asked for (half a step, or
+       sample rate / 2^33, about 29uHz at 250kHz).
+    3. .. so the stream is within 0.005Hz of the request; good for 0.01Hz steps.
+
+  Exits 0 if everything passed, 1 if anything didn't.
+                                                                                    */
+#include <Arduino.h>
+#include <math.h>
+#include <mutex>
+#include <string>
+#include <vector>
+#include "host.h"
+
+// From the sketch..
+extern String QCommand;
+extern bool amDelaying;
+extern float_t frequency;
+extern volatile uint32_t ddsTuningWord;
+uint8_t commandsWaiting();
+
+static std::vector<std::string> frequencies = { "0.5", "10.01", "1000", "1000.01", "1234.56", "4321.09", "9999.99", "24999.99" };
+
+// The capture, filled by the ddsWriter task via the I2S hook..
+static std::mutex captureLock;
+static std::vector<uint8_t> samples;
+static size_t wanted = 0;       // Stop when we have this many
+static int skip = 0;            // Writes to throw away first (made before the change)
+static uint32_t captureRate = 0;
+
+static bool idle() {
+  return hostSerialPending() == 0 && QCommand == "" && commandsWaiting() == 0 && !amDelaying;
+}
+
+static void command(const std::string &c) {
+  hostSerialInput(c + "\n");
+  for (int i = 0; i < 100000 && !idle(); i++) loop();
+  for (int i = 0; i < 10; i++) loop();
+}
+
+static void capture(size_t frames) {
+  {
+    std::lock_guard<std::mutex> hold(captureLock);
+    samples.clear();
+    samples.reserve(frames);
+    skip = 2;
+    wanted = frames;
+  }
+  while (true) {
+    {
+      std::lock_guard<std::mutex> hold(captureLock);
+      if (samples.size() >= wanted) {
+        wanted = 0;
+        return;
+      }
+    }
+    delay(1);
+  }
+}
+
+// Rising crossings of the mid level; returns the measured frequency (0 if there were fewer than two)..
+static double measure(const std::vector<uint8_t> &s, uint32_t rate, uint32_t &periods, double &span) {
+  uint8_t lo = 255, hi = 0;
+  for (uint8_t v : s) {
+    if (v < lo) lo = v;
+    if (v > hi) hi = v;
+  }
+  double mid = (lo + hi) / 2.0;
+  double first = -1, last = -1;
+  uint32_t crossings = 0;
+  for (size_t i = 1; i < s.size(); i++) {
+    if (s[i - 1] < mid && s[i] >= mid) {
+      double at = (i - 1) + (mid - s[i - 1]) / (double)(s[i] - s[i - 1]);
+      if (first < 0) first = at;
+      last = at;
+      crossings++;
+    }
+  }
+  span = last - first;
+  periods = (crossings > 1) ? crossings - 1 : 0;
+  return (periods) ? periods * (double)rate / span : 0;
+}
+
+int main(int argc, char **argv) {
+
+  if (argc > 1) frequencies.assign(argv + 1, argv + argc);
+
+  hostI2SPaced = false;   // As fast as the sketch can make them
+  hostSerialEcho = (getenv("SG_ECHO") != NULL);
+  hostI2SHook = [](const uint8_t *data, size_t size, uint32_t rate) {
+    std::lock_guard<std::mutex> hold(captureLock);
+    if (samples.size() >= wanted) return;
+    if (skip > 0) {
+      skip--;
+      return;
+    }
+    captureRate = rate;
+    for (size_t i = 0; i + 3 < size && samples.size() < wanted; i += 4) samples.push_back(data[i + 1]);
+  };
+
+  setup();
+  command("t");
+  command("ddse");
+  command("p50");
+  hostSerialTake();
+
+  printf("\n ESP32 Signal Generator DDS sample stream test (host build)\n\n");
+  printf("  %12s %16s %16s %14s %10s %14s\n", "requested", "achieved", "measured", "error", "periods", "resolution");
+
+  uint32_t failed = 0;
+  for (auto &f : frequencies) {
+
+    float_t requested = String(f.c_str()).toFloat();
+    command(f);
+    std::string said = hostSerialTake();
+    uint32_t word = ddsTuningWord;
+    float_t reported = frequency;
+
+    // 10 seconds' worth, or 20 periods under 2Hz. Higher up, enough that a sample either end is
+    // under 0.005Hz (500 samples per Hz)..
+    size_t frames = 2500000;
+    if (requested > 0 && 20 * 250000.0 / requested > frames) frames = 20 * 250000.0 / requested;
+    if (requested * 500 > frames) frames = requested * 500;
+    capture(frames);
+
+    uint32_t periods;
+    double span;
+    double measured = measure(samples, captureRate, periods, span);
+    double step = captureRate / 4294967296.0;
+    double achieved = word * step;
+    double resolution = (span > 0) ? 2.0 * measured / span : 0;   // A sample at either end
+
+    std::string why;
+    if (periods == 0) why = "no periods in the stream";
+    else if (fabs(measured - achieved) > resolution + 1e-9) why = "stream doesn't match the tuning word";
+    else if (fabs(achieved - requested) > step / 2 + requested * 1e-7) why = "tuning word isn't the nearest";
+    else if (fabs(reported - achieved) > achieved * 1e-6) why = "sketch reported a different frequency";
+    else if (fabs(measured - requested) > 0.005) why = "more than 0.005Hz out";
+
+    printf("  %12.4f %16.6f %16.6f %+13.6fHz %10u %13.6fHz  %s\n", requested, achieved, measured,
+           measured - requested, periods, resolution, (why == "") ? "ok" : ("FAILED: " + why).c_str());
+    if (why != "") {
+      failed++;
+      if (!hostSerialEcho) printf("%s", said.c_str());
+    }
+  }
+
+  printf("\n  %s (%zu frequencies, %u failed)\n\n", (failed) ? "FAILED" : "Passed", frequencies.size(), failed);
+  hostExit((failed) ? 1 : 0);
+}
@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+"""
+  A part of ESP32 Signal Generator (host build)
+
+  Gzip copies of the pages you can edit (WebPage.h and Console.h), for browsers that take them
+  (most do). Reads each page out of its header, compresses it and writes the lot to WebPagesGz.h,
+  next to the sketch, with the FNV-1a hash of the page each copy was made from. The sketch checks
+  that hash against the page it has (see pageHash()); edit a page and forget to run this, and that
+  page goes out uncompressed, same as ever.
+
+    make pages        write ../WebPagesGz.h
+    make test         (among other things) checks ../WebPagesGz.h is up to date
+
+  mtime is 0, so the same page always makes the same bytes.
+"""
+import gzip
+import re
+import sys
+
+PAGES = [("WebPage", "../WebPage.h"), ("WebConsole", "../Console.h")]
+OUTPUT = "../WebPagesGz.h"
+
+
+def page(name, header):
+    with open(header, encoding="utf-8") as f:
+        found = re.search(r'const char %s\[\] PROGMEM = R"(\w*)\((.*?)\)\1";' % name, f.read(), re.S)
+    if not found:
+        sys.exit(" %s: no %s[] in there" % (header, name))
+    return found.group(2).encode("utf-8")
+
+
+def fnv(data):
+    hash = 2166136261
+    for byte in data:
+        hash = ((hash ^ byte) * 16777619) & 0xFFFFFFFF
+    return hash
+
+
+def header():
+    text = ["/*",
+            "  A part of ESP32 Signal Generator",
+            "",
+            "  Gzip copies of WebPage.h and Console.h, made by host/gzpages.py. Don't edit this; edit the",
+            "  pages, then run \"make pages\" in host/ (if you don't, the page you edited is sent uncompressed).",
+            "*/"]
+    for name, source in PAGES:
+        html = page(name, source)
+        packed = gzip.compress(html, 9, mtime=0)
+        text += ["", "// %s (%u bytes, %u gzipped).." % (name, len(html), len(packed)),
+                 "const uint32_t %sGzSource = 0x%08x;" % (name, fnv(html)),
+                 "const uint8_t %sGz[] PROGMEM = {" % name]
+        for i in range(0, len(packed), 20):
+            text.append("  " + ",".join("0x%02x" % b for b in packed[i:i + 20]) + ",")
+        text.append("};")
+    return "\n".join(text) + "\n"
+
+
+def main(check):
+    made = header()
+    if check:
+        try:
+            with open(OUTPUT, encoding="utf-8") as f:
+                current = f.read()
+        except FileNotFoundError:
+            current = ""
+        if current != made:
+            sys.exit(" WebPagesGz.h is out of date; run \"make pages\"")
+        print(" WebPagesGz.h is up to date")
+    else:
+        with open(OUTPUT, "w", encoding="utf-8") as f:
+            f.write(made)
+        print(" Wrote WebPagesGz.h")
+
+
+if __name__ == "__main__":
+    main("--check" in sys.argv[1:])
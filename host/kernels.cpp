@@ -0,0 +1,112 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  Waveform kernel benchmark. Synth.h on its own (no sketch, no stubs); checks every block kernel
+  against the floating point reference generator, then times them..
+
+    ./kernels                   10 million samples each
+    ./kernels 100000000         .. or as many as you like
+
+  For each wave and amplitude level you get the kernel's samples per second, the reference's, and
+  how much quicker the kernel is. Then a stereo pair (what Dual Channel mode makes) and a modulated
+  carrier, which go through synthFill() and friends the way the sketch calls them.
+
+  Then synthFillStereo() gets checked at 0, 90, 180 and 270 degrees. The same triangle goes out on
+  both sides, 256 frames to a cycle, so at 90 degrees the right channel must be the left channel 64
+  frames on, exactly; nothing in the two unused bytes of each frame, and each side within one DAC
+  step of the reference generator (see checkStereo()).
+
+  Exits with the number of kernels and stereo pairs that don't match the reference (0 == all good).
+                                                                                    */
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include "Synth.h"
+
+static unsigned long hostMicros() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(steady_clock::now().time_since_epoch()).count();
+}
+
+// Samples per second for <blocks> blocks of <fill>..
+template <typename Fill>
+static double rate(uint32_t blocks, Fill fill) {
+  unsigned long start = hostMicros();
+  for (uint32_t i = 0; i < blocks; i++) fill();
+  unsigned long took = hostMicros() - start;
+  return (took) ? blocks * (double)synthBenchBlock * 1000000.0 / took : 0;
+}
+
+/*
+  One stereo block at <offset> degrees, against the reference..
+
+    1. Channels in the right place: left in bits 8-15, right in 24-31, the rest 0.
+    2. The offset: right frame i == left frame i + offset * 256 / 360 (a cycle is 256 frames).
+    3. Each side within one DAC step of synthReference(), from the same start.
+                                                                                    */
+static bool checkStereo(uint16_t offset) {
+  const uint16_t frames = 512;               // Two cycles
+  const double frequency = 250000.0 / 256;   // A tuning word of exactly 2^24
+  uint32_t block[frames], expected[frames];
+  SynthChannel a, b;
+  synthSetChannel(a, 't', frequency, 250000, 37, 255, 0);
+  synthSetChannel(b, 't', frequency, 250000, 37, 255, offset);
+  SynthChannel refA = a, refB = b;
+
+  synthFillStereo(block, frames, a, b);
+  synthReference(expected, frames, refA);
+  synthReference(expected, frames, refB, true);
+
+  uint16_t shift = offset * 256 / 360;
+  for (uint16_t i = 0; i < frames; i++) {
+    if (block[i] & 0x00FF00FF) return false;
+    uint8_t left = (block[i] >> 8) & 0xFF, right = block[i] >> 24;
+    if (right != ((block[(i + shift) % frames] >> 8) & 0xFF)) return false;
+    if (abs(left - (int)((expected[i] >> 8) & 0xFF)) > 1) return false;
+    if (abs(right - (int)(expected[i] >> 24)) > 1) return false;
+  }
+  return a.phase == refA.phase && b.phase == refB.phase;
+}
+
+int main(int argc, char **argv) {
+
+  uint32_t samples = (argc > 1) ? strtoul(argv[1], NULL, 10) : 10000000;
+  if (samples < synthBenchBlock) samples = synthBenchBlock;
+  uint32_t blocks = samples / synthBenchBlock;
+
+  synthInit();
+  SynthBenchResult results[synthBenchKernels];
+  uint8_t failed = synthBenchmark(results, hostMicros, samples);
+
+  printf("\n ESP32 Signal Generator waveform kernels (host build): %u samples each\n\n", blocks * synthBenchBlock);
+  printf("  Wave  Level  Check   Kernel (S/s)  Reference (S/s)  Speed-up\n");
+  for (auto &r : results) {
+    printf("  %c     %5u  %-5s  %13.0f  %15.0f  %7.2fx\n", r.wave, r.amplitude, (r.matches) ? "OK" : "FAIL",
+           r.kernelRate, r.referenceRate, (r.referenceRate) ? r.kernelRate / r.referenceRate : 0);
+  }
+
+  // As the sketch uses them; triangle and sine, one each side (per frame, so two samples a time)..
+  static uint32_t block[synthBenchBlock];
+  SynthChannel a = synthTestChannel('t', 255), b = synthTestChannel('s', 127);
+  double stereo = rate(blocks, [&] { synthFillStereo(block, synthBenchBlock, a, b); });
+
+  // .. and a triangle with FM on it (no kernel for this one; it's a sample at a time)..
+  SynthChannel c = synthTestChannel('t', 255);
+  SynthModulator m = { 'f', 20, 0, synthTuningWord(7.5, 250000), c.tuningWord, 37 };
+  double modulated = rate(blocks, [&] { synthFillModulated(block, synthBenchBlock, c, m); });
+
+  printf("\n  Stereo (t + s)      %13.0f frames/s\n", stereo);
+  printf("  Modulated (t, FM)   %13.0f S/s\n", modulated);
+
+  const uint16_t offsets[] = { 0, 90, 180, 270 };
+  printf("\n  Stereo phase offset ");
+  for (uint16_t offset : offsets) {
+    bool ok = checkStereo(offset);
+    if (!ok) failed++;
+    printf(" %u: %s ", offset, (ok) ? "OK" : "FAIL");
+  }
+  printf("\n");
+
+  printf("\n  %s\n\n", (failed) ? "Some kernels (or stereo pairs) DON'T match the reference!" : "All kernels match the reference.");
+  return failed;
+}
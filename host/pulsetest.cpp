@@ -0,0 +1,112 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  Pulse train encoder test. Pulse.h on its own (no sketch, no stubs); encodes a list of trains the
+  way startTrain() does (pulsePlan()) and checks what comes out..
+
+    ./pulsetest
+
+  For each train, four things have to hold..
+
+    1. It gets the tick we expect: 1us if it fits, 100us if only that fits and no time moves more
+       than 1%, or nothing at all (too long, or 100us ticks would wreck it; a 10us pulse isn't 100us).
+    2. The item count is what the encoder should make, and within pulseItemsMAX (pulseLoopMAX for
+       trains that loop in RMT memory).
+    3. The items, read back with pulseMeasure(), have the right number of pulses..
+    4. .. and the right high and low times, to the tick.
+
+  Then pulseTicks() on its own: round to the nearest tick, and never 0 ticks for a time that isn't 0.
+
+  Exits 0 if everything passed, 1 if anything didn't.
+                                                                                    */
+#include <stdio.h>
+#include "Pulse.h"
+
+struct PulseCase {
+  const char *name;
+  PulseTrain train;
+  uint32_t tickUs;      // Expected tick (0 == rejected)
+  size_t items;         // Expected items, end marker included (when it isn't rejected)
+  uint32_t pulses;      // Rising edges per pass..
+  uint64_t high;        // .. and ticks high and low
+  uint64_t low;
+};
+
+static const PulseCase cases[] = {
+  // 1kHz, 10us pulses, on and on: one item (and the marker)..
+  { "1kHz, 10us wide, continuous",   { 1000, 10, 0, 0, 0, {} },              1,   2,    1,   10,      990 },
+  // 500ms each side is 16 halves of up to 32767 ticks; 32 halves, 16 items..
+  { "1Hz, 50%, continuous",          { 1000000, 500000, 0, 0, 0, {} },       1,   17,   1,   500000,  500000 },
+  // Three pulses, then a 1s gap (the gap is merged into the last low time)..
+  { "3 x 1ms pulses, 1s gap",        { 2000, 1000, 3, 1000000, 0, {} },      1,   19,   3,   3000,    1003000 },
+  // Each 60s pulse is 916 items at 1us; too many to loop, so 100us ticks (all exact)..
+  { "1/60Hz, 50%, continuous",       { 60000000, 30000000, 0, 0, 0, {} },    100, 11,   1,   300000,  300000 },
+  // 10us pulses 20s apart only loop at 100us, where a 10us pulse would be 100us..
+  { "10 x 10us pulses every 20s",    { 20000000, 10, 10, 1000000, 0, {} },   0,   0,    0,   0,       0 },
+  // .. 10s pulses are 100000 ticks, exactly; four halves each side, 80 halves and the marker..
+  { "10 x 10s pulses, 1s gap",       { 20000000, 10000000, 10, 1000000, 0, {} }, 100, 41, 10, 1000000, 1010000 },
+  // 1000 1ms pulses don't loop at either (2000 halves, whatever the tick)..
+  { "1000 x 1ms pulses, 1s gap",     { 2000, 1000, 1000, 1000000, 0, {} },   0,   0,    0,   0,       0 },
+  // A one-shot burst streams from the heap; 2000 1s pulses is 2001 items at 100us..
+  { "2000 x 1s pulses, one-shot",    { 2000000, 1000000, 2000, 0, 0, {} },   100, 2001, 2000, 20000000, 20000000 },
+  // .. and 4096 won't fit even then (8192 halves and the marker is 4097 items)..
+  { "4096 x 1s pulses, one-shot",    { 2000000, 1000000, 4096, 0, 0, {} },   0,   0,    0,   0,       0 },
+  // A sequence (high/low/high/low) three times over, then a gap; 27 halves, the marker in the last..
+  { "sequence 10/5/20/5ms x 3",      { 0, 0, 3, 500000, 4, { 10000, 5000, 20000, 5000 } }, 1, 14, 6, 90000, 530000 },
+  // 40s low only loops at 100us, where 150us would be 200us (33% out)..
+  { "sequence 150us/40s, continuous", { 0, 0, 0, 0, 2, { 150, 40000000 } }, 0,   0,    0,   0,       0 },
+};
+
+int main() {
+
+  static uint32_t items[pulseItemsMAX];
+  uint32_t failed = 0, count = 0;
+
+  printf("\n ESP32 Signal Generator pulse train encoder test (host build)\n\n");
+  printf("  %-32s %6s %6s %7s %10s %10s\n", "train", "tick", "items", "pulses", "high", "low");
+
+  for (const PulseCase &c : cases) {
+    uint32_t tickUs, errorPPM;
+    bool loop;
+    size_t n = pulsePlan(c.train, items, tickUs, loop, errorPPM);
+    PulseMeasure m = (n) ? pulseMeasure(items, n) : PulseMeasure();
+    uint32_t gotTick = (n) ? tickUs : 0;
+
+    bool ok = (gotTick == c.tickUs);
+    if (n) {
+      ok = ok && n == c.items && n <= pulseItemsMAX && (!loop || n <= pulseLoopMAX);
+      ok = ok && m.pulses == c.pulses && m.high == c.high && m.low == c.low;
+      ok = ok && (items[n - 1] & 0xFFFF0000) == 0 && errorPPM <= pulseErrorMAX; // Ends with the marker
+    }
+    if (!ok) failed++;
+    count++;
+
+    if (n) {
+      printf("  %-32s %4uus %6zu %7u %10llu %10llu  %s\n", c.name, gotTick, n, m.pulses,
+                  (unsigned long long)m.high, (unsigned long long)m.low, (ok) ? "ok" : "FAIL");
+    } else {
+      printf("  %-32s %6s %6s %7s %10s %10s  %s (%s)\n", c.name, "-", "-", "-", "-", "-", (ok) ? "ok" : "FAIL",
+                  (errorPPM > pulseErrorMAX) ? "ticks too coarse" : "too long");
+    }
+  }
+
+  // Rounding..
+  struct { uint32_t us, tickUs; uint64_t ticks; } rounding[] = {
+    { 0, 100, 0 }, { 10, 100, 1 }, { 49, 100, 1 }, { 149, 100, 1 }, { 150, 100, 2 },
+    { 32767, 1, 32767 }, { 4000000000u, 100, 40000000 },
+  };
+  for (auto &r : rounding) {
+    uint64_t got = pulseTicks(r.us, r.tickUs);
+    bool ok = (got == r.ticks);
+    if (!ok) {
+      failed++;
+      printf("  pulseTicks(%u, %u) == %llu, not %llu  FAIL\n", r.us, r.tickUs,
+                  (unsigned long long)got, (unsigned long long)r.ticks);
+    }
+    count++;
+  }
+  printf("  %-32s %s\n", "pulseTicks() rounding", "checked");
+
+  printf("\n  %s (%u checks, %u failed)\n\n", (failed) ? "FAILED" : "Passed", count, failed);
+  return (failed) ? 1 : 0;
+}
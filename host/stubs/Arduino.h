@@ -0,0 +1,443 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  Just enough of Arduino-ESP32 (2.x) and FreeRTOS to build SignalGenerator.ino on a PC. Tasks are
+  threads, esp_timer is one more thread, the serial port is a pair of buffers and the peripherals
+  write to a set of fake registers. See host.h for the hooks a test program can use, and the
+  README (Host Build) for what this does and doesn't tell you.
+*/
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <string>
+#include <algorithm>
+#include <cmath>
+#include <ctype.h>
+#include <type_traits>
+#include "binary.h"
+
+using std::min;
+using std::max;
+using std::abs;
+using std::isinf;
+using std::isnan;
+
+
+/*
+  String (backed by std::string, which keeps more short strings off the heap than Arduino's does,
+  so allocation counts from here are a little on the low side)..
+                                                                                          */
+#define HEX 16
+#define DEC 10
+#define BIN 2
+#define OCT 8
+
+class String {
+  public:
+    String() {}
+    String(const char *s) : s_(s ? s : "") {}
+    String(const String &o) = default;
+    String(String &&o) = default;
+    String(const std::string &s) : s_(s) {}
+    explicit String(char c) : s_(1, c) {}
+    explicit String(unsigned char v, unsigned char base = 10) { fromU(v, base); }
+    explicit String(int v, unsigned char base = 10) { fromS(v, base); }
+    explicit String(unsigned int v, unsigned char base = 10) { fromU(v, base); }
+    explicit String(long v, unsigned char base = 10) { fromS(v, base); }
+    explicit String(unsigned long v, unsigned char base = 10) { fromU(v, base); }
+    explicit String(long long v, unsigned char base = 10) { fromS(v, base); }
+    explicit String(unsigned long long v, unsigned char base = 10) { fromU(v, base); }
+    explicit String(float v, unsigned int decimals = 2) { fromD(v, decimals); }
+    explicit String(double v, unsigned int decimals = 2) { fromD(v, decimals); }
+
+    String &operator=(const String &o) = default;
+    String &operator=(String &&o) = default;
+    String &operator=(const char *s) { s_ = s ? s : ""; return *this; }
+    // The sketch assigns numbers to Strings now and then, which the ESP32 core's String takes..
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    String &operator=(T v) { *this = String(v); return *this; }
+
+    const char *c_str() const { return s_.c_str(); }
+    unsigned int length() const { return s_.length(); }
+    bool isEmpty() const { return s_.empty(); }
+    bool reserve(unsigned int n) { s_.reserve(n); return true; }
+
+    bool concat(const String &o) { s_ += o.s_; return true; }
+    bool concat(const char *s) { if (s) s_ += s; return true; }
+    bool concat(const char *s, unsigned int n) { if (s) s_.append(s, n); return true; }
+    bool concat(char c) { s_ += c; return true; }
+    bool concat(unsigned char v) { return concat(String(v)); }
+    bool concat(int v) { return concat(String(v)); }
+    bool concat(unsigned int v) { return concat(String(v)); }
+    bool concat(long v) { return concat(String(v)); }
+    bool concat(unsigned long v) { return concat(String(v)); }
+    bool concat(long long v) { return concat(String(v)); }
+    bool concat(unsigned long long v) { return concat(String(v)); }
+    bool concat(float v) { return concat(String(v)); }
+    bool concat(double v) { return concat(String(v)); }
+    template <typename T> String &operator+=(const T &v) { concat(v); return *this; }
+
+    bool equals(const String &o) const { return s_ == o.s_; }
+    bool equals(const char *s) const { return s_ == (s ? s : ""); }
+    bool equalsIgnoreCase(const String &o) const {
+      if (s_.size() != o.s_.size()) return false;
+      for (size_t i = 0; i < s_.size(); i++) if (tolower((unsigned char)s_[i]) != tolower((unsigned char)o.s_[i])) return false;
+      return true;
+    }
+    int compareTo(const String &o) const { return s_.compare(o.s_); }
+    bool operator==(const String &o) const { return s_ == o.s_; }
+    bool operator==(const char *s) const { return s_ == (s ? s : ""); }
+    bool operator!=(const String &o) const { return s_ != o.s_; }
+    bool operator!=(const char *s) const { return !(*this == s); }
+    bool operator<(const String &o) const { return s_ < o.s_; }
+    bool operator>(const String &o) const { return s_ > o.s_; }
+    bool operator<=(const String &o) const { return s_ <= o.s_; }
+    bool operator>=(const String &o) const { return s_ >= o.s_; }
+
+    bool startsWith(const String &p) const { return s_.compare(0, p.s_.size(), p.s_) == 0 && s_.size() >= p.s_.size(); }
+    bool startsWith(const String &p, unsigned int from) const {
+      return from <= s_.size() && s_.size() - from >= p.s_.size() && s_.compare(from, p.s_.size(), p.s_) == 0;
+    }
+    bool endsWith(const String &p) const {
+      return s_.size() >= p.s_.size() && s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+    }
+
+    char charAt(unsigned int i) const { return (i < s_.size()) ? s_[i] : 0; }
+    void setCharAt(unsigned int i, char c) { if (i < s_.size()) s_[i] = c; }
+    char operator[](unsigned int i) const { return charAt(i); }
+    char &operator[](unsigned int i) { static char dummy; return (i < s_.size()) ? s_[i] : (dummy = 0); }
+
+    void getBytes(unsigned char *buf, unsigned int size, unsigned int index = 0) const { copyOut((char *)buf, size, index); }
+    void toCharArray(char *buf, unsigned int size, unsigned int index = 0) const { copyOut(buf, size, index); }
+
+    int indexOf(char c) const { return found(s_.find(c)); }
+    int indexOf(char c, unsigned int from) const { return found(s_.find(c, from)); }
+    int indexOf(const String &o) const { return found(s_.find(o.s_)); }
+    int indexOf(const String &o, unsigned int from) const { return found(s_.find(o.s_, from)); }
+    int lastIndexOf(char c) const { return found(s_.rfind(c)); }
+    int lastIndexOf(char c, unsigned int from) const { return found(s_.rfind(c, from)); }
+    int lastIndexOf(const String &o) const { return found(s_.rfind(o.s_)); }
+    int lastIndexOf(const String &o, unsigned int from) const { return found(s_.rfind(o.s_, from)); }
+
+    String substring(unsigned int from) const { return (from < s_.size()) ? String(s_.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const {
+      if (from > to) std::swap(from, to);
+      if (from >= s_.size()) return String();
+      return String(s_.substr(from, std::min<size_t>(to, s_.size()) - from));
+    }
+
+    void replace(char a, char b) { for (auto &c : s_) if (c == a) c = b; }
+    void replace(const String &a, const String &b) {
+      if (a.s_.empty()) return;
+      size_t i = 0;
+      while ((i = s_.find(a.s_, i)) != std::string::npos) { s_.replace(i, a.s_.size(), b.s_); i += b.s_.size(); }
+    }
+    void remove(unsigned int index) { if (index < s_.size()) s_.erase(index); }
+    void remove(unsigned int index, unsigned int count) { if (index < s_.size()) s_.erase(index, count); }
+    void toLowerCase() { for (auto &c : s_) c = tolower((unsigned char)c); }
+    void toUpperCase() { for (auto &c : s_) c = toupper((unsigned char)c); }
+    void trim() {
+      size_t a = 0, b = s_.size();
+      while (a < b && isspace((unsigned char)s_[a])) a++;
+      while (b > a && isspace((unsigned char)s_[b - 1])) b--;
+      s_ = s_.substr(a, b - a);
+    }
+
+    long toInt() const { return atol(s_.c_str()); }
+    float toFloat() const { return (float)atof(s_.c_str()); }
+    double toDouble() const { return atof(s_.c_str()); }
+
+    explicit operator bool() const { return true; }
+    const std::string &str() const { return s_; }
+
+  private:
+    std::string s_;
+    static int found(size_t i) { return (i == std::string::npos) ? -1 : (int)i; }
+    void copyOut(char *buf, unsigned int size, unsigned int index) const {
+      if (size == 0 || buf == NULL) return;
+      size_t n = (index < s_.size()) ? std::min<size_t>(size - 1, s_.size() - index) : 0;
+      if (n) memcpy(buf, s_.data() + index, n);
+      buf[n] = 0;
+    }
+    void fromU(unsigned long long v, unsigned char base) {
+      char buf[72];
+      char *p = buf + sizeof(buf) - 1;
+      *p = 0;
+      if (base < 2) base = 10;
+      do { unsigned d = v % base; *--p = (d < 10) ? '0' + d : 'a' + d - 10; v /= base; } while (v);
+      s_ = p;
+    }
+    void fromS(long long v, unsigned char base) {
+      if (base == 10 && v < 0) { fromU(-(unsigned long long)v, 10); s_.insert(0, "-"); }
+      else if (base == 10) fromU(v, 10);
+      else fromU((unsigned long long)(unsigned long)v, base);
+    }
+    void fromD(double v, unsigned int decimals) {
+      char buf[64];
+      snprintf(buf, sizeof(buf), "%.*f", decimals, v);
+      s_ = buf;
+    }
+};
+
+inline String operator+(const String &a, const String &b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, const char *b) { String r(a); r.concat(b); return r; }
+inline String operator+(const char *a, const String &b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, char b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, unsigned char b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, int b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, unsigned int b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, long b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, unsigned long b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, long long b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, unsigned long long b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, float b) { String r(a); r.concat(b); return r; }
+inline String operator+(const String &a, double b) { String r(a); r.concat(b); return r; }
+inline bool operator==(const char *a, const String &b) { return b == a; }
+inline bool operator!=(const char *a, const String &b) { return b != a; }
+
+#define F(s) (s)
+#define PSTR(s) (s)
+#define PROGMEM
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define RTC_DATA_ATTR
+#define strcpy_P strcpy
+#define strlen_P strlen
+#define memcpy_P memcpy
+
+#define log_v(...) do {} while (0)
+#define log_d(...) do {} while (0)
+#define log_i(...) do {} while (0)
+#define log_w(...) do {} while (0)
+#define log_e(...) do {} while (0)
+
+
+/*
+  Serial. Output goes to a buffer the test program can read (or straight to stdout), input comes
+  from whatever the test program feeds it..
+                                                                                          */
+class Print;
+class Printable {
+  public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print {
+  public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) { return write(&c, 1); }
+    virtual size_t write(const uint8_t *buf, size_t len) = 0;
+    size_t write(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t write(const char *buf, size_t len) { return write((const uint8_t *)buf, len); }
+
+    size_t print(const String &s) { return write((const uint8_t *)s.c_str(), s.length()); }
+    size_t print(const char *s) { return write((const uint8_t *)s, strlen(s)); }
+    size_t print(char c) { return write((const uint8_t *)&c, 1); }
+    size_t print(unsigned char v, int base = DEC) { return print(String(v, base)); }
+    size_t print(int v, int base = DEC) { return print(String(v, base)); }
+    size_t print(unsigned int v, int base = DEC) { return print(String(v, base)); }
+    size_t print(long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(unsigned long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(long long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(unsigned long long v, int base = DEC) { return print(String(v, base)); }
+    size_t print(double v, int digits = 2) { return print(String(v, digits)); }
+    size_t print(const Printable &x) { return x.printTo(*this); }
+
+    size_t println() { return print("\r\n"); }
+    template <typename T> size_t println(const T &v) { size_t n = print(v); return n + println(); }
+    template <typename T> size_t println(const T &v, int f) { size_t n = print(v, f); return n + println(); }
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+};
+
+class HardwareSerial : public Print {
+  public:
+    void begin(unsigned long baud) { (void)baud; }
+    void setDebugOutput(bool on) { (void)on; }
+    int available();
+    int read();
+    int peek();
+    void flush() {}
+    using Print::write;
+    size_t write(const uint8_t *buf, size_t len) override;
+    operator bool() const { return true; }
+};
+extern HardwareSerial Serial;
+
+
+/*
+  Time and the chip..
+                  */
+unsigned long millis();
+unsigned long micros();
+void delay(uint32_t ms);
+void delayMicroseconds(uint32_t us);
+void yield();
+
+class EspClass {
+  public:
+    uint32_t getCycleCount();
+    uint32_t getFreeHeap();
+    uint32_t getHeapSize();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap();
+    uint32_t getSketchSize() { return 1048576; }
+    uint32_t getFreeSketchSpace() { return 1310720; }
+    String getSketchMD5() { return String("00000000000000000000000000000000"); }
+    const char *getSdkVersion() { return "host"; }
+    void restart();
+};
+extern EspClass ESP;
+
+uint32_t getCpuFrequencyMhz();
+bool setCpuFrequencyMhz(uint32_t mhz);
+uint32_t getXtalFrequencyMhz();
+uint32_t getApbFrequency();
+
+inline void interrupts() {}
+inline void noInterrupts() {}
+
+long random(long max);
+long random(long min, long max);
+void randomSeed(unsigned long seed);
+
+template <typename T, typename L, typename H> inline T constrain(T v, L lo, H hi) {
+  return (v < (T)lo) ? (T)lo : (v > (T)hi) ? (T)hi : v;
+}
+inline long map(long x, long inMin, long inMax, long outMin, long outMax) {
+  return (x - inMin) * (outMax - outMin) / (inMax - inMin) + outMin;
+}
+
+inline bool isDigit(int c) { return isdigit(c); }
+inline bool isAlpha(int c) { return isalpha(c); }
+inline bool isAlphaNumeric(int c) { return isalnum(c); }
+inline bool isSpace(int c) { return isspace(c); }
+inline bool isWhitespace(int c) { return c == ' ' || c == '\t'; }
+inline bool isUpperCase(int c) { return isupper(c); }
+inline bool isLowerCase(int c) { return islower(c); }
+inline bool isPunct(int c) { return ispunct(c); }
+inline bool isHexadecimalDigit(int c) { return isxdigit(c); }
+inline bool isPrintable(int c) { return isprint(c); }
+inline bool isControl(int c) { return iscntrl(c); }
+inline bool isAscii(int c) { return c >= 0 && c < 128; }
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+
+/*
+  Pins, LEDC, touch, DAC..
+                      */
+#define LOW 0
+#define HIGH 1
+#define INPUT 0x01
+#define OUTPUT 0x02
+#define INPUT_PULLUP 0x05
+#define INPUT_PULLDOWN 0x09
+#define LED_BUILTIN 2
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t val);
+int digitalRead(uint8_t pin);
+uint16_t analogRead(uint8_t pin);
+uint16_t touchRead(uint8_t pin);
+void dacWrite(uint8_t pin, uint8_t value);
+
+typedef enum { NOTE_C, NOTE_Cs, NOTE_D, NOTE_Eb, NOTE_E, NOTE_F, NOTE_Fs, NOTE_G, NOTE_Gs, NOTE_A, NOTE_Bb, NOTE_B, NOTE_MAX } note_t;
+
+uint32_t ledcSetup(uint8_t chan, uint32_t freq, uint8_t bits);
+uint32_t ledcChangeFrequency(uint8_t chan, uint32_t freq, uint8_t bits);
+void ledcWrite(uint8_t chan, uint32_t duty);
+uint32_t ledcRead(uint8_t chan);
+uint32_t ledcReadFreq(uint8_t chan);
+void ledcAttachPin(uint8_t pin, uint8_t chan);
+void ledcDetachPin(uint8_t pin);
+
+
+/*
+  ESP-IDF basics..
+                */
+typedef int esp_err_t;
+#define ESP_OK 0
+#define ESP_FAIL -1
+#define ESP_ERR_NO_MEM 0x101
+#define ESP_ERR_INVALID_ARG 0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_INVALID_SIZE 0x104
+#define ESP_ERR_NOT_FOUND 0x105
+#define ESP_ERR_TIMEOUT 0x107
+#define ESP_ERROR_CHECK(x) do { esp_err_t rc_ = (x); (void)rc_; } while (0)
+
+uint32_t esp_get_free_heap_size();
+uint32_t esp_get_free_internal_heap_size();
+uint32_t esp_get_minimum_free_heap_size();
+uint32_t esp_random();
+
+
+/*
+  FreeRTOS (tasks are threads; one tick is a millisecond, as on the ESP32)..
+                                                                      */
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef void (*TaskFunction_t)(void *);
+typedef struct HostTask *TaskHandle_t;
+typedef struct HostQueue *QueueHandle_t;
+typedef struct HostSemaphore *SemaphoreHandle_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define portMAX_DELAY 0xFFFFFFFFu
+#define portTICK_PERIOD_MS 1
+#define configTICK_RATE_HZ 1000
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *param,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core);
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *param,
+                       UBaseType_t priority, TaskHandle_t *handle);
+void vTaskDelete(TaskHandle_t task);
+void vTaskDelay(TickType_t ticks);
+void vTaskDelayUntil(TickType_t *previous, TickType_t increment);
+TickType_t xTaskGetTickCount();
+TaskHandle_t xTaskGetCurrentTaskHandle();
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task);
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait);
+BaseType_t xTaskNotifyGive(TaskHandle_t task);
+BaseType_t xPortGetCoreID();
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize);
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait);
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+#define xQueueSendToBack xQueueSend
+
+SemaphoreHandle_t xSemaphoreCreateMutex();
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex();
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s);
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait);
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s);
+
+// A spinlock on the chip (and the same core can take it again); a recursive mutex here..
+struct HostMux;
+struct portMUX_TYPE { HostMux *mux; };
+#define portMUX_INITIALIZER_UNLOCKED {NULL}
+void vPortEnterCritical(portMUX_TYPE *m);
+void vPortExitCritical(portMUX_TYPE *m);
+#define portENTER_CRITICAL(m) vPortEnterCritical(m)
+#define portEXIT_CRITICAL(m) vPortExitCritical(m)
+#define portENTER_CRITICAL_ISR(m) vPortEnterCritical(m)
+#define portEXIT_CRITICAL_ISR(m) vPortExitCritical(m)
+
+#include "esp_timer.h"
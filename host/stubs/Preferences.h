@@ -0,0 +1,48 @@
+// Host build: Preferences, kept in memory for the life of the process..
+#pragma once
+#include "Arduino.h"
+
+class Preferences {
+  public:
+    bool begin(const char *name, bool readOnly = false, const char *partition = NULL);
+    void end();
+    bool clear();
+    bool remove(const char *key);
+    bool isKey(const char *key);
+
+    size_t putBool(const char *key, bool value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putChar(const char *key, int8_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putUChar(const char *key, uint8_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putShort(const char *key, int16_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putUShort(const char *key, uint16_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putInt(const char *key, int32_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putUInt(const char *key, uint32_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putLong(const char *key, int32_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putULong(const char *key, uint32_t value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putFloat(const char *key, float value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putDouble(const char *key, double value) { return putRaw(key, &value, sizeof(value)); }
+    size_t putString(const char *key, const char *value);
+    size_t putString(const char *key, const String &value) { return putString(key, value.c_str()); }
+    size_t putBytes(const char *key, const void *value, size_t len) { return putRaw(key, value, len); }
+
+    bool getBool(const char *key, bool def = false) { getRaw(key, &def, sizeof(def)); return def; }
+    int8_t getChar(const char *key, int8_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    uint8_t getUChar(const char *key, uint8_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    int16_t getShort(const char *key, int16_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    uint16_t getUShort(const char *key, uint16_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    int32_t getInt(const char *key, int32_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    uint32_t getUInt(const char *key, uint32_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    int32_t getLong(const char *key, int32_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    uint32_t getULong(const char *key, uint32_t def = 0) { getRaw(key, &def, sizeof(def)); return def; }
+    float getFloat(const char *key, float def = NAN) { getRaw(key, &def, sizeof(def)); return def; }
+    double getDouble(const char *key, double def = NAN) { getRaw(key, &def, sizeof(def)); return def; }
+    String getString(const char *key, const String &def = String());
+    size_t getBytesLength(const char *key);
+    size_t getBytes(const char *key, void *buf, size_t maxLen);
+
+  private:
+    String ns_;
+    bool open_ = false;
+    size_t putRaw(const char *key, const void *value, size_t len);
+    bool getRaw(const char *key, void *value, size_t len);
+};
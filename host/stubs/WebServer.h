@@ -0,0 +1,84 @@
+/*
+  Host build: a WebServer with no sockets. The test program queues requests (see host.h) and
+  handleClient() runs one of them through the handlers, just as the real one would; whatever the
+  handler sends (or writes to server.client()) lands in that client's buffer..
+                                                                                  */
+#pragma once
+#include <functional>
+#include <vector>
+#include "WiFi.h"
+
+typedef enum { HTTP_ANY, HTTP_GET, HTTP_HEAD, HTTP_POST, HTTP_PUT, HTTP_PATCH, HTTP_DELETE, HTTP_OPTIONS } HTTPMethod;
+typedef enum { UPLOAD_FILE_START, UPLOAD_FILE_WRITE, UPLOAD_FILE_END, UPLOAD_FILE_ABORTED } HTTPUploadStatus;
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define HTTP_UPLOAD_BUFLEN 1436
+
+typedef struct {
+  HTTPUploadStatus status;
+  String filename;
+  String name;
+  String type;
+  size_t totalSize;
+  size_t currentSize;
+  uint8_t buf[HTTP_UPLOAD_BUFLEN];
+} HTTPUpload;
+
+struct HostRequest;
+extern bool hostWebStarted;   // (see host.h)
+
+class WebServer {
+  public:
+    typedef std::function<void(void)> THandlerFunction;
+
+    explicit WebServer(int port = 80) : port_(port) {}
+    void begin() { hostWebStarted = true; }
+    void handleClient();
+
+    void on(const String &uri, THandlerFunction fn) { on(uri, HTTP_ANY, fn); }
+    void on(const String &uri, HTTPMethod method, THandlerFunction fn) { on(uri, method, fn, THandlerFunction()); }
+    void on(const String &uri, HTTPMethod method, THandlerFunction fn, THandlerFunction upload) {
+      routes_.push_back({ uri, method, fn, upload });
+    }
+    void onNotFound(THandlerFunction fn) { notFound_ = fn; }
+    void collectHeaders(const char *keys[], size_t count) { (void)keys; (void)count; }
+
+    String uri();
+    HTTPMethod method();
+    String arg(const String &name);
+    String arg(int i);
+    String argName(int i);
+    int args();
+    bool hasArg(const String &name);
+    String header(const String &name);
+    WiFiClient client();
+    HTTPUpload &upload() { return upload_; }
+
+    void send(int code, const char *type = NULL, const String &content = String());
+    void send(int code, const String &type, const String &content) { send(code, type.c_str(), content); }
+    void send(int code, const char *type, const char *content) { send(code, type, String(content)); }
+    void send_P(int code, const char *type, const char *content) { send_P(code, type, content, strlen(content)); }
+    void send_P(int code, const char *type, const char *content, size_t length);
+    void setContentLength(size_t length) { contentLength_ = length; }
+    void sendHeader(const String &name, const String &value, bool first = false);
+    void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+    void sendContent(const char *content, size_t length);
+    void sendContent_P(const char *content) { sendContent(content, strlen(content)); }
+    void sendContent_P(const char *content, size_t length) { sendContent(content, length); }
+
+  private:
+    struct Route {
+      String uri;
+      HTTPMethod method;
+      THandlerFunction fn;
+      THandlerFunction upload;
+    };
+    int port_;
+    std::vector<Route> routes_;
+    THandlerFunction notFound_;
+    HTTPUpload upload_;
+    HostRequest *request_ = NULL;
+    size_t contentLength_ = 0;
+    String headers_;
+    bool headersSent_ = false;
+};
@@ -0,0 +1,75 @@
+/*
+  Host build: WiFi is always "connected". Unit <n> (hostUnit, see host.h; 0 unless a test says) is
+  127.0.0.<n+1>, and the broadcast address reaches every unit (see lwip/sockets.h)..
+                                                                              */
+#pragma once
+#include "Arduino.h"
+
+typedef enum { WIFI_OFF = 0, WIFI_STA = 1, WIFI_AP = 2, WIFI_AP_STA = 3 } wifi_mode_t;
+#define WIFI_MODE_NULL WIFI_OFF
+#define WIFI_MODE_STA WIFI_STA
+#define WIFI_MODE_AP WIFI_AP
+#define WIFI_MODE_APSTA WIFI_AP_STA
+
+typedef enum { WL_IDLE_STATUS = 0, WL_NO_SSID_AVAIL = 1, WL_CONNECTED = 3, WL_CONNECT_FAILED = 4,
+               WL_DISCONNECTED = 6 } wl_status_t;
+
+// Four bytes, in network order (so the uint32_t is the same as a sockaddr_in's s_addr)..
+class IPAddress : public Printable {
+  public:
+    IPAddress() { addr_.dword = 0; }
+    IPAddress(uint32_t a) { addr_.dword = a; }
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) { addr_.bytes[0] = a; addr_.bytes[1] = b; addr_.bytes[2] = c; addr_.bytes[3] = d; }
+    operator uint32_t() const { return addr_.dword; }
+    uint8_t operator[](int i) const { return addr_.bytes[i]; }
+    String toString() const {
+      char buf[16];
+      snprintf(buf, sizeof(buf), "%u.%u.%u.%u", addr_.bytes[0], addr_.bytes[1], addr_.bytes[2], addr_.bytes[3]);
+      return String(buf);
+    }
+    size_t printTo(Print &p) const override { return p.print(toString()); }
+  private:
+    union { uint8_t bytes[4]; uint32_t dword; } addr_;
+};
+
+// Somewhere to write to; the test program can read what went down it (see host.h)..
+class WiFiClient : public Print {
+  public:
+    WiFiClient() {}
+    explicit WiFiClient(int id) : id_(id) {}
+    uint8_t connected();
+    size_t write(const uint8_t *buf, size_t len) override;
+    using Print::write;
+    void stop();
+    IPAddress remoteIP() const { return IPAddress(127, 0, 0, 1); }
+    operator bool() { return connected(); }
+    int id() const { return id_; }
+    int fd() const { return id_; }   // The "socket" (see lwip_send())
+    void setNoDelay(bool) {}
+  private:
+    int id_ = 0;
+};
+
+class WiFiClass {
+  public:
+    bool mode(wifi_mode_t m) { mode_ = m; return true; }
+    wifi_mode_t getMode() { return mode_; }
+    bool setHostname(const char *name) { hostname_ = name; return true; }
+    bool setHostname(const String &name) { hostname_ = name; return true; }
+    const char *getHostname() { return hostname_.c_str(); }
+    wl_status_t begin(const char *ssid, const char *pass = NULL) { (void)ssid; (void)pass; return WL_CONNECTED; }
+    wl_status_t begin(const String &ssid, const String &pass) { return begin(ssid.c_str(), pass.c_str()); }
+    wl_status_t status() { return WL_CONNECTED; }
+    IPAddress localIP();
+    IPAddress broadcastIP();
+    bool softAPConfig(IPAddress ip, IPAddress gateway, IPAddress subnet) { return true; }
+    bool softAP(const char *ssid, const char *pass = NULL) { return true; }
+    bool softAP(const String &ssid, const String &pass) { return true; }
+    IPAddress softAPIP() { return IPAddress(192, 168, 4, 1); }
+    IPAddress softAPBroadcastIP() { return broadcastIP(); }
+    void printDiag(Print &p) { p.println("host WiFi"); }
+  private:
+    wifi_mode_t mode_ = WIFI_STA;
+    String hostname_ = "esp32-host";
+};
+extern WiFiClass WiFi;
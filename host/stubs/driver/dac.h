@@ -0,0 +1,11 @@
+// Host build: the DAC pads..
+#pragma once
+#include "Arduino.h"
+
+typedef enum { DAC_CHANNEL_1 = 0, DAC_CHANNEL_2 = 1, DAC_CHANNEL_MAX } dac_channel_t;
+
+esp_err_t dac_output_enable(dac_channel_t channel);
+esp_err_t dac_output_disable(dac_channel_t channel);
+esp_err_t dac_output_voltage(dac_channel_t channel, uint8_t value);
+esp_err_t dac_i2s_enable();
+esp_err_t dac_i2s_disable();
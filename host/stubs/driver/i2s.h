@@ -0,0 +1,45 @@
+// Host build: legacy I2S (IDF 4.4). Writes are paced at the sample rate and handed to a hook..
+#pragma once
+#include "Arduino.h"
+
+typedef enum { I2S_NUM_0 = 0, I2S_NUM_1 = 1, I2S_NUM_MAX } i2s_port_t;
+typedef enum {
+  I2S_MODE_MASTER = 1, I2S_MODE_SLAVE = 2, I2S_MODE_TX = 4, I2S_MODE_RX = 8,
+  I2S_MODE_DAC_BUILT_IN = 16, I2S_MODE_ADC_BUILT_IN = 32, I2S_MODE_PDM = 64
+} i2s_mode_t;
+typedef enum { I2S_BITS_PER_SAMPLE_8BIT = 8, I2S_BITS_PER_SAMPLE_16BIT = 16, I2S_BITS_PER_SAMPLE_24BIT = 24,
+               I2S_BITS_PER_SAMPLE_32BIT = 32 } i2s_bits_per_sample_t;
+typedef enum { I2S_BITS_PER_CHAN_DEFAULT = 0 } i2s_bits_per_chan_t;
+typedef enum { I2S_CHANNEL_FMT_RIGHT_LEFT, I2S_CHANNEL_FMT_ALL_RIGHT, I2S_CHANNEL_FMT_ALL_LEFT,
+               I2S_CHANNEL_FMT_ONLY_RIGHT, I2S_CHANNEL_FMT_ONLY_LEFT } i2s_channel_fmt_t;
+typedef enum { I2S_COMM_FORMAT_STAND_I2S = 1, I2S_COMM_FORMAT_STAND_MSB = 3 } i2s_comm_format_t;
+typedef enum { I2S_MCLK_MULTIPLE_DEFAULT = 0 } i2s_mclk_multiple_t;
+typedef enum { I2S_DAC_CHANNEL_DISABLE, I2S_DAC_CHANNEL_RIGHT_EN, I2S_DAC_CHANNEL_LEFT_EN,
+               I2S_DAC_CHANNEL_BOTH_EN } i2s_dac_mode_t;
+
+typedef struct {
+  i2s_mode_t mode;
+  uint32_t sample_rate;
+  i2s_bits_per_sample_t bits_per_sample;
+  i2s_channel_fmt_t channel_format;
+  i2s_comm_format_t communication_format;
+  int intr_alloc_flags;
+  int dma_buf_count;
+  int dma_buf_len;
+  bool use_apll;
+  bool tx_desc_auto_clear;
+  int fixed_mclk;
+  i2s_mclk_multiple_t mclk_multiple;
+  i2s_bits_per_chan_t bits_per_chan;
+} i2s_driver_config_t;
+typedef i2s_driver_config_t i2s_config_t;
+
+typedef struct i2s_pin_config_t i2s_pin_config_t;
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_driver_config_t *config, int queueSize, void *queue);
+esp_err_t i2s_driver_uninstall(i2s_port_t port);
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t *pins);
+esp_err_t i2s_set_dac_mode(i2s_dac_mode_t mode);
+esp_err_t i2s_set_sample_rates(i2s_port_t port, uint32_t rate);
+esp_err_t i2s_write(i2s_port_t port, const void *src, size_t size, size_t *written, TickType_t wait);
+esp_err_t i2s_zero_dma_buffer(i2s_port_t port);
@@ -0,0 +1,55 @@
+// Host build: RMT transmit (IDF 4.4 legacy driver). Items are kept so a test can look at them..
+#pragma once
+#include "Arduino.h"
+
+typedef int gpio_num_t;
+typedef enum { RMT_CHANNEL_0, RMT_CHANNEL_1, RMT_CHANNEL_2, RMT_CHANNEL_3, RMT_CHANNEL_4, RMT_CHANNEL_5,
+               RMT_CHANNEL_6, RMT_CHANNEL_7, RMT_CHANNEL_MAX } rmt_channel_t;
+typedef enum { RMT_MODE_TX, RMT_MODE_RX } rmt_mode_t;
+typedef enum { RMT_IDLE_LEVEL_LOW, RMT_IDLE_LEVEL_HIGH } rmt_idle_level_t;
+typedef enum { RMT_CARRIER_LEVEL_LOW, RMT_CARRIER_LEVEL_HIGH } rmt_carrier_level_t;
+typedef enum { RMT_BASECLK_REF, RMT_BASECLK_APB } rmt_source_clk_t;
+
+typedef struct {
+  union {
+    struct {
+      uint32_t duration0 : 15;
+      uint32_t level0 : 1;
+      uint32_t duration1 : 15;
+      uint32_t level1 : 1;
+    };
+    uint32_t val;
+  };
+} rmt_item32_t;
+
+typedef struct {
+  uint32_t carrier_freq_hz;
+  rmt_carrier_level_t carrier_level;
+  rmt_idle_level_t idle_level;
+  uint8_t carrier_duty_percent;
+  uint32_t loop_count;
+  bool carrier_en;
+  bool loop_en;
+  bool idle_output_en;
+} rmt_tx_config_t;
+
+typedef struct {
+  rmt_mode_t rmt_mode;
+  rmt_channel_t channel;
+  gpio_num_t gpio_num;
+  uint8_t clk_div;
+  uint8_t mem_block_num;
+  uint32_t flags;
+  rmt_tx_config_t tx_config;
+} rmt_config_t;
+
+#define RMT_DEFAULT_CONFIG_TX(gpio, channel_id) \
+  { RMT_MODE_TX, channel_id, gpio, 80, 1, 0, { 38000, RMT_CARRIER_LEVEL_HIGH, RMT_IDLE_LEVEL_LOW, 33, 0, false, false, true } }
+
+esp_err_t rmt_config(const rmt_config_t *config);
+esp_err_t rmt_set_source_clk(rmt_channel_t channel, rmt_source_clk_t clk);
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBuffer, int intrFlags);
+esp_err_t rmt_driver_uninstall(rmt_channel_t channel);
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t *items, int count, bool wait);
+esp_err_t rmt_tx_stop(rmt_channel_t channel);
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t wait);
@@ -0,0 +1,1065 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  The other half of the stub headers: threads for tasks and timers, buffers for the serial port
+  and web server, a map for NVS, counters for the heap. Built once, linked with the sketch and
+  whichever test program (bench, ddstest, kernels, syncloop).
+                                                                                          */
+#include "Arduino.h"
+#include "esp_heap_caps.h"
+#include "nvs_flash.h"
+#include "Preferences.h"
+#include "WiFi.h"
+#include "WebServer.h"
+#include "driver/i2s.h"
+#include "driver/dac.h"
+#include "driver/rmt.h"
+#include "soc/sens_reg.h"
+#include "mbedtls/base64.h"
+#include "host.h"
+
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <malloc.h>
+#include <time.h>
+#include <unistd.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <thread>
+
+
+/*
+  Heap. Counted for everything: new/delete here, and malloc()/free() from the sketch (linked with
+  --wrap, see the Makefile)..
+                          */
+static std::atomic<uint64_t> heapAllocations(0), heapFrees(0), heapLiveBlocks(0), heapLiveBytes(0);
+static std::atomic<uint64_t> heapPeakBytes(0);
+static const size_t heapModelSize = 327680;  // What a WROOM32 has left after the system takes its share (roughly)
+
+// While this is set (on a thread), its allocations aren't counted as the sketch's (the stubs' own
+// buffers and the test program's bookkeeping). They still count towards the live totals..
+static thread_local int heapQuiet = 0;
+struct Quiet {
+  Quiet() { heapQuiet++; }
+  ~Quiet() { heapQuiet--; }
+};
+
+static void *counted(void *p) {
+  if (p == NULL) return p;
+  if (!heapQuiet) heapAllocations++;
+  heapLiveBlocks++;
+  uint64_t live = heapLiveBytes += malloc_usable_size(p);
+  uint64_t peak = heapPeakBytes.load();
+  while (live > peak && !heapPeakBytes.compare_exchange_weak(peak, live)) {}
+  return p;
+}
+
+static void uncounted(void *p) {
+  if (p == NULL) return;
+  if (!heapQuiet) heapFrees++;
+  heapLiveBlocks--;
+  heapLiveBytes -= malloc_usable_size(p);
+}
+
+extern "C" {
+  void *__real_malloc(size_t size);
+  void *__real_calloc(size_t count, size_t size);
+  void *__real_realloc(void *p, size_t size);
+  void __real_free(void *p);
+
+  void *__wrap_malloc(size_t size) { return counted(__real_malloc(size)); }
+  void *__wrap_calloc(size_t count, size_t size) { return counted(__real_calloc(count, size)); }
+  void *__wrap_realloc(void *p, size_t size) {
+    uncounted(p);
+    void *q = __real_realloc(p, size);
+    if (q == NULL && p != NULL && size != 0) {
+      counted(p);  // Still there
+      return NULL;
+    }
+    return counted(q);
+  }
+  void __wrap_free(void *p) { uncounted(p); __real_free(p); }
+}
+
+void *operator new(size_t size) {
+  void *p = counted(__real_malloc(size ? size : 1));
+  if (p == NULL) throw std::bad_alloc();
+  return p;
+}
+void *operator new[](size_t size) { return operator new(size); }
+void operator delete(void *p) noexcept { uncounted(p); __real_free(p); }
+void operator delete[](void *p) noexcept { uncounted(p); __real_free(p); }
+void operator delete(void *p, size_t) noexcept { uncounted(p); __real_free(p); }
+void operator delete[](void *p, size_t) noexcept { uncounted(p); __real_free(p); }
+
+HostHeap hostHeap() {
+  return { heapAllocations.load(), heapFrees.load(), heapLiveBlocks.load(), heapLiveBytes.load() };
+}
+
+static size_t heapFree() {
+  uint64_t live = heapLiveBytes.load();
+  return (live >= heapModelSize) ? 0 : heapModelSize - live;
+}
+
+void heap_caps_get_info(multi_heap_info_t *info, uint32_t caps) {
+  (void)caps;
+  memset(info, 0, sizeof(multi_heap_info_t));
+  info->total_free_bytes = heapFree();
+  info->total_allocated_bytes = heapLiveBytes.load();
+  info->largest_free_block = heapFree();
+  info->minimum_free_bytes = (heapPeakBytes.load() >= heapModelSize) ? 0 : heapModelSize - heapPeakBytes.load();
+  info->allocated_blocks = heapLiveBlocks.load();
+  info->free_blocks = 1;
+  info->total_blocks = info->allocated_blocks + 1;
+}
+size_t heap_caps_get_free_size(uint32_t caps) { (void)caps; return heapFree(); }
+size_t heap_caps_get_largest_free_block(uint32_t caps) { (void)caps; return heapFree(); }
+uint32_t esp_get_free_heap_size() { return heapFree(); }
+uint32_t esp_get_free_internal_heap_size() { return heapFree(); }
+uint32_t esp_get_minimum_free_heap_size() {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_8BIT);
+  return info.minimum_free_bytes;
+}
+
+uint32_t EspClass::getFreeHeap() { return heapFree(); }
+uint32_t EspClass::getHeapSize() { return heapModelSize; }
+uint32_t EspClass::getMinFreeHeap() { return esp_get_minimum_free_heap_size(); }
+uint32_t EspClass::getMaxAllocHeap() { return heapFree(); }
+
+
+/*
+  Time..
+        */
+int64_t hostClockOffset = 0;
+
+int64_t hostTrueMicros() {
+  timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+// The sketch's clock starts at (about) zero, like a chip that has just booted..
+static int64_t bootMicros = hostTrueMicros();
+
+int64_t esp_timer_get_time() { return hostTrueMicros() - bootMicros + hostClockOffset; }
+unsigned long millis() { return (unsigned long)(uint32_t)(esp_timer_get_time() / 1000); }
+unsigned long micros() { return (unsigned long)(uint32_t)esp_timer_get_time(); }
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+void delayMicroseconds(uint32_t us) { std::this_thread::sleep_for(std::chrono::microseconds(us)); }
+void yield() { std::this_thread::yield(); }
+
+static uint32_t cpuMhz = 240;
+uint32_t EspClass::getCycleCount() { return (uint32_t)(hostTrueMicros() * cpuMhz); }
+uint32_t getCpuFrequencyMhz() { return cpuMhz; }
+bool setCpuFrequencyMhz(uint32_t mhz) {
+  if (mhz != 240 && mhz != 160 && mhz != 80 && mhz != 40 && mhz != 20 && mhz != 10) return false;
+  cpuMhz = mhz;
+  return true;
+}
+uint32_t getXtalFrequencyMhz() { return 40; }
+uint32_t getApbFrequency() { return 80000000; }
+
+std::function<void()> hostRestartHook;
+void EspClass::restart() {
+  if (hostRestartHook) hostRestartHook();
+  hostExit(0);
+}
+EspClass ESP;
+
+[[noreturn]] void hostExit(int code) {
+  fflush(stdout);
+  fflush(stderr);
+  _exit(code);
+}
+
+static uint32_t randomState = 1;
+long random(long max) { return (max <= 0) ? 0 : (long)(esp_random() % (uint32_t)max); }
+long random(long min, long max) { return (max <= min) ? min : min + random(max - min); }
+void randomSeed(unsigned long seed) { randomState = seed ? seed : 1; }
+uint32_t esp_random() {
+  randomState ^= randomState << 13;
+  randomState ^= randomState >> 17;
+  randomState ^= randomState << 5;
+  return randomState;
+}
+
+
+/*
+  Serial..
+        */
+volatile bool hostSerialEcho = false;
+static std::mutex serialLock;
+static std::deque<char> serialIn;
+static std::string serialOut;
+
+HardwareSerial Serial;
+
+int HardwareSerial::available() {
+  std::lock_guard<std::mutex> hold(serialLock);
+  return serialIn.size();
+}
+int HardwareSerial::read() {
+  std::lock_guard<std::mutex> hold(serialLock);
+  if (serialIn.empty()) return -1;
+  char c = serialIn.front();
+  serialIn.pop_front();
+  return (uint8_t)c;
+}
+int HardwareSerial::peek() {
+  std::lock_guard<std::mutex> hold(serialLock);
+  return serialIn.empty() ? -1 : (uint8_t)serialIn.front();
+}
+// Output is kept (up to serialOutMAX) until the test program takes it..
+static const size_t serialOutMAX = 4 << 20;
+static size_t serialDropped = 0;
+
+size_t HardwareSerial::write(const uint8_t *buf, size_t len) {
+  Quiet quiet;
+  std::lock_guard<std::mutex> hold(serialLock);
+  if (serialOut.capacity() < serialOutMAX) serialOut.reserve(serialOutMAX);
+  if (serialOut.size() + len <= serialOutMAX) serialOut.append((const char *)buf, len); else serialDropped += len;
+  if (hostSerialEcho) fwrite(buf, 1, len, stdout);
+  return len;
+}
+
+// Like the ESP32 core's: 64 bytes on the stack, and a malloc() for anything longer..
+size_t Print::printf(const char *format, ...) {
+  char small[64];
+  va_list args;
+  va_start(args, format);
+  int n = vsnprintf(small, sizeof(small), format, args);
+  va_end(args);
+  if (n < 0) return 0;
+  if ((size_t)n < sizeof(small)) return write((const uint8_t *)small, n);
+  char *big = (char *)__wrap_malloc(n + 1);
+  if (big == NULL) return 0;
+  va_start(args, format);
+  vsnprintf(big, n + 1, format, args);
+  va_end(args);
+  size_t done = write((const uint8_t *)big, n);
+  __wrap_free(big);
+  return done;
+}
+
+void hostSerialInput(const std::string &text) {
+  Quiet quiet;
+  std::lock_guard<std::mutex> hold(serialLock);
+  serialIn.insert(serialIn.end(), text.begin(), text.end());
+}
+size_t hostSerialPending() {
+  std::lock_guard<std::mutex> hold(serialLock);
+  return serialIn.size();
+}
+std::string hostSerialTake() {
+  Quiet quiet;
+  std::lock_guard<std::mutex> hold(serialLock);
+  std::string out = serialOut;
+  serialOut.clear();
+  return out;
+}
+
+
+/*
+  Pins and peripherals..
+                      */
+volatile int hostPinLevel[40];
+volatile uint16_t hostTouchLevel[40] = { 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80,
+                                         80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80, 80 };
+volatile uint16_t hostAnalogLevel[40];
+volatile uint32_t hostRegisters[HOST_REG_COUNT];
+std::function<void(const char *what, uint32_t a, uint32_t b)> hostSignalHook;
+
+static void signalEvent(const char *what, uint32_t a, uint32_t b) {
+  if (hostSignalHook) hostSignalHook(what, a, b);
+}
+
+void pinMode(uint8_t pin, uint8_t mode) { (void)pin; (void)mode; }
+void digitalWrite(uint8_t pin, uint8_t val) { if (pin < 40) hostPinLevel[pin] = val; }
+int digitalRead(uint8_t pin) { return (pin < 40) ? hostPinLevel[pin] : LOW; }
+uint16_t analogRead(uint8_t pin) { return (pin < 40) ? hostAnalogLevel[pin] : 0; }
+uint16_t touchRead(uint8_t pin) { return (pin < 40) ? hostTouchLevel[pin] : 0; }
+void dacWrite(uint8_t pin, uint8_t value) { signalEvent("dacWrite", pin, value); }
+
+// LEDC: 80MHz APB through a 10.8 divider, dropping to the 1MHz REF_TICK when that won't reach..
+struct LedcChannel {
+  uint32_t freq;
+  uint8_t bits;
+  uint32_t duty;
+};
+static LedcChannel ledc[16];
+
+static uint32_t ledcPlan(uint32_t freq, uint8_t bits) {
+  if (freq == 0 || bits == 0 || bits > 20) return 0;
+  const uint64_t clocks[2] = { 80000000, 1000000 };
+  for (uint64_t clock : clocks) {
+    uint64_t divider = (clock << 8) / ((uint64_t)freq << bits);
+    if (divider >= 256 && divider <= 0x3FFFF) return (uint32_t)((clock << 8) / (divider << bits));
+  }
+  return 0;
+}
+
+uint32_t ledcSetup(uint8_t chan, uint32_t freq, uint8_t bits) {
+  if (chan >= 16) return 0;
+  uint32_t got = ledcPlan(freq, bits);
+  if (got == 0) return 0;
+  ledc[chan] = { got, bits, 0 };
+  signalEvent("ledcSetup", chan, got);
+  return got;
+}
+uint32_t ledcChangeFrequency(uint8_t chan, uint32_t freq, uint8_t bits) {
+  if (chan >= 16) return 0;
+  uint32_t got = ledcPlan(freq, bits);
+  if (got == 0) return 0;
+  ledc[chan].freq = got;
+  ledc[chan].bits = bits;
+  signalEvent("ledcChangeFrequency", chan, got);
+  return got;
+}
+void ledcWrite(uint8_t chan, uint32_t duty) {
+  if (chan >= 16) return;
+  ledc[chan].duty = duty;
+  signalEvent("ledcWrite", chan, duty);
+}
+uint32_t ledcRead(uint8_t chan) { return (chan < 16) ? ledc[chan].duty : 0; }
+uint32_t ledcReadFreq(uint8_t chan) { return (chan < 16) ? ledc[chan].freq : 0; }
+void ledcAttachPin(uint8_t pin, uint8_t chan) { signalEvent("ledcAttachPin", pin, chan); }
+void ledcDetachPin(uint8_t pin) { signalEvent("ledcDetachPin", pin, 0); }
+
+esp_err_t dac_output_enable(dac_channel_t channel) { signalEvent("dacEnable", channel, 1); return ESP_OK; }
+esp_err_t dac_output_disable(dac_channel_t channel) { signalEvent("dacEnable", channel, 0); return ESP_OK; }
+esp_err_t dac_output_voltage(dac_channel_t channel, uint8_t value) { signalEvent("dacWrite", channel, value); return ESP_OK; }
+esp_err_t dac_i2s_enable() { return ESP_OK; }
+esp_err_t dac_i2s_disable() { return ESP_OK; }
+
+
+/*
+  I2S: one port's worth of DMA; it plays <rate> frames (four bytes each) a second..
+                                                                              */
+std::function<void(const uint8_t *data, size_t size, uint32_t rate)> hostI2SHook;
+volatile bool hostI2SPaced = true;
+
+static std::mutex i2sLock;
+static bool i2sInstalled = false;
+static uint32_t i2sRate = 0;
+static size_t i2sCapacity = 0;      // Bytes of DMA buffer
+static double i2sQueued = 0;        // Bytes not played yet..
+static int64_t i2sCheck = 0;        // .. as of then
+
+static void i2sDrain(int64_t now) {
+  i2sQueued -= (now - i2sCheck) * (i2sRate * 4.0) / 1000000.0;
+  if (i2sQueued < 0) i2sQueued = 0;
+  i2sCheck = now;
+}
+
+esp_err_t i2s_driver_install(i2s_port_t port, const i2s_driver_config_t *config, int queueSize, void *queue) {
+  std::lock_guard<std::mutex> hold(i2sLock);
+  if (i2sInstalled) return ESP_ERR_INVALID_STATE;
+  i2sInstalled = true;
+  i2sRate = config->sample_rate;
+  i2sCapacity = (size_t)config->dma_buf_count * config->dma_buf_len * 4;
+  i2sQueued = 0;
+  i2sCheck = hostTrueMicros();
+  signalEvent("i2sInstall", port, i2sRate);
+  return ESP_OK;
+}
+esp_err_t i2s_driver_uninstall(i2s_port_t port) {
+  std::lock_guard<std::mutex> hold(i2sLock);
+  if (!i2sInstalled) return ESP_ERR_INVALID_STATE;
+  i2sInstalled = false;
+  signalEvent("i2sUninstall", port, 0);
+  return ESP_OK;
+}
+esp_err_t i2s_set_pin(i2s_port_t port, const i2s_pin_config_t *pins) { return ESP_OK; }
+esp_err_t i2s_set_dac_mode(i2s_dac_mode_t mode) { return ESP_OK; }
+esp_err_t i2s_zero_dma_buffer(i2s_port_t port) { return ESP_OK; }
+
+esp_err_t i2s_set_sample_rates(i2s_port_t port, uint32_t rate) {
+  std::lock_guard<std::mutex> hold(i2sLock);
+  if (!i2sInstalled) return ESP_ERR_INVALID_STATE;
+  i2sDrain(hostTrueMicros());
+  i2sRate = rate;
+  signalEvent("i2sRate", port, rate);
+  return ESP_OK;
+}
+
+esp_err_t i2s_write(i2s_port_t port, const void *src, size_t size, size_t *written, TickType_t wait) {
+  int64_t deadline = (wait == portMAX_DELAY) ? INT64_MAX : hostTrueMicros() + (int64_t)wait * 1000;
+  *written = 0;
+  std::unique_lock<std::mutex> hold(i2sLock);
+  if (!i2sInstalled) return ESP_ERR_INVALID_STATE;
+  while (hostI2SPaced) {
+    int64_t now = hostTrueMicros();
+    i2sDrain(now);
+    if (i2sQueued == 0 || i2sQueued + size <= i2sCapacity) break;
+    if (now >= deadline) return ESP_ERR_TIMEOUT;
+    double excess = i2sQueued + size - i2sCapacity;
+    int64_t sleep = (int64_t)(excess * 1000000.0 / (i2sRate * 4.0)) + 1;
+    if (now + sleep > deadline) sleep = deadline - now;
+    hold.unlock();
+    std::this_thread::sleep_for(std::chrono::microseconds(sleep));
+    hold.lock();
+    if (!i2sInstalled) return ESP_ERR_INVALID_STATE;
+  }
+  i2sQueued += size;
+  uint32_t rate = i2sRate;
+  hold.unlock();
+  if (hostI2SHook) hostI2SHook((const uint8_t *)src, size, rate);
+  *written = size;
+  return ESP_OK;
+}
+
+
+/*
+  RMT (transmit only; the items are kept for anyone who wants to look)..
+                                                                    */
+static rmt_config_t rmtConfig[RMT_CHANNEL_MAX];
+
+esp_err_t rmt_config(const rmt_config_t *config) {
+  if (config->channel >= RMT_CHANNEL_MAX) return ESP_ERR_INVALID_ARG;
+  rmtConfig[config->channel] = *config;
+  return ESP_OK;
+}
+esp_err_t rmt_set_source_clk(rmt_channel_t channel, rmt_source_clk_t clk) { return ESP_OK; }
+esp_err_t rmt_driver_install(rmt_channel_t channel, size_t rxBuffer, int intrFlags) {
+  signalEvent("rmtInstall", channel, rmtConfig[channel].clk_div);
+  return ESP_OK;
+}
+esp_err_t rmt_driver_uninstall(rmt_channel_t channel) {
+  signalEvent("rmtUninstall", channel, 0);
+  return ESP_OK;
+}
+esp_err_t rmt_write_items(rmt_channel_t channel, const rmt_item32_t *items, int count, bool wait) {
+  signalEvent("rmtWrite", channel, count);
+  return ESP_OK;
+}
+esp_err_t rmt_tx_stop(rmt_channel_t channel) { return ESP_OK; }
+esp_err_t rmt_wait_tx_done(rmt_channel_t channel, TickType_t wait) { return ESP_OK; }
+
+
+/*
+  FreeRTOS. Every task is a thread; "main" (setup() and loop()) is the loopTask..
+                                                                              */
+struct HostTaskExit {};
+
+struct HostTask {
+  std::string name;
+  std::mutex lock;
+  std::condition_variable wake;
+  uint32_t notified = 0;
+};
+
+static HostTask mainTask = { "loopTask" };
+static thread_local HostTask *currentTask = &mainTask;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack, void *param,
+                                   UBaseType_t priority, TaskHandle_t *handle, BaseType_t core) {
+  Quiet quiet;
+  HostTask *task = new HostTask;
+  task->name = name;
+  if (handle) *handle = task;
+  std::thread([fn, param, task]() {
+    currentTask = task;
+    try {
+      fn(param);
+    } catch (HostTaskExit &) {
+    }
+  }).detach();
+  return pdPASS;
+}
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *param,
+                       UBaseType_t priority, TaskHandle_t *handle) {
+  return xTaskCreatePinnedToCore(fn, name, stack, param, priority, handle, tskNO_AFFINITY);
+}
+
+// A task can only really end itself; deleting another just leaves it waiting forever..
+void vTaskDelete(TaskHandle_t task) {
+  if (task == NULL || task == currentTask) throw HostTaskExit();
+}
+
+void vTaskDelay(TickType_t ticks) { delay(ticks); }
+TickType_t xTaskGetTickCount() { return (TickType_t)millis(); }
+void vTaskDelayUntil(TickType_t *previous, TickType_t increment) {
+  *previous += increment;
+  int32_t wait = (int32_t)(*previous - xTaskGetTickCount());
+  if (wait > 0) delay(wait);
+}
+TaskHandle_t xTaskGetCurrentTaskHandle() { return currentTask; }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) { return 4096; }
+BaseType_t xPortGetCoreID() { return (currentTask == &mainTask) ? 1 : 0; }
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+  HostTask *task = currentTask;
+  std::unique_lock<std::mutex> hold(task->lock);
+  if (wait == portMAX_DELAY) {
+    task->wake.wait(hold, [task] { return task->notified != 0; });
+  } else {
+    task->wake.wait_for(hold, std::chrono::milliseconds(wait), [task] { return task->notified != 0; });
+  }
+  uint32_t value = task->notified;
+  if (value) task->notified = (clear) ? 0 : value - 1;
+  return value;
+}
+BaseType_t xTaskNotifyGive(TaskHandle_t task) {
+  if (task == NULL) return pdFAIL;
+  {
+    std::lock_guard<std::mutex> hold(task->lock);
+    task->notified++;
+  }
+  task->wake.notify_one();
+  return pdPASS;
+}
+
+struct HostQueue {
+  std::mutex lock;
+  std::condition_variable changed;
+  std::deque<std::string> items;
+  size_t length;
+  size_t itemSize;
+};
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize) {
+  HostQueue *q = new HostQueue;
+  q->length = length;
+  q->itemSize = itemSize;
+  return q;
+}
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t wait) {
+  Quiet quiet;
+  std::unique_lock<std::mutex> hold(q->lock);
+  auto room = [q] { return q->items.size() < q->length; };
+  if (wait == portMAX_DELAY) q->changed.wait(hold, room);
+  else if (!q->changed.wait_for(hold, std::chrono::milliseconds(wait), room)) return pdFAIL;
+  q->items.emplace_back((const char *)item, q->itemSize);
+  q->changed.notify_all();
+  return pdPASS;
+}
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t wait) {
+  std::unique_lock<std::mutex> hold(q->lock);
+  auto any = [q] { return !q->items.empty(); };
+  if (wait == portMAX_DELAY) q->changed.wait(hold, any);
+  else if (!q->changed.wait_for(hold, std::chrono::milliseconds(wait), any)) return pdFAIL;
+  memcpy(item, q->items.front().data(), q->itemSize);
+  q->items.pop_front();
+  q->changed.notify_all();
+  return pdPASS;
+}
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+  std::lock_guard<std::mutex> hold(q->lock);
+  return q->items.size();
+}
+
+struct HostSemaphore {
+  std::recursive_timed_mutex lock;
+};
+
+SemaphoreHandle_t xSemaphoreCreateMutex() { return new HostSemaphore; }
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex() { return new HostSemaphore; }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) {
+  if (wait == portMAX_DELAY) {
+    s->lock.lock();
+    return pdTRUE;
+  }
+  return s->lock.try_lock_for(std::chrono::milliseconds(wait)) ? pdTRUE : pdFALSE;
+}
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) {
+  s->lock.unlock();
+  return pdTRUE;
+}
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t s, TickType_t wait) { return xSemaphoreTake(s, wait); }
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t s) { return xSemaphoreGive(s); }
+
+// On the chip a critical section also keeps the other core out; one lock for all of them will do that..
+static std::recursive_mutex criticalLock;
+void vPortEnterCritical(portMUX_TYPE *m) { (void)m; criticalLock.lock(); }
+void vPortExitCritical(portMUX_TYPE *m) { (void)m; criticalLock.unlock(); }
+
+
+/*
+  esp_timer. One thread (like the esp_timer task) runs the callbacks, soonest first..
+                                                                                */
+struct HostTimer {
+  esp_timer_cb_t callback;
+  void *arg;
+  std::string name;
+  bool active;
+  uint64_t period;      // 0 == one-shot
+  int64_t due;
+};
+
+static std::mutex timerLock;
+static std::condition_variable timerChanged;
+static std::vector<HostTimer *> timers;
+static bool timerThreadStarted = false;
+
+static void timerThread() {
+  std::unique_lock<std::mutex> hold(timerLock);
+  while (true) {
+    HostTimer *next = NULL;
+    for (HostTimer *t : timers) if (t->active && (next == NULL || t->due < next->due)) next = t;
+    if (next == NULL) {
+      timerChanged.wait(hold);
+      continue;
+    }
+    int64_t now = esp_timer_get_time();
+    if (next->due > now) {
+      timerChanged.wait_for(hold, std::chrono::microseconds(next->due - now));
+      continue;
+    }
+    if (next->period) {
+      next->due += next->period;
+      if (next->due < now) next->due = now;
+    } else {
+      next->active = false;
+    }
+    esp_timer_cb_t callback = next->callback;
+    void *arg = next->arg;
+    hold.unlock();
+    callback(arg);
+    hold.lock();
+  }
+}
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t *args, esp_timer_handle_t *handle) {
+  Quiet quiet;
+  HostTimer *t = new HostTimer{ args->callback, args->arg, args->name ? args->name : "", false, 0, 0 };
+  std::lock_guard<std::mutex> hold(timerLock);
+  timers.push_back(t);
+  if (!timerThreadStarted) {
+    timerThreadStarted = true;
+    std::thread(timerThread).detach();
+  }
+  *handle = t;
+  return ESP_OK;
+}
+static esp_err_t timerStart(esp_timer_handle_t t, uint64_t us, uint64_t period) {
+  std::lock_guard<std::mutex> hold(timerLock);
+  if (t->active) return ESP_ERR_INVALID_STATE;
+  t->active = true;
+  t->period = period;
+  t->due = esp_timer_get_time() + us;
+  timerChanged.notify_all();
+  return ESP_OK;
+}
+esp_err_t esp_timer_start_once(esp_timer_handle_t t, uint64_t us) { return timerStart(t, us, 0); }
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t t, uint64_t us) { return timerStart(t, us, us); }
+// Like the real one, this doesn't wait for a callback that's already running..
+esp_err_t esp_timer_stop(esp_timer_handle_t t) {
+  std::lock_guard<std::mutex> hold(timerLock);
+  if (!t->active) return ESP_ERR_INVALID_STATE;
+  t->active = false;
+  timerChanged.notify_all();
+  return ESP_OK;
+}
+esp_err_t esp_timer_delete(esp_timer_handle_t t) {
+  std::lock_guard<std::mutex> hold(timerLock);
+  if (t->active) return ESP_ERR_INVALID_STATE;
+  timers.erase(std::remove(timers.begin(), timers.end(), t), timers.end());
+  delete t;
+  return ESP_OK;
+}
+bool esp_timer_is_active(esp_timer_handle_t t) {
+  std::lock_guard<std::mutex> hold(timerLock);
+  return t->active;
+}
+
+
+/*
+  NVS and Preferences (in memory; every run is a first run)..
+                                                          */
+static std::mutex nvsLock;
+static std::map<std::string, std::map<std::string, std::string>> nvs;
+static const size_t nvsEntries = 630;   // A 20KB partition (the default)
+
+esp_err_t nvs_flash_init() { return ESP_OK; }
+esp_err_t nvs_flash_erase() {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  nvs.clear();
+  return ESP_OK;
+}
+esp_err_t nvs_get_stats(const char *part_name, nvs_stats_t *stats) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  size_t used = 0;
+  for (auto &ns : nvs) {
+    used++;
+    for (auto &entry : ns.second) used += 1 + (entry.second.size() + 31) / 32;
+  }
+  stats->used_entries = used;
+  stats->total_entries = nvsEntries;
+  stats->free_entries = (used < nvsEntries) ? nvsEntries - used : 0;
+  stats->namespace_count = nvs.size();
+  return ESP_OK;
+}
+
+bool Preferences::begin(const char *name, bool readOnly, const char *partition) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (name == NULL || strlen(name) > 15) return false;
+  ns_ = name;
+  open_ = true;
+  nvs[ns_.str()];
+  return true;
+}
+void Preferences::end() { open_ = false; }
+bool Preferences::clear() {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (!open_) return false;
+  nvs[ns_.str()].clear();
+  return true;
+}
+bool Preferences::remove(const char *key) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (!open_) return false;
+  return nvs[ns_.str()].erase(key) > 0;
+}
+bool Preferences::isKey(const char *key) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  return open_ && nvs[ns_.str()].count(key) > 0;
+}
+size_t Preferences::putRaw(const char *key, const void *value, size_t len) {
+  Quiet quiet;
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (!open_ || key == NULL || strlen(key) > 15) return 0;
+  nvs[ns_.str()][key] = std::string((const char *)value, len);
+  return len;
+}
+bool Preferences::getRaw(const char *key, void *value, size_t len) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (!open_) return false;
+  auto &space = nvs[ns_.str()];
+  auto found = space.find(key);
+  if (found == space.end() || found->second.size() != len) return false;
+  memcpy(value, found->second.data(), len);
+  return true;
+}
+size_t Preferences::putString(const char *key, const char *value) {
+  return putRaw(key, value, strlen(value) + 1) ? strlen(value) : 0;
+}
+String Preferences::getString(const char *key, const String &def) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (!open_) return def;
+  auto &space = nvs[ns_.str()];
+  auto found = space.find(key);
+  if (found == space.end()) return def;
+  return String(found->second.c_str());
+}
+size_t Preferences::getBytesLength(const char *key) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (!open_) return 0;
+  auto &space = nvs[ns_.str()];
+  auto found = space.find(key);
+  return (found == space.end()) ? 0 : found->second.size();
+}
+size_t Preferences::getBytes(const char *key, void *buf, size_t maxLen) {
+  std::lock_guard<std::mutex> hold(nvsLock);
+  if (!open_) return 0;
+  auto &space = nvs[ns_.str()];
+  auto found = space.find(key);
+  if (found == space.end() || found->second.size() > maxLen) return 0;
+  memcpy(buf, found->second.data(), found->second.size());
+  return found->second.size();
+}
+
+
+/*
+  WiFi and the web server..
+                        */
+WiFiClass WiFi;
+int hostUnit = 0;
+int hostUnits = 1;
+
+uint32_t hostUnitAddress(int unit) { return htonl(0x7F000001 + unit); }
+IPAddress WiFiClass::localIP() { return IPAddress(hostUnitAddress(hostUnit)); }
+IPAddress WiFiClass::broadcastIP() { return IPAddress(htonl(0x7FFFFFFF)); }
+
+struct HostRequest {
+  int client;
+  std::string method;
+  std::string uri;
+  std::string body;
+  std::vector<std::pair<std::string, std::string>> args;
+};
+
+struct HostClient {
+  std::string sent;
+  bool open;
+  size_t window;      // Most it'll hold unread (0 == no limit; see hostWebWindow())
+};
+
+static std::mutex webLock;
+static std::deque<HostRequest> webRequests;
+static std::map<int, HostClient> webClients;
+static int webNextClient = 1;
+bool hostWebStarted = false;
+
+static std::string urlDecode(const std::string &in) {
+  std::string out;
+  for (size_t i = 0; i < in.size(); i++) {
+    if (in[i] == '+') out += ' ';
+    else if (in[i] == '%' && i + 2 < in.size()) {
+      out += (char)strtol(in.substr(i + 1, 2).c_str(), NULL, 16);
+      i += 2;
+    } else out += in[i];
+  }
+  return out;
+}
+
+int hostWebRequest(const std::string &method, const std::string &uri, const std::string &body) {
+  Quiet quiet;
+  HostRequest r;
+  r.method = method;
+  r.body = body;
+  size_t q = uri.find('?');
+  r.uri = uri.substr(0, q);
+  if (q != std::string::npos) {
+    std::string query = uri.substr(q + 1);
+    size_t start = 0;
+    while (start <= query.size()) {
+      size_t end = query.find('&', start);
+      if (end == std::string::npos) end = query.size();
+      std::string pair = query.substr(start, end - start);
+      size_t eq = pair.find('=');
+      if (!pair.empty()) r.args.push_back({ urlDecode(pair.substr(0, eq)), (eq == std::string::npos) ? "" : urlDecode(pair.substr(eq + 1)) });
+      start = end + 1;
+    }
+  }
+  if (method == "POST") r.args.push_back({ "plain", body });
+  std::lock_guard<std::mutex> hold(webLock);
+  r.client = webNextClient++;
+  webClients[r.client] = { "", true, 0 };
+  webRequests.push_back(r);
+  return r.client;
+}
+size_t hostWebPending() {
+  std::lock_guard<std::mutex> hold(webLock);
+  return webRequests.size();
+}
+std::string hostWebResponse(int client) {
+  Quiet quiet;
+  std::lock_guard<std::mutex> hold(webLock);
+  auto found = webClients.find(client);
+  if (found == webClients.end()) return "";
+  std::string out;
+  out.swap(found->second.sent);
+  return out;
+}
+
+uint8_t WiFiClient::connected() {
+  std::lock_guard<std::mutex> hold(webLock);
+  auto found = webClients.find(id_);
+  return found != webClients.end() && found->second.open;
+}
+size_t WiFiClient::write(const uint8_t *buf, size_t len) {
+  Quiet quiet;
+  std::lock_guard<std::mutex> hold(webLock);
+  auto found = webClients.find(id_);
+  if (found == webClients.end() || !found->second.open) return 0;
+  found->second.sent.append((const char *)buf, len);
+  return len;
+}
+void hostWebWindow(int client, size_t bytes) {
+  std::lock_guard<std::mutex> hold(webLock);
+  auto found = webClients.find(client);
+  if (found != webClients.end()) found->second.window = bytes;
+}
+// A web client's socket, as if it were non-blocking (no room == EAGAIN)..
+ssize_t lwip_send(int sock, const void *data, size_t size, int flags) {
+  Quiet quiet;
+  std::lock_guard<std::mutex> hold(webLock);
+  auto found = webClients.find(sock);
+  if (found == webClients.end() || !found->second.open) {
+    errno = ENOTCONN;
+    return -1;
+  }
+  HostClient &c = found->second;
+  if (c.window && size > c.window - std::min(c.window, c.sent.size())) size = c.window - std::min(c.window, c.sent.size());
+  if (size == 0) {
+    errno = EAGAIN;
+    return -1;
+  }
+  c.sent.append((const char *)data, size);
+  return size;
+}
+void WiFiClient::stop() {
+  std::lock_guard<std::mutex> hold(webLock);
+  auto found = webClients.find(id_);
+  if (found != webClients.end()) found->second.open = false;
+}
+
+void WebServer::handleClient() {
+  HostRequest r;
+  {
+    Quiet quiet;
+    std::lock_guard<std::mutex> hold(webLock);
+    if (webRequests.empty()) return;
+    r = webRequests.front();
+    webRequests.pop_front();
+  }
+  request_ = &r;
+  headers_ = "";
+  headersSent_ = false;
+  contentLength_ = 0;
+  HTTPMethod method = (r.method == "POST") ? HTTP_POST : HTTP_GET;
+  bool handled = false;
+  for (Route &route : routes_) {
+    if (route.uri.str() != r.uri || (route.method != HTTP_ANY && route.method != method)) continue;
+    if (route.upload) {
+      // The whole body, as one file, in one piece..
+      upload_.status = UPLOAD_FILE_START;
+      upload_.filename = "host.txt";
+      upload_.name = "file";
+      upload_.totalSize = 0;
+      upload_.currentSize = 0;
+      route.upload();
+      for (size_t done = 0; done < r.body.size(); done += HTTP_UPLOAD_BUFLEN) {
+        upload_.status = UPLOAD_FILE_WRITE;
+        upload_.currentSize = std::min((size_t)HTTP_UPLOAD_BUFLEN, r.body.size() - done);
+        memcpy(upload_.buf, r.body.data() + done, upload_.currentSize);
+        upload_.totalSize += upload_.currentSize;
+        route.upload();
+      }
+      upload_.status = UPLOAD_FILE_END;
+      upload_.currentSize = 0;
+      route.upload();
+    }
+    route.fn();
+    handled = true;
+    break;
+  }
+  if (!handled && notFound_) notFound_();
+  request_ = NULL;
+}
+
+String WebServer::uri() { return request_ ? String(request_->uri) : String(); }
+HTTPMethod WebServer::method() { return (request_ && request_->method == "POST") ? HTTP_POST : HTTP_GET; }
+String WebServer::arg(const String &name) {
+  if (request_) for (auto &a : request_->args) if (a.first == name.str()) return String(a.second);
+  return String();
+}
+String WebServer::arg(int i) { return (request_ && i < (int)request_->args.size()) ? String(request_->args[i].second) : String(); }
+String WebServer::argName(int i) { return (request_ && i < (int)request_->args.size()) ? String(request_->args[i].first) : String(); }
+int WebServer::args() { return request_ ? request_->args.size() : 0; }
+bool WebServer::hasArg(const String &name) {
+  if (request_) for (auto &a : request_->args) if (a.first == name.str()) return true;
+  return false;
+}
+String WebServer::header(const String &name) { return String(); }
+WiFiClient WebServer::client() { return WiFiClient(request_ ? request_->client : 0); }
+
+void WebServer::sendHeader(const String &name, const String &value, bool first) {
+  Quiet quiet;
+  headers_ += name + ": " + value + "\r\n";
+}
+void WebServer::send(int code, const char *type, const String &content) {
+  Quiet quiet;
+  char status[64];
+  snprintf(status, sizeof(status), "HTTP/1.1 %d\r\n", code);
+  String out = String(status) + headers_;
+  if (type) out += String("Content-Type: ") + type + "\r\n";
+  if (contentLength_ == CONTENT_LENGTH_UNKNOWN) {
+    out += "Transfer-Encoding: chunked\r\n\r\n";
+  } else {
+    out += "Content-Length: " + String(content.length()) + "\r\n\r\n" + content;
+  }
+  headersSent_ = true;
+  client().write((const uint8_t *)out.c_str(), out.length());
+}
+void WebServer::send_P(int code, const char *type, const char *content, size_t length) {
+  Quiet quiet;
+  send(code, type, String(std::string(content, length)));
+}
+void WebServer::sendContent(const char *content, size_t length) {
+  Quiet quiet;
+  WiFiClient c = client();
+  if (contentLength_ == CONTENT_LENGTH_UNKNOWN) {
+    char size[16];
+    snprintf(size, sizeof(size), "%zx\r\n", length);
+    c.write(size);
+    c.write((const uint8_t *)content, length);
+    c.write("\r\n");
+  } else {
+    c.write((const uint8_t *)content, length);
+  }
+}
+
+
+/*
+  Sockets: each unit has its own loopback address, and "broadcast" is everyone in turn..
+                                                                                  */
+#undef bind
+#undef sendto
+
+int hostBind(int sock, const struct sockaddr *addr, socklen_t length) {
+  sockaddr_in local = *(const sockaddr_in *)addr;
+  if (local.sin_addr.s_addr == htonl(INADDR_ANY)) local.sin_addr.s_addr = hostUnitAddress(hostUnit);
+  return bind(sock, (const sockaddr *)&local, sizeof(local));
+}
+
+ssize_t hostSendto(int sock, const void *data, size_t size, int flags, const struct sockaddr *to, socklen_t length) {
+  sockaddr_in them = *(const sockaddr_in *)to;
+  if (them.sin_addr.s_addr != (uint32_t)WiFi.broadcastIP()) return sendto(sock, data, size, flags, (const sockaddr *)&them, sizeof(them));
+  for (int unit = 0; unit < hostUnits; unit++) {
+    them.sin_addr.s_addr = hostUnitAddress(unit);
+    sendto(sock, data, size, flags, (const sockaddr *)&them, sizeof(them));
+  }
+  return size;
+}
+
+
+/*
+  base64 (RFC 4648, as mbedtls does it)..
+                                      */
+static const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int mbedtls_base64_encode(unsigned char *dst, size_t dlen, size_t *olen, const unsigned char *src, size_t slen) {
+  size_t need = 4 * ((slen + 2) / 3) + 1;
+  if (dst == NULL || dlen < need) {
+    *olen = need;
+    return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+  }
+  size_t o = 0;
+  for (size_t i = 0; i < slen; i += 3) {
+    uint32_t v = src[i] << 16 | ((i + 1 < slen) ? src[i + 1] << 8 : 0) | ((i + 2 < slen) ? src[i + 2] : 0);
+    dst[o++] = base64Chars[(v >> 18) & 63];
+    dst[o++] = base64Chars[(v >> 12) & 63];
+    dst[o++] = (i + 1 < slen) ? base64Chars[(v >> 6) & 63] : '=';
+    dst[o++] = (i + 2 < slen) ? base64Chars[v & 63] : '=';
+  }
+  dst[o] = 0;
+  *olen = o;
+  return 0;
+}
+
+int mbedtls_base64_decode(unsigned char *dst, size_t dlen, size_t *olen, const unsigned char *src, size_t slen) {
+  std::string clean;
+  size_t pads = 0;
+  for (size_t i = 0; i < slen; i++) {
+    unsigned char c = src[i];
+    if (c == '\r' || c == '\n' || c == ' ') continue;
+    if (c == '=') { pads++; continue; }
+    if (pads || strchr(base64Chars, c) == NULL || c == 0) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+    clean += (char)c;
+  }
+  if (pads > 2 || (clean.size() + pads) % 4 != 0) return MBEDTLS_ERR_BASE64_INVALID_CHARACTER;
+  size_t need = clean.size() * 3 / 4;
+  if (dst == NULL || dlen < need) {
+    *olen = need;
+    return MBEDTLS_ERR_BASE64_BUFFER_TOO_SMALL;
+  }
+  size_t o = 0;
+  uint32_t v = 0;
+  int bits = 0;
+  for (char c : clean) {
+    v = (v << 6) | (uint32_t)(strchr(base64Chars, c) - base64Chars);
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      dst[o++] = (v >> bits) & 0xFF;
+    }
+  }
+  *olen = o;
+  return 0;
+}
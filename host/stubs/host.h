@@ -0,0 +1,64 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  The hooks a test program uses to drive the sketch and see what it did. Everything the sketch
+  itself can see is in Arduino.h and friends; this is the other side of the glass..
+                                                                                  */
+#pragma once
+#include <stdint.h>
+#include <functional>
+#include <string>
+#include <vector>
+
+void setup();
+void loop();
+
+// Serial: bytes in (as if typed), and everything printed since the last take..
+void hostSerialInput(const std::string &text);
+size_t hostSerialPending();
+std::string hostSerialTake();
+extern volatile bool hostSerialEcho;        // Also copy Serial output to stdout
+
+// Web: queue a request for the next server.handleClient(), and collect what was sent back..
+int hostWebRequest(const std::string &method, const std::string &uri, const std::string &body = "");
+size_t hostWebPending();
+std::string hostWebResponse(int client);
+void hostWebWindow(int client, size_t bytes);  // A slow page: takes no more than <bytes> unread (0 == any amount)
+extern bool hostWebStarted;                    // The sketch started its web server (it won't without REMOTE)
+
+// Heap: every malloc()/new since the program started (and how many are still live)..
+struct HostHeap {
+  uint64_t allocations;
+  uint64_t frees;
+  uint64_t liveBlocks;
+  uint64_t liveBytes;
+};
+HostHeap hostHeap();
+
+// Clocks: the sketch's (esp_timer) clock is the shared monotonic clock, plus an offset..
+int64_t hostTrueMicros();                   // CLOCK_MONOTONIC, the same for every process
+extern int64_t hostClockOffset;             // esp_timer_get_time() == hostTrueMicros() + this
+
+// I2S: each block written, at the rate it's being played. Writes block like the DMA does unless
+// hostI2SPaced is false (then they go as fast as the sketch can make them)..
+extern std::function<void(const uint8_t *data, size_t size, uint32_t rate)> hostI2SHook;
+extern volatile bool hostI2SPaced;
+
+// Signal changes (LEDC setup/frequency/duty, pin attach/detach, DAC, I2S install, RMT), as they happen..
+extern std::function<void(const char *what, uint32_t a, uint32_t b)> hostSignalHook;
+
+// Pins the sketch reads (buttons, pot, touch)..
+extern volatile int hostPinLevel[40];
+extern volatile uint16_t hostTouchLevel[40];
+extern volatile uint16_t hostAnalogLevel[40];
+
+// Sync (see lwip/sockets.h): which unit this is, and how many there are..
+extern int hostUnit;
+extern int hostUnits;
+uint32_t hostUnitAddress(int unit);         // 127.0.0.<unit+1>, network order
+
+// ESP.restart() lands here (the default exits)..
+extern std::function<void()> hostRestartHook;
+
+// Leave without running any destructors (the sketch's tasks are still going)..
+[[noreturn]] void hostExit(int code);
@@ -0,0 +1,18 @@
+/*
+  Host build: real UDP sockets, on the loopback. Each unit binds its own 127.0.0.<n+1> (instead of
+  INADDR_ANY) and a send to the broadcast address goes to every unit's address in turn (there are
+  hostUnits of them, see host.h). So a few copies of the sketch can find each other..
+                                                                                      */
+#pragma once
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <unistd.h>
+
+int hostBind(int sock, const struct sockaddr *addr, socklen_t length);
+ssize_t lwip_send(int sock, const void *data, size_t size, int flags); // Web clients only (WiFiClient::fd())
+ssize_t hostSendto(int sock, const void *data, size_t size, int flags, const struct sockaddr *to, socklen_t length);
+
+#define bind(...) hostBind(__VA_ARGS__)
+#define sendto(...) hostSendto(__VA_ARGS__)
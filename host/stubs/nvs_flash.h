@@ -0,0 +1,18 @@
+// Host build: NVS is a map in memory (see Preferences.h)..
+#pragma once
+#include "Arduino.h"
+
+#define ESP_ERR_NVS_BASE 0x1100
+#define ESP_ERR_NVS_NO_FREE_PAGES (ESP_ERR_NVS_BASE + 0x0d)
+#define ESP_ERR_NVS_NEW_VERSION_FOUND (ESP_ERR_NVS_BASE + 0x10)
+
+typedef struct {
+  size_t used_entries;
+  size_t free_entries;
+  size_t total_entries;
+  size_t namespace_count;
+} nvs_stats_t;
+
+esp_err_t nvs_flash_init();
+esp_err_t nvs_flash_erase();
+esp_err_t nvs_get_stats(const char *part_name, nvs_stats_t *stats);
@@ -0,0 +1,5 @@
+// Host build: RTC clocks..
+#pragma once
+#include "Arduino.h"
+
+#define RTC_FAST_CLK_FREQ_APPROX 8500000
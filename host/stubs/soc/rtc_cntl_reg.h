@@ -0,0 +1,9 @@
+// Host build: the registers live in an array (see soc/sens_reg.h)..
+#pragma once
+#include "soc/sens_reg.h"
+
+#define RTC_CNTL_CLK_CONF_REG (&hostRegisters[HOST_REG_RTC_CNTL_CLK_CONF])
+#define RTC_CNTL_CK8M_DIV_SEL 0x00000007
+#define RTC_CNTL_CK8M_DIV_SEL_M ((RTC_CNTL_CK8M_DIV_SEL_V) << (RTC_CNTL_CK8M_DIV_SEL_S))
+#define RTC_CNTL_CK8M_DIV_SEL_V 0x7
+#define RTC_CNTL_CK8M_DIV_SEL_S 12
@@ -0,0 +1,38 @@
+/*
+  Host build: the SENS (DAC) registers. Same names, bits and access macros as the chip, but the
+  "registers" are words in hostRegisters[], so a test can see what the sketch set..
+                                                                              */
+#pragma once
+#include <stdint.h>
+
+enum { HOST_REG_SENS_SAR_DAC_CTRL1, HOST_REG_SENS_SAR_DAC_CTRL2, HOST_REG_RTC_CNTL_CLK_CONF, HOST_REG_COUNT };
+extern volatile uint32_t hostRegisters[HOST_REG_COUNT];
+
+#define REG_READ(r) (*(r))
+#define REG_WRITE(r, v) (*(r) = (v))
+#define REG_GET_FIELD(r, f) ((REG_READ(r) >> (f##_S)) & (f##_V))
+#define REG_SET_FIELD(r, f, v) REG_WRITE(r, (REG_READ(r) & ~((f##_V) << (f##_S))) | (((v) & (f##_V)) << (f##_S)))
+#define READ_PERI_REG(r) REG_READ(r)
+#define WRITE_PERI_REG(r, v) REG_WRITE(r, v)
+#define SET_PERI_REG_MASK(r, m) REG_WRITE(r, REG_READ(r) | (m))
+#define CLEAR_PERI_REG_MASK(r, m) REG_WRITE(r, REG_READ(r) & ~(m))
+#define GET_PERI_REG_BITS2(r, m, s) ((REG_READ(r) >> (s)) & (m))
+#define SET_PERI_REG_BITS(r, m, v, s) REG_WRITE(r, (REG_READ(r) & ~((m) << (s))) | (((v) & (m)) << (s)))
+
+#define SENS_SAR_DAC_CTRL1_REG (&hostRegisters[HOST_REG_SENS_SAR_DAC_CTRL1])
+#define SENS_SW_FSTEP 0x0000FFFF
+#define SENS_SW_FSTEP_V 0xFFFF
+#define SENS_SW_FSTEP_S 0
+#define SENS_SW_TONE_EN (1u << 16)
+
+#define SENS_SAR_DAC_CTRL2_REG (&hostRegisters[HOST_REG_SENS_SAR_DAC_CTRL2])
+#define SENS_DAC_CW_EN2_M (1u << 25)
+#define SENS_DAC_CW_EN1_M (1u << 24)
+#define SENS_DAC_INV2 0x3
+#define SENS_DAC_INV2_S 22
+#define SENS_DAC_INV1 0x3
+#define SENS_DAC_INV1_S 20
+#define SENS_DAC_SCALE2 0x3
+#define SENS_DAC_SCALE2_S 18
+#define SENS_DAC_SCALE1 0x3
+#define SENS_DAC_SCALE1_S 16
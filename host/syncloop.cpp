@@ -0,0 +1,158 @@
+/*
+  A part of ESP32 Signal Generator (host build)
+
+  Network sync test, over loopback. Starts a few units (separate processes, each with its own
+  address, 127.0.0.<unit+1>, and its own clock, miles apart from the others), makes the first one
+  the leader and the rest followers, then schedules changes on all of them at once and times when
+  each one's signal actually changed, by the one clock they share underneath (CLOCK_MONOTONIC)..
+
+    ./syncloop                  3 units
+    ./syncloop 5                5 units
+    SG_ECHO=1 ./syncloop        .. and show what they all say
+
+  The script (seconds from the start)..
+
+    0     unit 0: sync leader, the rest: sync follow (rectangle, 1kHz)
+    4     leader: sync 1000:2k
+    7     leader: sync off, sync leader   (a new run; its events count from 1 again)
+    10    leader: sync 1000:3k            (followers must still take this one)
+    13    done
+
+  For each change you get when each unit made it, relative to the leader, and the spread. Exits 0
+  if every unit made both changes within syncSkewMAX of each other, 1 if not.
+                                                                                    */
+#include <Arduino.h>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <sys/wait.h>
+#include <unistd.h>
+#include "host.h"
+
+// From the sketch..
+extern String QCommand;
+extern bool amDelaying;
+uint8_t commandsWaiting();
+
+const int64_t syncSkewMAX = 5000;     // us; it's loopback, but the units share the CPU(s)
+const uint32_t targets[] = { 2000, 3000 };
+
+// What the signal did, and when (true time)..
+static std::mutex changeLock;
+static std::vector<std::pair<uint32_t, int64_t>> changes;
+
+static bool idle() {
+  return hostSerialPending() == 0 && QCommand == "" && commandsWaiting() == 0 && !amDelaying;
+}
+
+static void command(const std::string &c) {
+  hostSerialInput(c + "\n");
+  for (int i = 0; i < 1000 && !idle(); i++) loop();
+}
+
+// Keep the unit going (a pass of loop() every millisecond or so) until <when>..
+static void runUntil(int64_t when) {
+  while (hostTrueMicros() < when) {
+    loop();
+    usleep(1000);
+  }
+}
+
+static void unit(int number, int units, int64_t start, int out) {
+
+  hostUnit = number;
+  hostUnits = units;
+  hostClockOffset = number * 7654321987LL;    // Each unit's clock is a couple of hours from the next
+  hostSerialEcho = (getenv("SG_ECHO") != NULL);
+  hostSignalHook = [](const char *what, uint32_t a, uint32_t b) {
+    if (strcmp(what, "ledcSetup") != 0 && strcmp(what, "ledcChangeFrequency") != 0) return;
+    std::lock_guard<std::mutex> hold(changeLock);
+    changes.push_back({ b, hostTrueMicros() });
+  };
+
+  setup();
+  command("r");
+  command("1k");
+  command((number == 0) ? "sync leader" : "sync follow");
+
+  runUntil(start + 4000000);
+  if (number == 0) command("sync 1000:2k");
+  runUntil(start + 7000000);
+  if (number == 0) {
+    command("sync off");
+    command("sync leader");
+  }
+  runUntil(start + 10000000);
+  if (number == 0) command("sync 1000:3k");
+  runUntil(start + 13000000);
+
+  // First time each target turned up..
+  std::lock_guard<std::mutex> hold(changeLock);
+  for (uint32_t target : targets) {
+    for (auto &c : changes) {
+      if (c.first < target * 0.99 || c.first > target * 1.01) continue;
+      dprintf(out, "%d %u %lld\n", number, target, (long long)c.second);
+      break;
+    }
+  }
+  hostExit(0);
+}
+
+int main(int argc, char **argv) {
+
+  int units = (argc > 1) ? atoi(argv[1]) : 3;
+  if (units < 2) units = 2;
+  if (units > 8) units = 8;
+
+  printf("\n ESP32 Signal Generator network sync test (host build): %d units over loopback\n\n", units);
+  fflush(stdout);
+
+  int results[2];
+  if (pipe(results) != 0) return 1;
+  int64_t start = hostTrueMicros() + 500000;
+  std::vector<pid_t> pids;
+  for (int i = 0; i < units; i++) {
+    pid_t pid = fork();
+    if (pid == 0) {
+      close(results[0]);
+      unit(i, units, start, results[1]);
+    }
+    pids.push_back(pid);
+  }
+  close(results[1]);
+
+  // <unit> <target> <true time>, a line each..
+  std::vector<std::vector<int64_t>> when(2, std::vector<int64_t>(units, 0));
+  FILE *in = fdopen(results[0], "r");
+  int number;
+  unsigned target;
+  long long at;
+  while (fscanf(in, "%d %u %lld", &number, &target, &at) == 3) {
+    for (int t = 0; t < 2; t++) if (targets[t] == target && number >= 0 && number < units) when[t][number] = at;
+  }
+  for (pid_t pid : pids) waitpid(pid, NULL, 0);
+
+  bool failed = false;
+  for (int t = 0; t < 2; t++) {
+    printf("  %uHz:", targets[t]);
+    int64_t lo = INT64_MAX, hi = INT64_MIN;
+    bool missing = false;
+    for (int i = 0; i < units; i++) {
+      if (when[t][i] == 0) {
+        printf("  unit %d: never", i);
+        missing = true;
+        continue;
+      }
+      printf("  unit %d: %+lldus", i, (long long)(when[t][i] - when[t][0]));
+      if (when[t][i] < lo) lo = when[t][i];
+      if (when[t][i] > hi) hi = when[t][i];
+    }
+    bool ok = !missing && hi - lo <= syncSkewMAX;
+    if (!missing) printf("   spread %lldus", (long long)(hi - lo));
+    printf("   %s\n", (ok) ? "ok" : "FAILED");
+    if (!ok) failed = true;
+  }
+
+  printf("\n  %s\n\n", (failed) ? "FAILED" : "Passed");
+  return (failed) ? 1 : 0;
+}